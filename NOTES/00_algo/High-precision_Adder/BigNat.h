@@ -0,0 +1,213 @@
+/**
+ * @file BigNat.h
+ * @brief BigNat<Base>ƵȻģ壬ͳһ High-precision_Adder  add() (10 )  binary_add() (2 )
+ * @note Ҫ C++17Base ȡֵ 2 ~ 2^63
+ *
+ * add()  binary_add() ͬһѭֻ "% 10 / 10"  "% 2 / 2" ͬBigNat ѽģ
+ * صѡڱɣ
+ *   - 洢ֿDigit װ Base - 1 С޷ (10  1 ֽڣ10^18  8 ֽ)
+ *   - 2 ݽƣλλλ (sum >> log2(Base), sum & (Base - 1))
+ *   -  ( 10^k)ټӽλһС 2 * Baseλֻ 0  1
+ *     һαȽ + ͹ˣȫҪ
+ *   - ַתʱҪ Radix (2  10)Ǳڳỻλ"Եλ"
+ * һ BigNat<10^18> ִ 18 ʮλһμӷ add()  18 ѭ
+ * λӵѭɺ AddDigits<Base>BigNat::operator+=add() (vector<int>)  binary_add() ֱӵ
+ * ҪȰ vector<int> ת BigNat
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace bignum
+{
+    namespace detail
+    {
+        constexpr bool IsPowerOfTwo(std::uint64_t x) { return x != 0 && (x & (x - 1)) == 0; }
+
+        constexpr unsigned Log2(std::uint64_t x)
+        {
+            unsigned n = 0;
+            while (x > 1)
+            {
+                x >>= 1;
+                n++;
+            }
+            return n;
+        }
+
+        // Base == Radix^k ʱ k򷵻 0
+        constexpr unsigned ExactLog(std::uint64_t base, std::uint64_t radix)
+        {
+            unsigned k = 0;
+            while (base > 1 && base % radix == 0)
+            {
+                base /= radix;
+                k++;
+            }
+            return base == 1 ? k : 0;
+        }
+
+        // װ [0, maxValue] С޷
+        template <std::uint64_t MaxValue>
+        using SmallestUnsigned = std::conditional_t<MaxValue <= 0xFFu, std::uint8_t,
+                                                    std::conditional_t<MaxValue <= 0xFFFFu, std::uint16_t,
+                                                                       std::conditional_t<MaxValue <= 0xFFFFFFFFu, std::uint32_t, std::uint64_t>>>;
+
+        // sum <= 2 * (Base - 1) + 1д뱾λؽλ (0  1)
+        template <std::uint64_t Base, typename D>
+        std::uint64_t AddDigit(D &digit, std::uint64_t sum)
+        {
+            if constexpr (IsPowerOfTwo(Base))
+            {
+                digit = static_cast<D>(sum & (Base - 1));
+                return sum >> Log2(Base);
+            }
+            else
+            {
+                const std::uint64_t carry = sum >= Base;
+                digit = static_cast<D>(sum - carry * Base);
+                return carry;
+            }
+        }
+    } // namespace detail
+
+    // ԭؼӷacc[0, accSize) += addend[0, addendSize)߶ǵλǰ
+    // Ҫ accSize >= addendSizeÿֶ [0, Base)ֻд accλϵĽλ (0  1)ɵ÷ô׷
+    // D / E ͣBigNat С޷ͣadd() / binary_add() ֱӴ vector<int> 
+    template <std::uint64_t Base, typename D, typename E>
+    std::uint64_t AddDigits(D *acc, std::size_t accSize, const E *addend, std::size_t addendSize)
+    {
+        static_assert(Base >= 2 && Base <= (std::uint64_t{1} << 63), "AddDigits: Base must be in [2, 2^63]");
+        std::uint64_t carry = 0;
+        std::size_t i = 0;
+        for (; i < addendSize; i++)
+            carry = detail::AddDigit<Base>(acc[i], static_cast<std::uint64_t>(acc[i]) + static_cast<std::uint64_t>(addend[i]) + carry);
+        // ϶̵Ѿ꣺ʣµλֻҪݽλλʧ󼴿ǰ
+        for (; carry != 0 && i < accSize; i++)
+            carry = detail::AddDigit<Base>(acc[i], static_cast<std::uint64_t>(acc[i]) + carry);
+        return carry;
+    }
+
+    template <std::uint64_t Base>
+    class BigNat
+    {
+        static_assert(Base >= 2 && Base <= (std::uint64_t{1} << 63), "BigNat: Base must be in [2, 2^63]");
+
+    public:
+        using Digit = detail::SmallestUnsigned<Base - 1>;
+        static constexpr std::uint64_t kBase = Base;
+        static constexpr bool kPowerOfTwo = detail::IsPowerOfTwo(Base);
+
+        BigNat() = default;
+        BigNat(std::uint64_t value)
+        {
+            for (; value != 0; value /= Base)
+                m_Digits.push_back(static_cast<Digit>(value % Base));
+        }
+
+        // ӵλλй ( add()  vector<int> ˳ͬ)ֱС Base
+        template <typename It>
+        static BigNat FromDigits(It first, It last)
+        {
+            BigNat result;
+            result.m_Digits.reserve(static_cast<std::size_t>(std::distance(first, last)));
+            for (; first != last; ++first)
+            {
+                if (static_cast<std::uint64_t>(*first) >= Base)
+                    throw std::invalid_argument("BigNat: digit out of range");
+                result.m_Digits.push_back(static_cast<Digit>(*first));
+            }
+            result.Normalize();
+            return result;
+        }
+
+        //  Radix Ƶַ (λǰ)Ҫ Base  Radix ݣÿ k ַһ
+        template <unsigned Radix>
+        static BigNat FromString(std::string_view text)
+        {
+            constexpr unsigned kChars = detail::ExactLog(Base, Radix);
+            static_assert(Radix >= 2 && Radix <= 10 && kChars > 0, "BigNat: Base must be a power of Radix");
+
+            BigNat result;
+            result.m_Digits.reserve(text.size() / kChars + 1);
+            for (std::size_t end = text.size(); end > 0;)
+            {
+                const std::size_t begin = end > kChars ? end - kChars : 0;
+                std::uint64_t value = 0;
+                for (std::size_t i = begin; i < end; i++)
+                {
+                    const unsigned d = static_cast<unsigned>(text[i] - '0');
+                    if (d >= Radix)
+                        throw std::invalid_argument("BigNat: invalid digit in input");
+                    value = value * Radix + d;
+                }
+                result.m_Digits.push_back(static_cast<Digit>(value));
+                end = begin;
+            }
+            result.Normalize();
+            return result;
+        }
+
+        //  Radix Ƶַλֲ 0ÿֲ k ַ
+        template <unsigned Radix>
+        std::string ToString() const
+        {
+            constexpr unsigned kChars = detail::ExactLog(Base, Radix);
+            static_assert(Radix >= 2 && Radix <= 10 && kChars > 0, "BigNat: Base must be a power of Radix");
+            if (m_Digits.empty())
+                return "0";
+
+            char top[64];
+            std::size_t topLength = 0;
+            for (std::uint64_t v = m_Digits.back(); v != 0; v /= Radix)
+                top[topLength++] = static_cast<char>('0' + v % Radix);
+
+            std::string out(topLength + (m_Digits.size() - 1) * kChars, '0');
+            std::reverse_copy(top, top + topLength, out.begin());
+            char *cursor = &out[topLength];
+            for (std::size_t i = m_Digits.size() - 1; i-- > 0; cursor += kChars)
+            {
+                std::uint64_t v = m_Digits[i];
+                for (unsigned j = kChars; j-- > 0; v /= Radix) // ǱڳλԵ
+                    cursor[j] = static_cast<char>('0' + v % Radix);
+            }
+            return out;
+        }
+
+        const std::vector<Digit> &Digits() const { return m_Digits; }
+        std::size_t DigitCount() const { return m_Digits.size(); }
+        bool IsZero() const { return m_Digits.empty(); }
+
+        BigNat &operator+=(const BigNat &other)
+        {
+            if (m_Digits.size() < other.m_Digits.size())
+                m_Digits.resize(other.m_Digits.size(), 0);
+            const std::uint64_t carry = AddDigits<Base>(m_Digits.data(), m_Digits.size(), other.m_Digits.data(), other.m_Digits.size());
+            if (carry != 0)
+                m_Digits.push_back(static_cast<Digit>(carry));
+            return *this;
+        }
+
+        friend BigNat operator+(BigNat a, const BigNat &b) { return a += b; }
+        friend bool operator==(const BigNat &a, const BigNat &b) { return a.m_Digits == b.m_Digits; }
+        friend bool operator!=(const BigNat &a, const BigNat &b) { return !(a == b); }
+
+    private:
+        void Normalize()
+        {
+            while (!m_Digits.empty() && m_Digits.back() == 0)
+                m_Digits.pop_back();
+        }
+
+        std::vector<Digit> m_Digits; // Сm_Digits[0] λ
+    };
+} // namespace bignum
@@ -0,0 +1,528 @@
+/**
+ * @file BigUInt.h
+ * @brief ƴ BigUInt (2^64 ƣÿ limb һ uint64) ζηʮת to_decimal_string
+ * @note Ҫ C++17  unsigned __int128 (GCC / Clang)
+ *
+ * High-precision_Adder ÿʮλһ intӷ򵥣һ int ֻ 3.3 صϢ
+ * һλ F(n) ȷڴBigUInt ÿ limb  64 أӷһδ 19 ʮλϣ
+ * ʱҪת
+ *   -  10^19ÿȡ 19 λһ O(n) Ρÿ O(n)ܼ O(n^2)
+ *   -  (to_decimal_string)Ԥ P_k = 10^(19 * 2^k) 䵹x = q * P_k + r
+ *     ߰ q ͵Ͱ r ֱݹ飻"Ե"ɣ˷ Karatsubaܼ O(M(n) log n)
+ * ÿ 19 λλһĲдֱдһԤȷõĻһ
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bignum
+{
+    using Limb = std::uint64_t;
+    using Wide = unsigned __int128;
+
+    // ==========================================
+    // 1. limb ϵĵײ (Сlimb[0] λ)
+    // ==========================================
+    namespace detail
+    {
+        constexpr std::size_t kKaratsubaThreshold = 32; // ô limb ʱʽ˷
+
+        // a[0..an) += b[0..bn)Ҫ an >= bnλĽλ
+        inline Limb AddTo(Limb *a, std::size_t an, const Limb *b, std::size_t bn)
+        {
+            Limb carry = 0;
+            std::size_t i = 0;
+            for (; i < bn; i++)
+            {
+                Wide sum = static_cast<Wide>(a[i]) + b[i] + carry;
+                a[i] = static_cast<Limb>(sum);
+                carry = static_cast<Limb>(sum >> 64);
+            }
+            for (; carry && i < an; i++)
+                carry = ++a[i] == 0;
+            return carry;
+        }
+
+        // a[0..an) -= b[0..bn)Ҫ an >= bnؽλ
+        inline Limb SubFrom(Limb *a, std::size_t an, const Limb *b, std::size_t bn)
+        {
+            Limb borrow = 0;
+            std::size_t i = 0;
+            for (; i < bn; i++)
+            {
+                Wide diff = static_cast<Wide>(a[i]) - b[i] - borrow;
+                a[i] = static_cast<Limb>(diff);
+                borrow = static_cast<Limb>(diff >> 64) & 1;
+            }
+            for (; borrow && i < an; i++)
+                borrow = a[i]-- == 0;
+            return borrow;
+        }
+
+        // ʽ˷r[0..an+bn) = a * b (r  ab ص)
+        inline void MulSchool(Limb *r, const Limb *a, std::size_t an, const Limb *b, std::size_t bn)
+        {
+            std::fill(r, r + an + bn, Limb{0});
+            for (std::size_t i = 0; i < an; i++)
+            {
+                Limb carry = 0;
+                const Wide ai = a[i];
+                for (std::size_t j = 0; j < bn; j++)
+                {
+                    Wide t = ai * b[j] + r[i + j] + carry;
+                    r[i + j] = static_cast<Limb>(t);
+                    carry = static_cast<Limb>(t >> 64);
+                }
+                r[i + bn] = carry;
+            }
+        }
+
+        inline std::size_t KaratsubaScratchSize(std::size_t n)
+        {
+            std::size_t total = 0;
+            while (n >= kKaratsubaThreshold)
+            {
+                std::size_t hi = n - n / 2;
+                total += 4 * hi + 4;
+                n = hi;
+            }
+            return total;
+        }
+
+        // Karatsubar[0..2n) = a[0..n) * b[0..n)
+        // a = a1 * B^lo + a0z0 = a0*b0z2 = a1*b1м = (a0+a1)(b0+b1) - z0 - z23 γ˷ 4 
+        inline void MulKaratsuba(Limb *r, const Limb *a, const Limb *b, std::size_t n, Limb *scratch)
+        {
+            if (n < kKaratsubaThreshold)
+            {
+                MulSchool(r, a, n, b, n);
+                return;
+            }
+            const std::size_t lo = n / 2, hi = n - lo;
+            Limb *sa = scratch;         // a0 + a1 (hi + 1  limb)
+            Limb *sb = sa + hi + 1;     // b0 + b1
+            Limb *mid = sb + hi + 1;    // (a0+a1)(b0+b1)2hi + 2  limb
+            Limb *next = mid + 2 * hi + 2;
+
+            MulKaratsuba(r, a, b, lo, next);                          // r[0..2lo) = z0
+            MulKaratsuba(r + 2 * lo, a + lo, b + lo, hi, next);       // r[2lo..2n) = z2
+
+            std::copy(a + lo, a + n, sa);
+            sa[hi] = AddTo(sa, hi, a, lo);
+            std::copy(b + lo, b + n, sb);
+            sb[hi] = AddTo(sb, hi, b, lo);
+
+            // (sa + ca*B^hi)(sb + cb*B^hi)cacb  0  1
+            MulKaratsuba(mid, sa, sb, hi, next);
+            mid[2 * hi] = 0;
+            mid[2 * hi + 1] = 0;
+            if (sa[hi])
+                AddTo(mid + hi, hi + 2, sb, hi);
+            if (sb[hi])
+                AddTo(mid + hi, hi + 2, sa, hi);
+            if (sa[hi] && sb[hi])
+            {
+                const Limb one = 1;
+                AddTo(mid + 2 * hi, 2, &one, 1);
+            }
+
+            SubFrom(mid, 2 * hi + 2, r, 2 * lo);
+            SubFrom(mid, 2 * hi + 2, r + 2 * lo, 2 * hi);
+            AddTo(r + lo, 2 * n - lo, mid, 2 * hi + 1); // м < 2*B^(2hi)2hi + 1  limb 㹻
+        }
+
+        // һ˷r[0..an+bn) = a * bʱѳһг̵һĿ
+        inline void Mul(Limb *r, const Limb *a, std::size_t an, const Limb *b, std::size_t bn)
+        {
+            if (an < bn)
+            {
+                std::swap(a, b);
+                std::swap(an, bn);
+            }
+            if (bn < kKaratsubaThreshold)
+            {
+                MulSchool(r, a, an, b, bn);
+                return;
+            }
+            std::vector<Limb> scratch(KaratsubaScratchSize(bn));
+            if (an == bn)
+            {
+                MulKaratsuba(r, a, b, bn, scratch.data());
+                return;
+            }
+            std::fill(r, r + an + bn, Limb{0});
+            std::vector<Limb> block(2 * bn);
+            for (std::size_t offset = 0; offset < an; offset += bn)
+            {
+                const std::size_t len = std::min(bn, an - offset);
+                if (len == bn)
+                    MulKaratsuba(block.data(), a + offset, b, bn, scratch.data());
+                else
+                    Mul(block.data(), b, bn, a + offset, len);
+                AddTo(r + offset, an + bn - offset, block.data(), bn + len);
+            }
+        }
+    } // namespace detail
+
+    // ==========================================
+    // 2. BigUIntǸ
+    // ==========================================
+    class BigUInt
+    {
+    public:
+        BigUInt() = default;
+        BigUInt(Limb value)
+        {
+            if (value != 0)
+                m_Limbs.push_back(value);
+        }
+
+        static BigUInt FromLimbs(std::vector<Limb> limbs)
+        {
+            BigUInt result;
+            result.m_Limbs = std::move(limbs);
+            result.Normalize();
+            return result;
+        }
+
+        // B^kB = 2^64
+        static BigUInt PowerOfBase(std::size_t k)
+        {
+            BigUInt result;
+            result.m_Limbs.assign(k + 1, 0);
+            result.m_Limbs[k] = 1;
+            return result;
+        }
+
+        const std::vector<Limb> &Limbs() const { return m_Limbs; }
+        std::size_t LimbCount() const { return m_Limbs.size(); }
+        bool IsZero() const { return m_Limbs.empty(); }
+
+        BigUInt &operator+=(const BigUInt &other)
+        {
+            if (m_Limbs.size() < other.m_Limbs.size())
+                m_Limbs.resize(other.m_Limbs.size(), 0);
+            if (detail::AddTo(m_Limbs.data(), m_Limbs.size(), other.m_Limbs.data(), other.m_Limbs.size()))
+                m_Limbs.push_back(1);
+            return *this;
+        }
+
+        // Ҫ *this >= other׳ std::underflow_error
+        BigUInt &operator-=(const BigUInt &other)
+        {
+            if (Compare(*this, other) < 0)
+                throw std::underflow_error("BigUInt: negative result");
+            detail::SubFrom(m_Limbs.data(), m_Limbs.size(), other.m_Limbs.data(), other.m_Limbs.size());
+            Normalize();
+            return *this;
+        }
+
+        friend BigUInt operator+(BigUInt a, const BigUInt &b) { return a += b; }
+        friend BigUInt operator-(BigUInt a, const BigUInt &b) { return a -= b; }
+
+        friend BigUInt operator*(const BigUInt &a, const BigUInt &b)
+        {
+            if (a.IsZero() || b.IsZero())
+                return BigUInt();
+            std::vector<Limb> product(a.m_Limbs.size() + b.m_Limbs.size());
+            detail::Mul(product.data(), a.m_Limbs.data(), a.m_Limbs.size(), b.m_Limbs.data(), b.m_Limbs.size());
+            return FromLimbs(std::move(product));
+        }
+
+        // floor(*this / B^k)  *this * B^k
+        BigUInt ShiftedRightLimbs(std::size_t k) const
+        {
+            if (k >= m_Limbs.size())
+                return BigUInt();
+            return FromLimbs(std::vector<Limb>(m_Limbs.begin() + static_cast<std::ptrdiff_t>(k), m_Limbs.end()));
+        }
+        BigUInt ShiftedLeftLimbs(std::size_t k) const
+        {
+            if (IsZero())
+                return BigUInt();
+            std::vector<Limb> limbs(k, 0);
+            limbs.insert(limbs.end(), m_Limbs.begin(), m_Limbs.end());
+            return FromLimbs(std::move(limbs));
+        }
+
+        // ԭسһ limb
+        Limb DivModSmall(Limb divisor)
+        {
+            Limb remainder = 0;
+            for (std::size_t i = m_Limbs.size(); i-- > 0;)
+            {
+                Wide cur = (static_cast<Wide>(remainder) << 64) | m_Limbs[i];
+                m_Limbs[i] = static_cast<Limb>(cur / divisor);
+                remainder = static_cast<Limb>(cur % divisor);
+            }
+            Normalize();
+            return remainder;
+        }
+
+        friend int Compare(const BigUInt &a, const BigUInt &b)
+        {
+            if (a.m_Limbs.size() != b.m_Limbs.size())
+                return a.m_Limbs.size() < b.m_Limbs.size() ? -1 : 1;
+            for (std::size_t i = a.m_Limbs.size(); i-- > 0;)
+            {
+                if (a.m_Limbs[i] != b.m_Limbs[i])
+                    return a.m_Limbs[i] < b.m_Limbs[i] ? -1 : 1;
+            }
+            return 0;
+        }
+        friend bool operator==(const BigUInt &a, const BigUInt &b) { return a.m_Limbs == b.m_Limbs; }
+        friend bool operator!=(const BigUInt &a, const BigUInt &b) { return !(a == b); }
+        friend bool operator<(const BigUInt &a, const BigUInt &b) { return Compare(a, b) < 0; }
+        friend bool operator<=(const BigUInt &a, const BigUInt &b) { return Compare(a, b) <= 0; }
+        friend bool operator>(const BigUInt &a, const BigUInt &b) { return Compare(a, b) > 0; }
+        friend bool operator>=(const BigUInt &a, const BigUInt &b) { return Compare(a, b) >= 0; }
+
+    private:
+        void Normalize()
+        {
+            while (!m_Limbs.empty() && m_Limbs.back() == 0)
+                m_Limbs.pop_back();
+        }
+
+        std::vector<Limb> m_Limbs;
+    };
+
+    // ==========================================
+    // 3. 
+    // ==========================================
+    namespace detail
+    {
+        // صĳ floor(num / den)ֻںС (ݹײ)
+        inline BigUInt DivideSlow(const BigUInt &num, const BigUInt &den)
+        {
+            const std::size_t dn = den.LimbCount();
+            std::vector<Limb> quotient(num.LimbCount(), 0);
+            std::vector<Limb> remainder(dn + 1, 0); //  < 2 * denһ limb
+            for (std::size_t bit = num.LimbCount() * 64; bit-- > 0;)
+            {
+                // remainder = remainder * 2 + ǰ
+                for (std::size_t i = dn + 1; i-- > 1;)
+                    remainder[i] = (remainder[i] << 1) | (remainder[i - 1] >> 63);
+                remainder[0] = (remainder[0] << 1) | ((num.Limbs()[bit / 64] >> (bit % 64)) & 1);
+
+                bool geq = remainder[dn] != 0;
+                for (std::size_t i = dn; !geq && i-- > 0;)
+                {
+                    if (remainder[i] != den.Limbs()[i])
+                    {
+                        geq = remainder[i] > den.Limbs()[i];
+                        break;
+                    }
+                    if (i == 0)
+                        geq = true; // 
+                }
+                if (geq)
+                {
+                    SubFrom(remainder.data(), dn + 1, den.Limbs().data(), dn);
+                    quotient[bit / 64] |= Limb{1} << (bit % 64);
+                }
+            }
+            return BigUInt::FromLimbs(std::move(quotient));
+        }
+
+        // d  n  limb floor(B^(2n) / d) (ȷֵ)
+        //  d ĸ h  limb ݹƵ v (h ԼΪ n/2 2  limb )
+        // һţٵ v += v * (B^(2n) - d*v) / B^(2n) Ѿȷ d*v Уȷֵ
+        inline BigUInt Reciprocal(const BigUInt &d)
+        {
+            const std::size_t n = d.LimbCount();
+            const BigUInt scale = BigUInt::PowerOfBase(2 * n);
+            if (n <= 8)
+                return DivideSlow(scale, d);
+
+            const std::size_t h = n / 2 + 2;
+            BigUInt v = Reciprocal(d.ShiftedRightLimbs(n - h)).ShiftedLeftLimbs(n - h);
+
+            BigUInt product = d * v;
+            const bool increase = product <= scale;
+            const BigUInt error = increase ? scale - product : product - scale;
+            //  v * error / B^(2n) ֻԼ n/2  limbӸ n/2 + 3  limb ͹
+            const std::size_t keep = n / 2 + 3;
+            const std::size_t dropV = v.LimbCount() > keep ? v.LimbCount() - keep : 0;
+            const std::size_t dropE = error.LimbCount() > keep ? error.LimbCount() - keep : 0;
+            const BigUInt delta = (v.ShiftedRightLimbs(dropV) * error.ShiftedRightLimbs(dropE)).ShiftedRightLimbs(2 * n - dropV - dropE);
+            if (increase)
+            {
+                v += delta;
+                product += d * delta;
+            }
+            else
+            {
+                v -= delta;
+                product -= d * delta;
+            }
+
+            while (product > scale)
+            {
+                v -= BigUInt(1);
+                product -= d;
+            }
+            while (scale - product >= d)
+            {
+                v += BigUInt(1);
+                product += d;
+            }
+            return v;
+        }
+
+        // 10^(19 * 2^k) 䵹
+        struct DecimalPower
+        {
+            BigUInt value;
+            BigUInt inverse; // floor(B^(2m) / value)m = value  limb һõʱż
+        };
+
+        // x < value^2 ʱq = floor(x / value)r = x - q * value
+        //  s  limb ʱֻҪĸ s + 2  limb  (ͨȳ̵ö)
+        // ֵʵֵ 2ó˷ͼУ
+        inline void DivModPower(const BigUInt &x, DecimalPower &power, BigUInt &q, BigUInt &r)
+        {
+            const std::size_t m = power.value.LimbCount();
+            const std::size_t quotientLimbs = x.LimbCount() >= m ? x.LimbCount() - m + 1 : 1;
+            const std::size_t t = std::min(m, quotientLimbs + 2);
+            if (t == m)
+            {
+                if (power.inverse.IsZero())
+                    power.inverse = Reciprocal(power.value);
+                q = (x * power.inverse).ShiftedRightLimbs(2 * m);
+            }
+            else
+            {
+                BigUInt inverse = Reciprocal(power.value.ShiftedRightLimbs(m - t));
+                q = (x.ShiftedRightLimbs(m - t) * inverse).ShiftedRightLimbs(2 * t);
+            }
+
+            BigUInt product = q * power.value;
+            while (product > x)
+            {
+                q -= BigUInt(1);
+                product -= power.value;
+            }
+            r = x - product;
+            while (r >= power.value)
+            {
+                r -= power.value;
+                q += BigUInt(1);
+            }
+        }
+    } // namespace detail
+
+    // ==========================================
+    // 4. ʮ
+    // ==========================================
+    namespace detail
+    {
+        constexpr Limb kChunk = 10000000000000000000ULL; // 10^19һ limb ɵ 10 
+        constexpr std::size_t kChunkDigits = 19;
+        constexpr std::size_t kNaiveLimbs = 40;              // εݹ鵽ôСʱֱӷ 10^19
+        constexpr std::size_t kDivideAndConquerLimbs = 1000; // Сģʱβ (Ĺ̶)
+
+        struct DigitPairs
+        {
+            char pairs[200];
+            constexpr DigitPairs() : pairs()
+            {
+                for (int i = 0; i < 100; i++)
+                {
+                    pairs[2 * i] = static_cast<char>('0' + i / 10);
+                    pairs[2 * i + 1] = static_cast<char>('0' + i % 10);
+                }
+            }
+        };
+        inline constexpr DigitPairs kDigitPairs{};
+
+        //  value (< 10^19) дɶ 19 λ㲹 0ÿγ 100 дλ
+        inline void WriteChunk(char *out, Limb value)
+        {
+            for (int i = static_cast<int>(kChunkDigits) - 2; i >= 1; i -= 2)
+            {
+                std::memcpy(out + i, kDigitPairs.pairs + 2 * (value % 100), 2);
+                value /= 100;
+            }
+            out[0] = static_cast<char>('0' + value);
+        }
+
+        //  x дɶ digits λ (19 ı)Ҫ x < 10^digits
+        inline void ConvertNaive(BigUInt x, char *out, std::size_t digits)
+        {
+            std::size_t pos = digits;
+            while (!x.IsZero())
+            {
+                pos -= kChunkDigits;
+                WriteChunk(out + pos, x.DivModSmall(kChunk));
+            }
+            std::memset(out, '0', pos);
+        }
+
+        // x < powers[k]^2д 19 * 2^(k+1) λ
+        inline void ConvertRecursive(const BigUInt &x, std::size_t k, std::vector<DecimalPower> &powers, char *out)
+        {
+            const std::size_t width = kChunkDigits << (k + 1);
+            if (x.LimbCount() <= kNaiveLimbs)
+            {
+                ConvertNaive(x, out, width);
+                return;
+            }
+            BigUInt q, r;
+            DivModPower(x, powers[k], q, r);
+            ConvertRecursive(q, k - 1, powers, out);
+            ConvertRecursive(r, k - 1, powers, out + width / 2);
+        }
+
+        inline std::string StripLeadingZeros(std::string digits)
+        {
+            std::size_t first = digits.find_first_not_of('0');
+            if (first == std::string::npos)
+                return "0";
+            digits.erase(0, first);
+            return digits;
+        }
+    } // namespace detail
+
+    // ص O(n^2) ת 10^19 ()
+    inline std::string to_decimal_string_naive(const BigUInt &x)
+    {
+        // 64  < 19.3 ʮλÿ limb Ԥ 20 λһ
+        std::size_t chunks = (x.LimbCount() * 20) / detail::kChunkDigits + 1;
+        std::string buffer(chunks * detail::kChunkDigits, '0');
+        detail::ConvertNaive(x, &buffer[0], buffer.size());
+        return detail::StripLeadingZeros(std::move(buffer));
+    }
+
+    // תO(M(n) log n)
+    inline std::string to_decimal_string(const BigUInt &x)
+    {
+        if (x.LimbCount() <= detail::kDivideAndConquerLimbs)
+            return to_decimal_string_naive(x);
+
+        // powers[k] = 10^(19 * 2^k)һֱ㵽 powers[K]^2 > x
+        std::vector<detail::DecimalPower> powers;
+        powers.push_back({BigUInt(detail::kChunk), BigUInt()});
+        for (;;)
+        {
+            BigUInt square = powers.back().value * powers.back().value;
+            if (square > x)
+                break;
+            powers.push_back({std::move(square), BigUInt()});
+        }
+        const std::size_t top = powers.size() - 1;
+        // ֻһΣݹֱдԼһΣƴַ
+        // ݹе̡˻ͽضϺĵʱ BigUIntÿ㶼
+        std::string buffer(detail::kChunkDigits << (top + 1), '0');
+        detail::ConvertRecursive(x, top, powers, &buffer[0]);
+        return detail::StripLeadingZeros(std::move(buffer));
+    }
+} // namespace bignum
@@ -1,38 +1,55 @@
 //쳲Ϊ
 
-#include<vector>
+// BigUInt (ÿ limb 64 ) 洢ʱתʮַһд
+// (n, F(n), F(n+1))  FibonacciCheckpoints.h ļļһβѯ (֮)  n ļ
+//Ҫдļÿβѯδ̵ݳ autoFlushBytes ʱԼ̣ϴ̳ kFlushInterval ʱ̣˳ǰһ
+//: g++ -O3 -std=c++20 -pthread Fibonacci.cpp -o Fibonacci
+//: ./Fibonacci [ļĬ fibonacci.ckpt]
+
 #include<iostream>
 #include<chrono>
-#include"High-precision_Adder.h"
+#include<string>
+#include"BigUInt.h"
+#include"FibonacciCheckpoints.h"
 using namespace std::chrono;
-int main()
+constexpr seconds kFlushInterval{30};
+int main(int argc, char **argv)
 {
-    int n;
+    long long n;
+    bignum::FibonacciCheckpoints cache(argc > 1 ? argv[1] : "fibonacci.ckpt");
+    auto lastFlush = steady_clock::now();
+    if (!cache.LoadError().empty())
+        std::cout << "ļ (" << cache.LoadError() << ")ӿջ濪ʼ" << std::endl;
+    std::cout << " " << cache.Count() << " " << std::endl;
     while(std::cout<<"n: ", std::cin>>n)
     {
-        if(n==0)
-            std::cout << "0Ϊ: 0" << std::endl;
-        if(n==1)
-            std::cout << "1Ϊ: 1" << std::endl;
-        std::vector<int> pre_1 = {1};
-        std::vector<int> pre_2 = {0};
-        std::vector<int> current;
-        auto start = high_resolution_clock::now();
-        for (int i = 0; i < n - 1;i++)
+        if(n<0)
         {
-            current = add(pre_1, pre_2);
-            pre_2 = pre_1;
-            pre_1 = current;
+            std::cout << "Ϊ" << std::endl;
+            continue;
         }
+        auto start = high_resolution_clock::now();
+        bignum::BigUInt current = cache.Get(static_cast<std::uint64_t>(n));
         auto stop = high_resolution_clock::now();
         auto duration = duration_cast<microseconds>(stop - start);
-        int len = current.size();
-        std::cout << "" << n << ": ";
-        for (int i = len - 1; i >= 0;i--)
+        if (steady_clock::now() - lastFlush >= kFlushInterval)
         {
-            std::cout << current[i] << (i == 0 ? "\n" : "");
+            cache.Flush(); //ǿйصʱඪ kFlushInterval ڵļ㣬ϵļʼ
+            lastFlush = steady_clock::now();
         }
+
+        //λ std::cout << current[i] ڼλʱȼ㱾תһ黺һ write
+        auto printStart = high_resolution_clock::now();
+        std::string digits = bignum::to_decimal_string(current);
+        std::cout << "" << n << ": ";
+        std::cout.write(digits.data(), digits.size()) << "\n";
+        auto printStop = high_resolution_clock::now();
         std::cout << "μʱ" << duration.count() << " us(΢)" << std::endl;
+        std::cout << "תʱ" << duration_cast<microseconds>(printStop - printStart).count() << " us(΢)" << std::endl;
     }
+    cache.Flush();
+    const bignum::CheckpointStats &stats = cache.Stats();
+    std::cout << "\nѯ " << stats.queries << " Σ " << stats.HitRate() * 100 << "% ( " << stats.exactHits
+              << " " << stats.resumed << ") " << cache.Count() << "  / " << cache.PayloadBytes() / 1024 << " KB" << std::endl;
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,458 @@
+/**
+ * @file FibonacciCheckpoints.h
+ * @brief 쳲Ĵ̼㻺棺 (n, F(n), F(n+1)) Խյ limb ʽһ mmap ļ
+ *        ѯ F(n) ʱ n ļ㣻 (LRU ̭)дļ"дʱļ + rename"֤ȫͳ
+ * @note Ҫ C++20 (FibonacciStream.h  fibonacci_pair)  POSIX (mmap / fsync / rename)
+ *       : g++ -O3 -std=c++20 -pthread Fibonacci.cpp -o Fibonacci
+ *
+ * Fibonacci.cpp αֻһЧ F(10^6) ֵôͷ㡣Ḷ̌
+ *   - ļ = 64 ֽļͷ +  n źĿ¼ (ÿ 48 ֽ) +  limb  (8 ֽڶ룬ȥǰ 0)
+ *   - ʱ mmap ļֻУļͷĿ¼ʱ䣻
+ *     ĳһαõʱУ (У)˾Ͷһ˻ظ͵ļ
+ *   - ѯ n ļ m벻Զʱ (ÿ interval ˳ִһ)
+ *     Զʱ F(m+d) = F(d)F(m+1) + F(d-1)F(m) һȥ (n, F(n), F(n+1)) Ҳ
+ *   - ¼ȷڴFlush ʱͬԱľɼһд path.tmpfsync  rename ԭļ
+ *     κʱ̱ҪôǾļҪôļ
+ *   - ÿδ¼ֽ maxBytes Ͱʹʱ̭ (ڴһ LRU 
+ *     ʹʱҲдĿ¼ؽLRU ˳򲻶)
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <list>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "BigUInt.h"
+#include "FibonacciStream.h"
+
+namespace bignum
+{
+    // ==========================================
+    // 1. ļ
+    // ==========================================
+    namespace checkpoint
+    {
+        inline constexpr std::array<char, 8> kMagic = {'F', 'I', 'B', 'C', 'K', 'P', 'T', '1'};
+        inline constexpr std::uint32_t kFormatVersion = 1;
+        inline constexpr std::uint32_t kEndianTag = 0x01020304;
+
+        struct FileHeader
+        {
+            std::array<char, 8> magic;
+            std::uint32_t formatVersion;
+            std::uint32_t endianTag;
+            std::uint64_t entryCount;
+            std::uint64_t clock;       // LRU ߼ʱ
+            std::uint64_t payloadBytes;
+            std::uint64_t directoryChecksum;
+            std::uint64_t reserved[2];
+        };
+        static_assert(sizeof(FileHeader) == 64 && std::is_trivially_copyable_v<FileHeader>);
+
+        // F(n)  limb  offset  F(n+1)  limb
+        struct Entry
+        {
+            std::uint64_t n;
+            std::uint64_t offset;
+            std::uint64_t limbs;     // F(n)  limb 
+            std::uint64_t nextLimbs; // F(n+1)  limb 
+            std::uint64_t lastUse;
+            std::uint64_t checksum;
+        };
+        static_assert(sizeof(Entry) == 48 && std::is_trivially_copyable_v<Entry>);
+
+        // ÿδһ limb
+        inline std::uint64_t Checksum(const Limb *data, std::size_t count, std::uint64_t h = 0x9E3779B97F4A7C15ULL)
+        {
+            h ^= count;
+            for (std::size_t i = 0; i < count; i++)
+            {
+                h = (h ^ data[i]) * 0xff51afd7ed558ccdULL;
+                h ^= h >> 32;
+            }
+            return h ^ (h >> 29);
+        }
+    } // namespace checkpoint
+
+    struct CheckpointOptions
+    {
+        std::uint64_t maxBytes = 256ull << 20;        //  (ļͷĿ¼)
+        std::uint64_t interval = 1024;                // ʱÿһ
+        std::uint64_t jumpThreshold = 2048;           // 㳬ôʱñʽһȥ
+        std::uint64_t autoFlushBytes = 16ull << 20;   // δ̵ݳôʱԶ Flush
+    };
+
+    struct CheckpointStats
+    {
+        std::uint64_t queries = 0;
+        std::uint64_t exactHits = 0;   //  n ļ
+        std::uint64_t resumed = 0;     // Ӹ͵ļ
+        std::uint64_t misses = 0;      // n ûм㣬 F(0) ʼ
+        std::uint64_t termsStepped = 0;
+        std::uint64_t jumps = 0;
+        std::uint64_t stored = 0;
+        std::uint64_t evicted = 0;
+        std::uint64_t corrupt = 0;     // УͲԶļ
+        std::uint64_t flushes = 0;
+
+        double HitRate() const { return queries == 0 ? 0.0 : static_cast<double>(exactHits + resumed) / static_cast<double>(queries); }
+    };
+
+    // ==========================================
+    // 2. FibonacciCheckpoints
+    // ==========================================
+    class FibonacciCheckpoints
+    {
+    public:
+        // ļھʹӿջ濪ʼļ (ļͷ/Ŀ¼Уʧ) Ҳӿջ濪ʼԭ LoadError()
+        explicit FibonacciCheckpoints(std::string path, CheckpointOptions options = {})
+            : m_Path(std::move(path)), m_Options(options)
+        {
+            Load();
+        }
+        FibonacciCheckpoints(const FibonacciCheckpoints &) = delete;
+        FibonacciCheckpoints &operator=(const FibonacciCheckpoints &) = delete;
+        // ʱ̣ʧҲ׳ (һļ)
+        ~FibonacciCheckpoints()
+        {
+            try
+            {
+                Flush();
+            }
+            catch (...)
+            {
+            }
+            Unmap();
+        }
+
+        // F(n)ļ
+        BigUInt Get(std::uint64_t n)
+        {
+            m_Stats.queries++;
+            std::uint64_t m = 0;
+            BigUInt a(0), b(1); // F(m), F(m+1)
+            if (auto found = Find(n))
+            {
+                m = found->first;
+                std::tie(a, b) = std::move(found->second);
+                (m == n ? m_Stats.exactHits : m_Stats.resumed)++;
+                if (m == n)
+                    return a;
+            }
+            else
+                m_Stats.misses++;
+
+            const std::uint64_t distance = n - m;
+            if (distance > m_Options.jumpThreshold)
+            {
+                // (p, q) = (F(d), F(d+1))F(m+d) = p*F(m+1) + (q-p)*F(m)F(m+d+1) = q*F(m+1) + p*F(m)
+                auto [p, q] = fibonacci_pair(distance);
+                BigUInt next = q * b + p * a;
+                a = p * b + (q - p) * a;
+                b = std::move(next);
+                m_Stats.jumps++;
+            }
+            else
+            {
+                for (std::uint64_t k = m; k < n; k++)
+                {
+                    a += b;
+                    std::swap(a, b);
+                    if ((k + 1) % m_Options.interval == 0 && k + 1 != n)
+                        Put(k + 1, a, b);
+                }
+                m_Stats.termsStepped += distance;
+            }
+            Put(n, a, b);
+            return a;
+        }
+
+        // n  ( n) ġУͨļ㣺(m, (F(m), F(m+1)))
+        std::optional<std::pair<std::uint64_t, std::pair<BigUInt, BigUInt>>> Find(std::uint64_t n)
+        {
+            auto it = m_Entries.upper_bound(n);
+            while (it != m_Entries.begin())
+            {
+                --it;
+                Slot &slot = it->second;
+                if (!slot.pending.empty() || Verify(slot))
+                {
+                    slot.entry.lastUse = ++m_Clock;
+                    m_Lru.splice(m_Lru.end(), m_Lru, slot.lru);
+                    const Limb *limbs = Limbs(slot);
+                    std::pair<BigUInt, BigUInt> terms{
+                        BigUInt::FromLimbs(std::vector<Limb>(limbs, limbs + slot.entry.limbs)),
+                        BigUInt::FromLimbs(std::vector<Limb>(limbs + slot.entry.limbs, limbs + slot.entry.limbs + slot.entry.nextLimbs))};
+                    return std::make_pair(it->first, std::move(terms));
+                }
+                m_Stats.corrupt++;
+                it = Erase(it);
+            }
+            return std::nullopt;
+        }
+
+        // һ (ֻڴFlush ʱ)̭ maxBytes ڣѴڻ򵥸ͳ maxBytes ʱ
+        void Put(std::uint64_t n, const BigUInt &fn, const BigUInt &fn1)
+        {
+            const std::uint64_t bytes = (fn.LimbCount() + fn1.LimbCount()) * sizeof(Limb);
+            if (m_Entries.count(n) != 0 || bytes > m_Options.maxBytes)
+                return;
+            Slot slot;
+            slot.entry = {n, 0, fn.LimbCount(), fn1.LimbCount(), ++m_Clock, 0};
+            slot.pending.reserve(fn.LimbCount() + fn1.LimbCount());
+            slot.pending.insert(slot.pending.end(), fn.Limbs().begin(), fn.Limbs().end());
+            slot.pending.insert(slot.pending.end(), fn1.Limbs().begin(), fn1.Limbs().end());
+            slot.entry.checksum = checkpoint::Checksum(slot.pending.data(), slot.pending.size());
+            auto it = m_Entries.emplace(n, std::move(slot)).first;
+            it->second.lru = m_Lru.insert(m_Lru.end(), n);
+            m_PayloadBytes += bytes;
+            m_PendingBytes += bytes;
+            m_Dirty = true;
+            m_Stats.stored++;
+            Evict(); // ¼ĩβ̭Լ
+            if (m_PendingBytes >= m_Options.autoFlushBytes)
+                Flush();
+        }
+
+        // ̭ maxBytes ڣȫ (ļд) д path.tmpfsync  rename ԭļ mmap
+        void Flush()
+        {
+            // ֻʹʱ˲ֵдļһݻ̭ʱһд
+            Evict();
+            if (!m_Dirty)
+                return;
+
+            std::vector<checkpoint::Entry> directory;
+            directory.reserve(m_Entries.size());
+            std::uint64_t offset = sizeof(checkpoint::FileHeader) + m_Entries.size() * sizeof(checkpoint::Entry);
+            for (auto &[n, slot] : m_Entries)
+            {
+                checkpoint::Entry e = slot.entry;
+                e.offset = offset;
+                offset += SlotBytes(slot);
+                directory.push_back(e);
+            }
+            checkpoint::FileHeader header{};
+            header.magic = checkpoint::kMagic;
+            header.formatVersion = checkpoint::kFormatVersion;
+            header.endianTag = checkpoint::kEndianTag;
+            header.entryCount = directory.size();
+            header.clock = m_Clock;
+            header.payloadBytes = m_PayloadBytes;
+            header.directoryChecksum = checkpoint::Checksum(reinterpret_cast<const Limb *>(directory.data()), directory.size() * sizeof(checkpoint::Entry) / sizeof(Limb));
+
+            const std::string tmp = m_Path + ".tmp";
+            const int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (fd < 0)
+                throw std::runtime_error("FibonacciCheckpoints: cannot create " + tmp);
+            bool ok = WriteAll(fd, &header, sizeof(header)) && WriteAll(fd, directory.data(), directory.size() * sizeof(checkpoint::Entry));
+            for (auto it = m_Entries.begin(); ok && it != m_Entries.end(); ++it)
+                ok = WriteAll(fd, Limbs(it->second), SlotBytes(it->second));
+            ok = ok && ::fsync(fd) == 0; // ̣rename ֮ſɼ
+            ok = ::close(fd) == 0 && ok;
+            if (!ok || std::rename(tmp.c_str(), m_Path.c_str()) != 0)
+            {
+                std::remove(tmp.c_str());
+                throw std::runtime_error("FibonacciCheckpoints: write failed: " + tmp + " (" + std::strerror(errno) + ")");
+            }
+            SyncDirectory();
+            m_Stats.flushes++;
+
+            // ӳļڴĴдݿͷ
+            Unmap();
+            Load();
+        }
+
+        const CheckpointStats &Stats() const { return m_Stats; }
+        std::size_t Count() const { return m_Entries.size(); }
+        std::uint64_t PayloadBytes() const { return m_PayloadBytes; }
+        const std::string &LoadError() const { return m_LoadError; }
+
+    private:
+        struct Slot
+        {
+            checkpoint::Entry entry{};
+            std::vector<Limb> pending; // ǿգụ̂գӳļ
+            bool verified = false;
+            std::list<std::uint64_t>::iterator lru; //  m_Lru λ
+        };
+
+        static std::uint64_t SlotBytes(const Slot &slot) { return (slot.entry.limbs + slot.entry.nextLimbs) * sizeof(Limb); }
+
+        const Limb *Limbs(const Slot &slot) const
+        {
+            if (!slot.pending.empty())
+                return slot.pending.data();
+            return reinterpret_cast<const Limb *>(m_Base + slot.entry.offset); // offset  8 ımmap ַҳ
+        }
+
+        bool Verify(Slot &slot)
+        {
+            if (!slot.verified)
+                slot.verified = checkpoint::Checksum(Limbs(slot), slot.entry.limbs + slot.entry.nextLimbs) == slot.entry.checksum;
+            return slot.verified;
+        }
+
+        // 򿪲УļͷĿ¼κⶼ˻ؿջ
+        void Load()
+        {
+            m_Entries.clear();
+            m_Lru.clear();
+            m_PayloadBytes = m_PendingBytes = 0;
+            m_Dirty = false;
+            m_LoadError.clear();
+            const int fd = ::open(m_Path.c_str(), O_RDONLY);
+            if (fd < 0)
+                return; // һ
+            struct stat st{};
+            if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(checkpoint::FileHeader))
+            {
+                ::close(fd);
+                m_LoadError = "file too small";
+                return;
+            }
+            m_Size = static_cast<std::size_t>(st.st_size);
+            void *p = ::mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (p == MAP_FAILED)
+            {
+                m_Size = 0;
+                m_LoadError = "mmap failed";
+                return;
+            }
+            m_Base = static_cast<const unsigned char *>(p);
+
+            checkpoint::FileHeader header;
+            std::memcpy(&header, m_Base, sizeof(header));
+            const std::uint64_t directoryEnd = sizeof(header) + header.entryCount * sizeof(checkpoint::Entry);
+            if (header.magic != checkpoint::kMagic || header.formatVersion != checkpoint::kFormatVersion || header.endianTag != checkpoint::kEndianTag)
+                m_LoadError = "not a checkpoint file (or different version / byte order)";
+            else if (header.entryCount > m_Size / sizeof(checkpoint::Entry) || directoryEnd > m_Size)
+                m_LoadError = "truncated directory";
+            else if (checkpoint::Checksum(reinterpret_cast<const Limb *>(m_Base + sizeof(header)), header.entryCount * sizeof(checkpoint::Entry) / sizeof(Limb)) != header.directoryChecksum)
+                m_LoadError = "directory checksum mismatch";
+            if (!m_LoadError.empty())
+            {
+                Unmap();
+                return;
+            }
+
+            for (std::uint64_t i = 0; i < header.entryCount; i++)
+            {
+                Slot slot;
+                std::memcpy(&slot.entry, m_Base + sizeof(header) + i * sizeof(checkpoint::Entry), sizeof(checkpoint::Entry));
+                const std::uint64_t bytes = SlotBytes(slot);
+                if (slot.entry.offset % sizeof(Limb) != 0 || slot.entry.offset < directoryEnd || slot.entry.offset > m_Size || bytes > m_Size - slot.entry.offset)
+                {
+                    m_Stats.corrupt++;
+                    continue;
+                }
+                m_PayloadBytes += bytes;
+                m_Entries.emplace(slot.entry.n, std::move(slot));
+            }
+            m_Clock = std::max(m_Clock, header.clock);
+
+            // Ŀ¼ʹʱһؽ LRU 
+            std::vector<std::pair<std::uint64_t, Slot *>> byUse;
+            byUse.reserve(m_Entries.size());
+            for (auto &[n, slot] : m_Entries)
+                byUse.emplace_back(slot.entry.lastUse, &slot);
+            std::sort(byUse.begin(), byUse.end(), [](const auto &x, const auto &y) { return x.first < y.first; });
+            for (auto &[lastUse, slot] : byUse)
+                slot->lru = m_Lru.insert(m_Lru.end(), slot->entry.n);
+        }
+
+        void Unmap()
+        {
+            if (m_Base)
+                ::munmap(const_cast<unsigned char *>(m_Base), m_Size);
+            m_Base = nullptr;
+            m_Size = 0;
+        }
+
+        using EntryIterator = std::map<std::uint64_t, Slot>::iterator;
+
+        // Ŀ¼ LRU һȥһ Flush дļ
+        EntryIterator Erase(EntryIterator it)
+        {
+            const std::uint64_t bytes = SlotBytes(it->second);
+            m_PayloadBytes -= bytes;
+            if (!it->second.pending.empty())
+                m_PendingBytes -= bytes;
+            m_Lru.erase(it->second.lru);
+            m_Dirty = true;
+            return m_Entries.erase(it);
+        }
+
+        // ûùߣͷǣÿ̭һ O(log n)
+        void Evict()
+        {
+            while (m_PayloadBytes > m_Options.maxBytes && !m_Lru.empty())
+            {
+                Erase(m_Entries.find(m_Lru.front()));
+                m_Stats.evicted++;
+            }
+        }
+
+        static bool WriteAll(int fd, const void *data, std::size_t size)
+        {
+            const char *p = static_cast<const char *>(data);
+            while (size > 0)
+            {
+                const ssize_t written = ::write(fd, p, size);
+                if (written < 0 && errno == EINTR)
+                    continue;
+                if (written <= 0)
+                    return false;
+                p += written;
+                size -= static_cast<std::size_t>(written);
+            }
+            return true;
+        }
+
+        // rename Ŀ¼޸ģҲҪ fsync Ŀ¼
+        void SyncDirectory() const
+        {
+            const std::size_t slash = m_Path.find_last_of('/');
+            const std::string dir = slash == std::string::npos ? "." : (slash == 0 ? "/" : m_Path.substr(0, slash));
+            const int fd = ::open(dir.c_str(), O_RDONLY);
+            if (fd >= 0)
+            {
+                ::fsync(fd);
+                ::close(fd);
+            }
+        }
+
+        std::string m_Path;
+        CheckpointOptions m_Options;
+        std::map<std::uint64_t, Slot> m_Entries; //  n upper_bound  n 
+        std::list<std::uint64_t> m_Lru;          //  nûõù
+        const unsigned char *m_Base = nullptr;
+        std::size_t m_Size = 0;
+        std::uint64_t m_PayloadBytes = 0;
+        std::uint64_t m_PendingBytes = 0;
+        bool m_Dirty = false; // Ŀ¼ϵļһ (¼ɾ˼)
+        std::uint64_t m_Clock = 0;
+        std::string m_LoadError;
+        CheckpointStats m_Stats;
+    };
+} // namespace bignum
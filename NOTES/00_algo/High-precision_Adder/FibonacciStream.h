@@ -0,0 +1,316 @@
+/**
+ * @file FibonacciStream.h
+ * @brief  C++20 Э̰쳲Generator<const BigUInt &>  co_yield ()
+ *        terms(a, b) 䣬terms_async ں̨̼߳㡢н罻 (ѹ) ̸߳ʽ
+ * @note Ҫ C++20 (Э)  BigUInt.hterms_async Ҫ -pthread
+ *       : g++ -O3 -std=c++20 -pthread Fibonacci.cpp -o Fibonacci
+ *
+ * Fibonacci.cpp ԭÿһ n  F(0) ¼ӵ F(n)""һͣļ㣺
+ *   - fibonacci() / terms(a, b)Эֻ֡ abÿ co_yield a ý÷
+ *     ָԭ a += b ٽвκһterms(a, b) ÿٱֱ F(a)
+ *   - FibonacciCursorʽѯõα꣬n ʱߣػúԶʱ¶λ
+ *   - terms_async߳ͬһÿһƽ̶Ĳ (۵ڴѭ)
+ *     ʱ (ѹ)̸߳ʽ/ k ͬʱѾ k+1 
+ * ãֻһ ++ ֮ǰЧҪԼһݡ
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "BigUInt.h"
+
+namespace bignum
+{
+    // ==========================================
+    // 1. Generator<Ref>С C++20  (C++23  std::generator)
+    // ==========================================
+    // Ref ͣpromise ֻ汻 co_yield ĵַ
+    template <typename Ref>
+    class Generator
+    {
+        static_assert(std::is_reference_v<Ref>, "Generator yields references; use Generator<const T &>");
+
+    public:
+        using value_type = std::remove_cvref_t<Ref>;
+
+        struct promise_type
+        {
+            std::add_pointer_t<Ref> m_Current = nullptr;
+            std::exception_ptr m_Exception;
+
+            Generator get_return_object() { return Generator(std::coroutine_handle<promise_type>::from_promise(*this)); }
+            std::suspend_always initial_suspend() noexcept { return {}; } // һ begin() ſʼ
+            std::suspend_always final_suspend() noexcept { return {}; }
+            // co_yield ʱ co_yield ʽҲЭָ̻֮󣬱ַǰȫ
+            std::suspend_always yield_value(Ref value) noexcept
+            {
+                m_Current = std::addressof(value);
+                return {};
+            }
+            void return_void() {}
+            void unhandled_exception() { m_Exception = std::current_exception(); }
+        };
+
+        class Iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = Generator::value_type;
+
+            explicit Iterator(std::coroutine_handle<promise_type> handle) : m_Handle(handle) {}
+            Ref operator*() const { return static_cast<Ref>(*m_Handle.promise().m_Current); }
+            Iterator &operator++()
+            {
+                Resume(m_Handle);
+                return *this;
+            }
+            void operator++(int) { ++*this; }
+            friend bool operator==(const Iterator &it, std::default_sentinel_t) { return it.m_Handle.done(); }
+
+        private:
+            std::coroutine_handle<promise_type> m_Handle;
+        };
+
+        Generator(Generator &&other) noexcept : m_Handle(std::exchange(other.m_Handle, nullptr)) {}
+        Generator &operator=(Generator &&other) noexcept
+        {
+            if (this != &other)
+            {
+                if (m_Handle)
+                    m_Handle.destroy();
+                m_Handle = std::exchange(other.m_Handle, nullptr);
+            }
+            return *this;
+        }
+        Generator(const Generator &) = delete;
+        Generator &operator=(const Generator &) = delete;
+        // ٹЭ֡еľֲ (terms_async һֹͣ߳)
+        ~Generator()
+        {
+            if (m_Handle)
+                m_Handle.destroy();
+        }
+
+        // ֻܱһ
+        Iterator begin()
+        {
+            Resume(m_Handle);
+            return Iterator(m_Handle);
+        }
+        std::default_sentinel_t end() const { return {}; }
+
+    private:
+        explicit Generator(std::coroutine_handle<promise_type> handle) : m_Handle(handle) {}
+
+        static void Resume(std::coroutine_handle<promise_type> handle)
+        {
+            handle.resume();
+            if (handle.promise().m_Exception)
+                std::rethrow_exception(std::exchange(handle.promise().m_Exception, nullptr));
+        }
+
+        std::coroutine_handle<promise_type> m_Handle;
+    };
+
+    // ==========================================
+    // 2. ͬУfibonacci() / terms(a, b)
+    // ==========================================
+    inline constexpr std::uint64_t kUnbounded = std::numeric_limits<std::uint64_t>::max();
+
+    // ٱF(2k) = F(k) * (2F(k+1) - F(k))F(2k+1) = F(k)^2 + F(k+1)^2 (F(n), F(n+1))
+    inline std::pair<BigUInt, BigUInt> fibonacci_pair(std::uint64_t n)
+    {
+        if (n == 0)
+            return {BigUInt(0), BigUInt(1)};
+        auto [a, b] = fibonacci_pair(n / 2);
+        BigUInt even = a * (b + b - a);
+        BigUInt odd = a * a + b * b;
+        if (n % 2 == 0)
+            return {std::move(even), std::move(odd)};
+        BigUInt next = even + odd;
+        return {std::move(odd), std::move(next)};
+    }
+
+    // F(first), F(first+1), ..., F(last-1)
+    inline Generator<const BigUInt &> terms(std::uint64_t first, std::uint64_t last = kUnbounded)
+    {
+        auto [a, b] = fibonacci_pair(first); // Эֻ֡
+        for (std::uint64_t k = first; k < last; k++)
+        {
+            co_yield a;
+            a += b; // a = F(k+2)ʱ vector ԭ
+            std::swap(a, b);
+        }
+    }
+
+    inline Generator<const BigUInt &> fibonacci() { return terms(0); }
+
+    // ==========================================
+    // 3. FibonacciCursorʽѯÿδͷ
+    // ==========================================
+    class FibonacciCursor
+    {
+    public:
+        // ǰ߳ôʱֱÿٱ¶λ
+        static constexpr std::uint64_t kJumpThreshold = 2048;
+
+        FibonacciCursor() : m_Terms(terms(0)), m_It(m_Terms.begin()) {}
+
+        const BigUInt &Seek(std::uint64_t n)
+        {
+            if (n < m_Index || n - m_Index > kJumpThreshold)
+            {
+                m_Terms = terms(n);
+                m_It = m_Terms.begin();
+                m_Index = n;
+            }
+            for (; m_Index < n; m_Index++)
+                ++m_It;
+            return *m_It;
+        }
+        std::uint64_t Index() const { return m_Index; }
+
+    private:
+        Generator<const BigUInt &> m_Terms; //  m_It ֮ǰ
+        Generator<const BigUInt &>::Iterator m_It;
+        std::uint64_t m_Index = 0;
+    };
+
+    // ==========================================
+    // 4. н罻̶Ĳɻߵȣߵ
+    // ==========================================
+    // Ķһֱ (BigUInt ֵḴ)Ԥ֮󽻽ӱٷڴ
+    template <typename T>
+    class BoundedHandoff
+    {
+    public:
+        explicit BoundedHandoff(std::size_t capacity) : m_Slots(capacity == 0 ? 1 : capacity) {}
+
+        // ߣȵпղۣѷʱ nullptr
+        T *BeginPush()
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_NotFull.wait(lock, [&] { return m_Tail - m_Head < m_Slots.size() || m_Cancelled; });
+            return m_Cancelled ? nullptr : &m_Slots[m_Tail % m_Slots.size()];
+        }
+        void EndPush()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_Tail++;
+            }
+            m_NotEmpty.notify_one();
+        }
+        // ߽ (쳣)
+        void Close()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_Closed = true;
+            }
+            m_NotEmpty.notify_one();
+        }
+
+        // ߣȵۣѽȫȡʱ nullptr
+        const T *BeginPop()
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_NotEmpty.wait(lock, [&] { return m_Head < m_Tail || m_Closed; });
+            return m_Head < m_Tail ? &m_Slots[m_Head % m_Slots.size()] : nullptr;
+        }
+        void EndPop()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_Head++;
+            }
+            m_NotFull.notify_one();
+        }
+        // ǰѿ BeginPush 
+        void Cancel()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_Cancelled = true;
+            }
+            m_NotFull.notify_one();
+        }
+
+        std::size_t Capacity() const { return m_Slots.size(); }
+
+    private:
+        std::vector<T> m_Slots;
+        std::mutex m_Mutex;
+        std::condition_variable m_NotFull, m_NotEmpty;
+        std::uint64_t m_Head = 0, m_Tail = 0; // ȡ / ѷ
+        bool m_Closed = false;
+        bool m_Cancelled = false;
+    };
+
+    // ==========================================
+    // 5. terms_async̨ + н罻ӣ÷һ
+    // ==========================================
+    namespace detail
+    {
+        //  (; break) ʱȡ߳
+        struct ProducerGuard
+        {
+            BoundedHandoff<BigUInt> &handoff;
+            std::thread &producer;
+            ~ProducerGuard()
+            {
+                handoff.Cancel();
+                if (producer.joinable())
+                    producer.join();
+            }
+        };
+    } // namespace detail
+
+    // capacity߶ (ҲǶⳣפ BigUInt )
+    inline Generator<const BigUInt &> terms_async(std::uint64_t first, std::uint64_t last = kUnbounded, std::size_t capacity = 4)
+    {
+        BoundedHandoff<BigUInt> handoff(capacity);
+        std::exception_ptr failure;
+        std::thread producer([&handoff, &failure, first, last]
+                             {
+            try
+            {
+                for (const BigUInt &term : terms(first, last))
+                {
+                    BigUInt *slot = handoff.BeginPush();
+                    if (!slot)
+                        break;
+                    *slot = term; // Ҫ㣬븴һ
+                    handoff.EndPush();
+                }
+            }
+            catch (...)
+            {
+                failure = std::current_exception();
+            }
+            handoff.Close(); });
+        detail::ProducerGuard guard{handoff, producer};
+
+        while (const BigUInt *term = handoff.BeginPop())
+        {
+            co_yield *term; // ڵ÷ꡢָЭ֮Ź黹
+            handoff.EndPop();
+        }
+        if (failure) // Close() ֮Ŷ֤˿ɼ
+            std::rethrow_exception(failure);
+    }
+} // namespace bignum
@@ -1,21 +1,13 @@
 #include"High-precision_Adder.h"
+#include"BigNat.h"
 #include<vector>
+//λʽӷǰֵĸֱڽϳǸԭۼӲأλ push_back
+//λѭ BigNat<10>  bignum::AddDigitsλ֮ 9 + 9 + 1 = 19һαȽϴ % 10  / 10
 std::vector<int> add(std::vector<int> s1,std::vector<int> s2)
 {
-    int len1 = s1.size();
-    int len2 = s2.size();
-    std::vector<int> res;
-    int t = 0;
-    for (int i = 0; i < len1 || i < len2;i++)
-    {
-        if(i<len1)
-            t += s1[i];
-        if(i<len2)
-            t += s2[i];
-        res.push_back(t % 10);
-        t /= 10;
-    }
-    if(t)
-        res.push_back(t);
-    return res;
-}
+    if (s1.size() < s2.size())
+        s1.swap(s2);
+    if (bignum::AddDigits<10>(s1.data(), s1.size(), s2.data(), s2.size()))
+        s1.push_back(1);
+    return s1;
+}
\ No newline at end of file
@@ -0,0 +1,159 @@
+/**
+ * @file bignat_benchmark.cpp
+ * @brief ԭλ add() / binary_add() vs BigNat<Base>10  (쳲)  2  (ƴ)ֱȶ
+ * @note : g++ -O3 -std=c++17 bignat_benchmark.cpp High-precision_Adder.cpp ../binary_add/function.cpp -o bignat_benchmark
+ *       : ./bignat_benchmark
+ */
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BigNat.h"
+#include "BigUInt.h"
+#include "High-precision_Adder.h"
+#include "../binary_add/header.h"
+#include "../../23_Benchmarking/Timer.h"
+
+// ==========================================
+// 1. 飺عǰѭ (ֻ 10  2)
+// ==========================================
+std::vector<int> LegacyAdd(std::vector<int> s1, std::vector<int> s2)
+{
+    int len1 = s1.size();
+    int len2 = s2.size();
+    std::vector<int> res;
+    int t = 0;
+    for (int i = 0; i < len1 || i < len2; i++)
+    {
+        if (i < len1)
+            t += s1[i];
+        if (i < len2)
+            t += s2[i];
+        res.push_back(t % 10);
+        t /= 10;
+    }
+    if (t)
+        res.push_back(t);
+    return res;
+}
+
+std::vector<int> LegacyBinaryAdd(const std::vector<int> &v1, const std::vector<int> &v2)
+{
+    int len1 = v1.size();
+    int len2 = v2.size();
+    std::vector<int> res;
+    int t = 0;
+    for (int i = 0; i < len1 || i < len2; i++)
+    {
+        if (i < len1)
+            t += v1[i];
+        if (i < len2)
+            t += v2[i];
+        res.push_back(t % 2);
+        t /= 2;
+    }
+    if (t)
+        res.push_back(t);
+    return res;
+}
+
+std::string DigitsToString(const std::vector<int> &digits)
+{
+    std::string out;
+    out.reserve(digits.size());
+    for (std::size_t i = digits.size(); i-- > 0;)
+        out += static_cast<char>('0' + digits[i]);
+    return out;
+}
+
+// ==========================================
+// 2. 10 ƣFibonacci.cpp ѭ F(n)ʵʮƴһ
+// ==========================================
+template <typename Number, typename AddFn, typename ToStringFn>
+std::string FibonacciWith(const char *name, int n, Number pre_1, Number pre_2, AddFn addFn, ToStringFn toString)
+{
+    Timer timer(name, static_cast<std::size_t>(n));
+    Number current = pre_1;
+    for (int i = 0; i < n - 1; i++)
+    {
+        current = addFn(pre_1, pre_2);
+        pre_2 = pre_1;
+        pre_1 = current;
+    }
+    return toString(current);
+}
+
+void DecimalBenchmark(int n)
+{
+    std::cout << "-- F(" << n << ") --" << std::endl;
+    using Dec = bignum::BigNat<10>;
+    using Dec18 = bignum::BigNat<1000000000000000000ULL>;
+    auto plus = [](const auto &a, const auto &b) { return a + b; };
+
+    std::string expected = FibonacciWith("legacy add() loop (% 10 per digit)", n, std::vector<int>{1}, std::vector<int>{0}, LegacyAdd, DigitsToString);
+    std::string viaAdd = FibonacciWith("add() on AddDigits<10> (same API)", n, std::vector<int>{1}, std::vector<int>{0}, add, DigitsToString);
+    std::string dec = FibonacciWith("BigNat<10>", n, Dec(1), Dec(0), plus, [](const Dec &x) { return x.ToString<10>(); });
+    std::string dec18 = FibonacciWith("BigNat<10^18>", n, Dec18(1), Dec18(0), plus, [](const Dec18 &x) { return x.ToString<10>(); });
+    std::string binary = FibonacciWith("BigUInt (2^64 limbs) + to_decimal_string", n, bignum::BigUInt(1), bignum::BigUInt(0), plus,
+                                       [](const bignum::BigUInt &x) { return bignum::to_decimal_string(x); });
+    bool same = viaAdd == expected && dec == expected && dec18 == expected && binary == expected;
+    std::cout << "  " << expected.size() << " digits, outputs " << (same ? "identical" : "DIFFER") << std::endl;
+}
+
+// ==========================================
+// 3. 2 ƣbinary_add/main.cpp  (ַ ->  -> ַ)
+// ==========================================
+void BinaryBenchmark(std::size_t bits)
+{
+    std::cout << "-- " << bits << "-bit operands --" << std::endl;
+    std::mt19937_64 rng(bits);
+    std::string s1(bits, '0'), s2(bits - bits / 3, '0');
+    for (char &c : s1)
+        c = static_cast<char>('0' + (rng() & 1));
+    for (char &c : s2)
+        c = static_cast<char>('0' + (rng() & 1));
+    s1[0] = '1';
+
+    std::string expected, viaBinaryAdd, packed;
+    {
+        Timer timer("legacy: str_to_vec + binary loop (% 2) + print", bits);
+        expected = DigitsToString(LegacyBinaryAdd(str_to_vec(s1), str_to_vec(s2)));
+    }
+    {
+        Timer timer("binary_add() on AddDigits<2> (same API)", bits);
+        viaBinaryAdd = DigitsToString(binary_add(str_to_vec(s1), str_to_vec(s2)));
+    }
+    using Binary = bignum::BigNat<(std::uint64_t{1} << 63)>;
+    {
+        Timer timer("BigNat<2^63>: FromString + add + ToString", bits);
+        packed = (Binary::FromString<2>(s1) + Binary::FromString<2>(s2)).ToString<2>();
+    }
+    // ֻӷ
+    Binary a = Binary::FromString<2>(s1), b = Binary::FromString<2>(s2);
+    std::vector<int> v1 = str_to_vec(s1), v2 = str_to_vec(s2);
+    {
+        Timer timer("  add only: legacy binary loop", bits);
+        DoNotOptimize(LegacyBinaryAdd(v1, v2));
+    }
+    {
+        Timer timer("  add only: BigNat<2^63>", bits);
+        DoNotOptimize(a + b);
+    }
+    bool same = viaBinaryAdd == expected && packed == expected;
+    std::cout << "  outputs " << (same ? "identical" : "DIFFER") << std::endl;
+}
+
+int main()
+{
+    std::cout << "=== 1. Decimal: Fibonacci loop (Run in Release Mode! -O3) ===" << std::endl;
+    for (int n : {10000, 50000})
+        DecimalBenchmark(n);
+
+    std::cout << "\n=== 2. Binary: add two bit strings ===" << std::endl;
+    for (std::size_t bits = 10000; bits <= 10000000; bits *= 10)
+        BinaryBenchmark(bits);
+    return 0;
+}
@@ -0,0 +1,247 @@
+/**
+ * @file fibonacci_checkpoint_benchmark.cpp
+ * @brief 쳲ѯļ㻺棺ԭÿδͷѭ vs ÿοٱ vs α vs ̼ (FibonacciCheckpoints)
+ *        ͳʡ̭ļСԼ"" mmap 򿪵ĺʱԼ츲ʱļ
+ * @note : g++ -O3 -std=c++20 -pthread fibonacci_checkpoint_benchmark.cpp -o fibonacci_checkpoint_benchmark
+ *       : ./fibonacci_checkpoint_benchmark [ѯĬ 2000] [ʱĿ¼Ĭ /tmp]
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BigUInt.h"
+#include "FibonacciCheckpoints.h"
+#include "FibonacciStream.h"
+#include "../../23_Benchmarking/Timer.h"
+
+using bignum::BigUInt;
+
+// ԭ Fibonacci.cpp ѭ壺ÿζ F(0), F(1) ʼ
+BigUInt LegacyFibonacci(std::uint64_t n)
+{
+    if (n < 2)
+        return BigUInt(n);
+    BigUInt pre_1 = 1;
+    BigUInt pre_2 = 0;
+    BigUInt current;
+    for (std::uint64_t i = 0; i < n - 1; i++)
+    {
+        current = pre_1 + pre_2;
+        pre_2 = std::move(pre_1);
+        pre_1 = current;
+    }
+    return current;
+}
+
+std::uint64_t FileSize(const std::string &path)
+{
+    std::ifstream f(path, std::ios::ate | std::ios::binary);
+    return f ? static_cast<std::uint64_t>(f.tellg()) : 0;
+}
+
+void PrintStats(const bignum::FibonacciCheckpoints &cache, const std::string &path)
+{
+    const bignum::CheckpointStats &s = cache.Stats();
+    std::cout << "    hit rate " << s.HitRate() * 100 << "% (exact " << s.exactHits << ", resumed " << s.resumed << ", miss " << s.misses
+              << "), stepped " << s.termsStepped << " terms, jumps " << s.jumps << ", stored " << s.stored << ", evicted " << s.evicted
+              << ", flushes " << s.flushes << ", file " << FileSize(path) / 1024 << " KB" << std::endl;
+}
+
+// ==========================================
+// 1. Լ죺ȷڡ𻵱֡ʱļӰ졢̭ס
+// ==========================================
+bool SelfCheck(const std::string &dir)
+{
+    const std::string path = dir + "/fib_selfcheck.ckpt";
+    std::remove(path.c_str());
+    bool ok = true;
+    std::mt19937_64 rng(5);
+    std::vector<std::uint64_t> ns;
+    for (int i = 0; i < 150; i++)
+        ns.push_back(i % 4 == 0 ? rng() % 100 : rng() % 60000);
+    bignum::CheckpointOptions small;
+    small.maxBytes = 64 * 1024;
+    {
+        bignum::FibonacciCheckpoints cache(path, small);
+        for (std::uint64_t n : ns)
+        {
+            ok &= cache.Get(n) == bignum::fibonacci_pair(n).first;
+            ok &= cache.PayloadBytes() <= small.maxBytes; // ʱ̭ Flush
+        }
+        cache.Flush();
+        ok &= cache.PayloadBytes() <= small.maxBytes && cache.Stats().evicted > 0;
+    }
+    {
+        bignum::FibonacciCheckpoints reopened(path, small); // ""
+        ok &= reopened.LoadError().empty() && reopened.Count() > 0;
+        for (std::uint64_t n : ns)
+            ok &= reopened.Get(n) == bignum::fibonacci_pair(n).first;
+        ok &= reopened.Stats().exactHits > 0;
+    }
+
+    // дһֻһȱ .tmpԭļӰ
+    {
+        std::ofstream(path + ".tmp", std::ios::binary) << "half-written garbage";
+        bignum::FibonacciCheckpoints cache(path, small);
+        ok &= cache.LoadError().empty() && cache.Count() > 0;
+    }
+
+    // תһֽڣӦڵһʹʱֲȻȷ
+    {
+        const std::uint64_t size = FileSize(path);
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekg(static_cast<std::streamoff>(size - 9));
+        const char c = static_cast<char>(f.get());
+        f.seekp(static_cast<std::streamoff>(size - 9));
+        f.put(static_cast<char>(c ^ 0x5a));
+    }
+    {
+        // תһ (n ļ) n һУ鵽ûϾͱ̭
+        bignum::FibonacciCheckpoints cache(path, small);
+        const std::uint64_t top = *std::max_element(ns.begin(), ns.end());
+        ok &= cache.Get(top) == bignum::fibonacci_pair(top).first;
+        for (std::uint64_t n : ns)
+            ok &= cache.Get(n) == bignum::fibonacci_pair(n).first;
+        ok &= cache.Stats().corrupt == 1;
+    }
+
+    // ļضϣĿ¼Уʧܣ˻ؿջ
+    {
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << "FIBCKPT1 truncated";
+        bignum::FibonacciCheckpoints cache(path, small);
+        ok &= !cache.LoadError().empty() && cache.Count() == 0 && cache.Get(777) == LegacyFibonacci(777);
+    }
+    std::remove(path.c_str());
+    std::remove((path + ".tmp").c_str());
+    return ok;
+}
+
+// ==========================================
+// 2. ĳ F(999999)  F(10^6)Ȼ""
+// ==========================================
+void NeighbourQueries(const std::string &dir)
+{
+    std::cout << "\n=== 2. F(999999) then F(1000000) (Run in Release Mode! -O3) ===" << std::endl;
+    const std::string path = dir + "/fib_neighbour.ckpt";
+    std::remove(path.c_str());
+    BigUInt legacy, cached;
+    {
+        Timer timer("legacy loop: F(999999) + F(1000000), both from scratch", 2);
+        DoNotOptimize(LegacyFibonacci(999999));
+        legacy = LegacyFibonacci(1000000);
+    }
+    {
+        bignum::FibonacciCheckpoints cache(path);
+        {
+            Timer timer("checkpoints: F(999999) (miss -> fast doubling)");
+            DoNotOptimize(cache.Get(999999));
+        }
+        {
+            Timer timer("checkpoints: F(1000000) (resume from 999999, one addition)");
+            cached = cache.Get(1000000);
+        }
+        Timer timer("checkpoints: Flush (write tmp + fsync + rename)");
+        cache.Flush();
+    }
+    {
+        Timer timer("restart: open + mmap + validate directory");
+        bignum::FibonacciCheckpoints cache(path);
+        DoNotOptimize(cache.Count());
+    }
+    {
+        bignum::FibonacciCheckpoints cache(path);
+        BigUInt again;
+        {
+            Timer timer("restart: F(1000000) (exact hit, copy limbs out of the mapping)");
+            again = cache.Get(1000000);
+        }
+        {
+            Timer timer("restart: F(1000500) (resume, 500 additions)");
+            DoNotOptimize(cache.Get(1000500));
+        }
+        std::cout << "  results " << (legacy == cached && cached == again ? "identical" : "DIFFER") << ", file " << FileSize(path) / 1024 << " KB" << std::endl;
+    }
+    std::remove(path.c_str());
+}
+
+// ==========================================
+// 3. ѯ70% ڼȵ㸽ߣ30% ͬĻ
+// ==========================================
+std::vector<std::uint64_t> MakeWorkload(std::size_t count, std::uint64_t maxN, unsigned seed)
+{
+    std::mt19937_64 rng(seed);
+    std::uint64_t hot[4] = {maxN / 10, maxN / 3, maxN / 2, maxN * 9 / 10};
+    std::vector<std::uint64_t> ns(count);
+    for (std::uint64_t &n : ns)
+    {
+        if (rng() % 10 < 7)
+        {
+            std::uint64_t &h = hot[rng() % 4];
+            h = std::min(maxN - 1, h + rng() % 64); // ȵǰ
+            n = h - rng() % 32;
+        }
+        else
+            n = rng() % maxN;
+    }
+    return ns;
+}
+
+void Workload(std::size_t count, const std::string &dir)
+{
+    const std::uint64_t maxN = 300000;
+    const std::vector<std::uint64_t> ns = MakeWorkload(count, maxN, 9);
+    std::cout << "\n=== 3. " << count << " queries, n < " << maxN << " (70% near 4 drifting hot spots) ===" << std::endl;
+
+    std::vector<BigUInt> reference;
+    {
+        Timer timer("no cache: fibonacci_pair(n) per query", count);
+        for (std::uint64_t n : ns)
+            reference.push_back(bignum::fibonacci_pair(n).first);
+    }
+    bool same = true;
+    {
+        Timer timer("in-process FibonacciCursor (lost on restart)", count);
+        bignum::FibonacciCursor cursor;
+        for (std::size_t i = 0; i < ns.size(); i++)
+            same &= cursor.Seek(ns[i]) == reference[i];
+    }
+    for (std::uint64_t maxBytes : {1ull << 20, 8ull << 20, 64ull << 20})
+    {
+        const std::string path = dir + "/fib_workload.ckpt";
+        std::remove(path.c_str());
+        bignum::CheckpointOptions options;
+        options.maxBytes = maxBytes;
+        for (int run = 0; run < 2; run++) // ڶģطͬһѯ
+        {
+            std::string name = "checkpoints, max " + std::to_string(maxBytes >> 20) + " MB, " + (run == 0 ? "cold file" : "after restart");
+            bignum::FibonacciCheckpoints cache(path, options);
+            {
+                Timer timer(name.c_str(), count);
+                for (std::size_t i = 0; i < ns.size(); i++)
+                    same &= cache.Get(ns[i]) == reference[i];
+                cache.Flush();
+            }
+            PrintStats(cache, path);
+        }
+        std::remove(path.c_str());
+    }
+    std::cout << "  results " << (same ? "identical" : "DIFFER") << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000;
+    const std::string dir = argc > 2 ? argv[2] : "/tmp";
+    std::cout << "=== 1. Self-check ===" << std::endl;
+    std::cout << "  " << (SelfCheck(dir) ? "results, restart, torn write, bit flip, truncation, eviction all OK" : "FAILED") << std::endl;
+    NeighbourQueries(dir);
+    Workload(count, dir);
+    return 0;
+}
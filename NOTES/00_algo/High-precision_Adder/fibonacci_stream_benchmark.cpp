@@ -0,0 +1,194 @@
+/**
+ * @file fibonacci_stream_benchmark.cpp
+ * @brief 쳲еĲʽԭÿδͷѭ vs Э terms() vs ̨ + н罻 terms_async()
+ *        ͳÿֵڴ棬⽻ʽѯ (ԭѭ vs FibonacciCursor)
+ * @note : g++ -O3 -std=c++20 -pthread fibonacci_stream_benchmark.cpp -o fibonacci_stream_benchmark
+ *       : ./fibonacci_stream_benchmark [Ĭ 30000]
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BigUInt.h"
+#include "FibonacciStream.h"
+#include "../../23_Benchmarking/CountingAllocator.h"
+#include "../../23_Benchmarking/Timer.h"
+
+using bignum::BigUInt;
+
+// ʱ + ӡÿֵڴ (ԽʱĴڴ)
+template <typename Fn>
+void Measure(const char *name, std::size_t terms, Fn fn)
+{
+    const std::size_t base = ResetPeakBytes();
+    double us;
+    {
+        Timer timer(name, terms);
+        fn();
+        us = timer.Stop();
+    }
+    std::cout << "    " << static_cast<std::uint64_t>(terms / (us * 1e-6)) << " terms/s, peak extra heap "
+              << (g_PeakBytes.load() - base) / 1024 << " KB" << std::endl;
+}
+
+// ԭ Fibonacci.cpp ѭ壺ÿζ F(0), F(1) ʼ
+BigUInt LegacyFibonacci(std::uint64_t n)
+{
+    if (n < 2)
+        return BigUInt(n);
+    BigUInt pre_1 = 1;
+    BigUInt pre_2 = 0;
+    BigUInt current;
+    for (std::uint64_t i = 0; i < n - 1; i++)
+    {
+        current = pre_1 + pre_2;
+        pre_2 = std::move(pre_1);
+        pre_1 = current;
+    }
+    return current;
+}
+
+// ʽ + һ ( Fibonacci.cpp ͬתʮƣһ write)
+void WriteTerm(std::FILE *out, std::uint64_t n, const BigUInt &term)
+{
+    std::string line = std::to_string(n) + ": " + bignum::to_decimal_string(term) + "\n";
+    std::fwrite(line.data(), 1, line.size(), out);
+}
+
+// ==========================================
+// 1. Լ
+// ==========================================
+bool SelfCheck()
+{
+    bool ok = true;
+    // ͬٱһ£
+    std::uint64_t k = 0;
+    for (const BigUInt &term : bignum::fibonacci())
+    {
+        if (k % 97 == 0)
+            ok &= term == bignum::fibonacci_pair(k).first;
+        if (++k == 3000)
+            break;
+    }
+    for (std::uint64_t first : {0, 1, 2, 500, 2047})
+    {
+        k = first;
+        for (const BigUInt &term : bignum::terms(first, first + 300))
+            ok &= term == LegacyFibonacci(k++);
+        ok &= k == first + 300;
+    }
+
+    // 첽汾ͬ汾ͬ 1 (ÿҪ) ; break (Ľ)
+    for (std::size_t capacity : {1, 3, 16})
+    {
+        std::vector<BigUInt> sync, async;
+        for (const BigUInt &term : bignum::terms(100, 2100))
+            sync.push_back(term);
+        for (const BigUInt &term : bignum::terms_async(100, 2100, capacity))
+            async.push_back(term);
+        ok &= sync == async;
+        int seen = 0;
+        for (const BigUInt &term : bignum::terms_async(0, bignum::kUnbounded, capacity))
+        {
+            ok &= term == LegacyFibonacci(static_cast<std::uint64_t>(seen));
+            if (++seen == 50)
+                break;
+        }
+    }
+
+    // α꣺ǰߡԶ
+    bignum::FibonacciCursor cursor;
+    std::mt19937 rng(3);
+    for (int q = 0; q < 200; q++)
+    {
+        std::uint64_t n = q % 3 == 0 ? rng() % 20000 : cursor.Index() + rng() % 64;
+        ok &= cursor.Seek(n) == bignum::fibonacci_pair(n).first && cursor.Index() == n;
+    }
+    return ok;
+}
+
+// ==========================================
+// 2.  F(0) ~ F(count-1)  /dev/null
+// ==========================================
+void StreamBenchmark(std::uint64_t count, bool withLegacy)
+{
+    std::cout << "-- print F(0) .. F(" << count - 1 << ") to /dev/null --" << std::endl;
+    std::FILE *out = std::fopen("/dev/null", "wb");
+    if (withLegacy)
+        Measure("legacy loop: recompute F(n) from scratch for every n", count, [&]
+                {
+            for (std::uint64_t n = 0; n < count; n++)
+                WriteTerm(out, n, LegacyFibonacci(n)); });
+    Measure("generator: for (const BigUInt &t : terms(0, count))", count, [&]
+            {
+        std::uint64_t n = 0;
+        for (const BigUInt &term : bignum::terms(0, count))
+            WriteTerm(out, n++, term); });
+    for (std::size_t capacity : {1, 4, 64})
+    {
+        std::string name = "terms_async (capacity " + std::to_string(capacity) + ")";
+        Measure(name.c_str(), count, [&]
+                {
+            std::uint64_t n = 0;
+            for (const BigUInt &term : bignum::terms_async(0, count, capacity))
+                WriteTerm(out, n++, term); });
+    }
+    // ֻ㲻Ŀ
+    Measure("generator only (no formatting)", count, [&]
+            {
+        std::size_t limbs = 0;
+        for (const BigUInt &term : bignum::terms(0, count))
+            limbs += term.LimbCount();
+        DoNotOptimize(limbs); });
+    std::fclose(out);
+}
+
+// ==========================================
+// 3. ʽѯһ n (ż)ֻ㲻
+// ==========================================
+void QueryBenchmark(std::size_t queries, std::uint64_t maxN)
+{
+    std::vector<std::uint64_t> ns(queries);
+    std::mt19937 rng(11);
+    for (std::uint64_t &n : ns)
+        n = rng() % maxN;
+    std::sort(ns.begin(), ns.end());
+    for (std::size_t i = 9; i < ns.size(); i += 10) // ÿ 10 βѯһ
+        ns[i] = ns[i] / 2;
+
+    std::cout << "-- " << queries << " queries, n < " << maxN << " (ascending, every 10th goes back to n/2) --" << std::endl;
+    std::vector<BigUInt> legacy, cursorResults;
+    Measure("legacy loop per query", queries, [&]
+            {
+        for (std::uint64_t n : ns)
+            legacy.push_back(LegacyFibonacci(n)); });
+    Measure("FibonacciCursor::Seek", queries, [&]
+            {
+        bignum::FibonacciCursor cursor;
+        for (std::uint64_t n : ns)
+            cursorResults.push_back(cursor.Seek(n)); });
+    std::cout << "  results " << (legacy == cursorResults ? "identical" : "DIFFER") << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    const std::uint64_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 30000;
+    std::cout << "=== 1. Self-check ===" << std::endl;
+    std::cout << "  " << (SelfCheck() ? "generator / terms / terms_async / cursor all match" : "MISMATCH") << std::endl;
+
+    std::cout << "\n=== 2. Streaming terms (Run in Release Mode! -O3) ===" << std::endl;
+    StreamBenchmark(std::min<std::uint64_t>(count, 5000), true);
+    if (count > 5000)
+        StreamBenchmark(count, false); // ԭѭ O(n^2) μӷģ
+
+    std::cout << "\n=== 3. Interactive queries ===" << std::endl;
+    QueryBenchmark(200, 50000);
+    return 0;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file to_decimal_benchmark.cpp
+ * @brief תʮƣ O(n^2) vs  to_decimal_stringλ cout vs һ writeΪ 10^4 ~ 10^7 λ쳲
+ * @note : g++ -O3 -std=c++17 to_decimal_benchmark.cpp High-precision_Adder.cpp -o to_decimal_benchmark
+ *       : ./to_decimal_benchmark [λĬ 10000000]
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "BigUInt.h"
+#include "High-precision_Adder.h"
+#include "../../23_Benchmarking/Timer.h"
+
+using bignum::BigUInt;
+
+// ==========================================
+// 1. ٱ F(n)F(2k) = F(k) * (2F(k+1) - F(k))F(2k+1) = F(k)^2 + F(k+1)^2
+// ==========================================
+std::pair<BigUInt, BigUInt> FibonacciPair(std::uint64_t n) //  (F(n), F(n+1))
+{
+    if (n == 0)
+        return {BigUInt(0), BigUInt(1)};
+    auto [a, b] = FibonacciPair(n / 2);
+    BigUInt even = a * (b + b - a);
+    BigUInt odd = a * a + b * b;
+    if (n % 2 == 0)
+        return {std::move(even), std::move(odd)};
+    BigUInt next = even + odd;
+    return {std::move(odd), std::move(next)};
+}
+
+// ==========================================
+// 2. ȷԣνؽԭʮ add() һ
+// ==========================================
+bool SelfCheck()
+{
+    bool ok = true;
+    std::mt19937_64 rng(7);
+    for (int t = 0; t < 60; t++)
+    {
+        std::vector<bignum::Limb> limbs(1 + rng() % 4000); //  1000  limb ʱ߷
+        for (bignum::Limb &limb : limbs)
+            limb = t % 5 == 0 ? ~bignum::Limb{0} : rng(); // ÿ 5 һȫ 1ǽλ/λı߽
+        BigUInt x = BigUInt::FromLimbs(limbs);
+        ok = ok && bignum::to_decimal_string(x) == bignum::to_decimal_string_naive(x);
+    }
+
+    // 10^k  10^k - 1ڷεзֵ
+    BigUInt power(1);
+    for (int k = 1; k <= 20000 && ok; k++)
+    {
+        power = power * BigUInt(10);
+        if (k % 997 == 0)
+        {
+            std::string expected = "1" + std::string(static_cast<std::size_t>(k), '0');
+            ok = ok && bignum::to_decimal_string(power) == expected &&
+                 bignum::to_decimal_string(power - BigUInt(1)) == std::string(static_cast<std::size_t>(k), '9');
+        }
+    }
+
+    //  High-precision_Adder.cpp ʮλӷ F(5000)
+    std::vector<int> pre_1 = {1}, pre_2 = {0}, current;
+    for (int i = 0; i < 5000 - 1; i++)
+    {
+        current = add(pre_1, pre_2);
+        pre_2 = pre_1;
+        pre_1 = current;
+    }
+    std::string decimal;
+    for (auto it = current.rbegin(); it != current.rend(); ++it)
+        decimal += static_cast<char>('0' + *it);
+    ok = ok && bignum::to_decimal_string(FibonacciPair(5000).first) == decimal;
+    return ok;
+}
+
+// ==========================================
+// 3. ׼
+// ==========================================
+int main(int argc, char **argv)
+{
+    const std::size_t maxDigits = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+
+    std::cout << "=== 1. Self-check (divide-and-conquer vs naive vs decimal add()): " << (SelfCheck() ? "OK" : "FAILED") << " ===" << std::endl;
+
+    std::ofstream sink("/dev/null"); //  /dev/nullֻʽд뱾
+    std::cout << "\n=== 2. F(n) to decimal (Run in Release Mode! -O3) ===" << std::endl;
+    for (std::size_t digits = 10000; digits <= maxDigits; digits *= 10)
+    {
+        // F(n) Լ n * log10(phi) = n * 0.20899 λ
+        const std::uint64_t n = static_cast<std::uint64_t>(std::ceil(digits / 0.20898764024997873));
+        BigUInt fib;
+        std::cout << "-- F(" << n << "), ~" << digits << " digits --" << std::endl;
+        {
+            Timer timer("compute F(n) (fast doubling)");
+            fib = FibonacciPair(n).first;
+        }
+
+        std::string text;
+        {
+            Timer timer("to_decimal_string (divide & conquer)", digits);
+            text = bignum::to_decimal_string(fib);
+        }
+        if (digits <= 1000000)
+        {
+            std::string naive;
+            {
+                Timer timer("to_decimal_string_naive (O(n^2))", digits);
+                naive = bignum::to_decimal_string_naive(fib);
+            }
+            if (naive != text)
+                std::cout << "  MISMATCH" << std::endl;
+        }
+        else
+        {
+            std::cout << "[to_decimal_string_naive (O(n^2))] skipped" << std::endl;
+        }
+
+        // ԭʽÿʮλһ intλ operator<<
+        std::vector<int> decimalDigits(text.rbegin(), text.rend());
+        for (int &d : decimalDigits)
+            d -= '0';
+        {
+            Timer timer("print digit by digit (cout << current[i])", digits);
+            for (std::size_t i = decimalDigits.size(); i-- > 0;)
+                sink << decimalDigits[i];
+            sink << "\n";
+            sink.flush();
+        }
+        {
+            Timer timer("print whole buffer (one write)", digits);
+            sink.write(text.data(), static_cast<std::streamsize>(text.size()));
+            sink << "\n";
+            sink.flush();
+        }
+    }
+    return 0;
+}
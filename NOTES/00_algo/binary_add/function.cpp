@@ -1,28 +1,21 @@
 #include<vector>
+#include<algorithm>
 #include"header.h"
+#include"../High-precision_Adder/BigNat.h"
 #include<iostream>
 
-//λӷ
+//λӷ壺ƽϳ룬 bignum::AddDigits<2> ԭؼϽ϶̵ (λ + 룬 add() ͬһں)
+//ԭλѭһ£ٺͽϳһ (ǰ 0 )
 std::vector<int> binary_add(const std::vector<int> &v1, 
                             const std::vector<int> &v2)
 {
-    int len1 = v1.size();
-    int len2 = v2.size();
+    const std::vector<int> &longer = v1.size() >= v2.size() ? v1 : v2;
+    const std::vector<int> &shorter = v1.size() >= v2.size() ? v2 : v1;
     std::vector<int> res;
-    int t = 0;
-    for (int i = 0; i < len1 || i < len2;i++)
-    {
-        if(i<len1)
-            t += v1[i];
-        if(i<len2)
-            t += v2[i];
-        res.push_back(t % 2);
-        t /= 2;
-    }
-    if(t)
-    {
-        res.push_back(t);
-    }
+    res.reserve(longer.size() + 1);
+    res.assign(longer.begin(), longer.end());
+    if (bignum::AddDigits<2>(res.data(), res.size(), shorter.data(), shorter.size()))
+        res.push_back(1);
     return res;
 }
 
@@ -1,5 +1,9 @@
 #include<iostream>
 #include"header.h"
+#include"../High-precision_Adder/BigNat.h"
+#include<algorithm>
+#include<cstdint>
+#include<stdexcept>
 #include<vector>
 #include<string>
 int main()
@@ -8,16 +12,23 @@ int main()
     std::cout << "ַ" << std::endl;
     std::cin >> s1;
     std::cin >> s2;
-    std::vector<int> v1 = str_to_vec(s1);   //stringתvector
-    std::vector<int> v2 = str_to_vec(s2);
-    //üӷ
-    std::vector<int> res = binary_add(v1, v2);
-    //
-    int len = res.size();
-    for (int i = len-1; i >= 0;i--)
+    //ÿִ 63  (BigNat<2^63>)һμӷ 63 λλ binary_add
+    using Binary = bignum::BigNat<(std::uint64_t{1} << 63)>;
+    std::string res;
+    try
+    {
+        res = (Binary::FromString<2>(s1) + Binary::FromString<2>(s2)).ToString<2>();
+    }
+    catch (const std::invalid_argument &)
     {
-        std::cout << res[i];
+        std::cout << "ĲǶַ" << std::endl;
+        return 1;
     }
-    std::cout << std::endl;
+    //ԭλӷһ£ٺͽϳһ (ǰ 0 )
+    std::size_t width = std::max(s1.size(), s2.size());
+    if (res.size() < width)
+        res.insert(0, width - res.size(), '0');
+    //
+    std::cout << res << std::endl;
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,60 @@
+/**
+ * @file Casting.h
+ * @brief LLVM  isa<> / cast<> / dyn_cast<>ͱǩ (Kind)  RTTI ת
+ * @note Ҫÿת͵ṩ static bool classof(const Base *)
+ *
+ * dynamic_cast Ҫ RTTI ļ̳ͼĿͣĳЩ ABI ҪȽַ
+ * ǣһö Kind Kind ̳йϵų䣬
+ * classof ֻҪһȽϣת O(1) ģҲҪ RTTI (-fno-rtti Ҳ)
+ */
+
+#pragma once
+
+#include <cassert>
+#include <type_traits>
+
+// isa<T>(p)p ָĶǲ T ( T )
+template <typename To, typename From>
+inline bool isa(const From *ptr)
+{
+    assert(ptr && "isa<> ָܿ");
+    if constexpr (std::is_base_of_v<To, From>)
+        return true; // תԶھȷ
+    else
+        return To::classof(ptr);
+}
+
+// cast<T>(p)ȷȷDebug  assert 飬Release µȼ static_cast
+template <typename To, typename From>
+inline To *cast(From *ptr)
+{
+    assert(isa<To>(ptr) && "cast<> ĿͲƥ");
+    return static_cast<To *>(ptr);
+}
+
+template <typename To, typename From>
+inline const To *cast(const From *ptr)
+{
+    assert(isa<To>(ptr) && "cast<> ĿͲƥ");
+    return static_cast<const To *>(ptr);
+}
+
+// dyn_cast<T>(p)ƥ䷵ T*򷵻 nullptr (dynamic_cast Ʒ)
+template <typename To, typename From>
+inline To *dyn_cast(From *ptr)
+{
+    return isa<To>(ptr) ? static_cast<To *>(ptr) : nullptr;
+}
+
+template <typename To, typename From>
+inline const To *dyn_cast(const From *ptr)
+{
+    return isa<To>(ptr) ? static_cast<const To *>(ptr) : nullptr;
+}
+
+// dyn_cast_or_null<T>(p)ָ
+template <typename To, typename From>
+inline To *dyn_cast_or_null(From *ptr)
+{
+    return (ptr && isa<To>(ptr)) ? static_cast<To *>(ptr) : nullptr;
+}
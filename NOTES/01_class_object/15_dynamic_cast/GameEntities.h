@@ -0,0 +1,221 @@
+/**
+ * @file GameEntities.h
+ * @brief ͱǩ Entity ̳ϵ + ͷͰʵע (EntityRegistry)
+ * @note Ҫ C++17 Casting.h  isa<> / dyn_cast<> ʹ
+ *
+ * ̳йϵ ( dynamic_cast.md Ӹ RTTI ҵĴ)
+ *
+ *   Entity
+ *    Player
+ *       Hero
+ *    Enemy
+ *        Boss
+ *
+ * Kind йһռһö [First, Last]
+ *  "ǲ Enemy ()" ͱ kind >= Enemy && kind <= LastEnemy
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Casting.h"
+
+// 06_operators/StructLayout.h ĲֱҪȡ˽гԱƫֻԪǸ (Ҫ C++20 ) ͷļ
+namespace layout
+{
+    template <typename T>
+    struct Fields;
+}
+
+// ==========================================
+// 1. ͱǩ (Type Tag)
+// ==========================================
+enum class EntityKind : unsigned char
+{
+    Entity,
+    Player,
+    Hero,
+    LastPlayer = Hero,
+    Enemy,
+    Boss,
+    LastEnemy = Boss,
+};
+
+// ==========================================
+// 2. νṹ
+// ==========================================
+// Ȼ麯update() Ҫ̬ͬʱҲ dynamic_cast Ա
+class Entity
+{
+    template <typename>
+    friend struct ::layout::Fields;
+
+public:
+    Entity(std::string n) : Entity(EntityKind::Entity, std::move(n)) {}
+    virtual ~Entity() {}
+
+    virtual void update() {}
+
+    EntityKind getKind() const { return kind; }
+    const std::string &getName() const { return name; }
+
+    static bool classof(const Entity *) { return true; }
+
+protected:
+    // ͨ캯дԼ Kind
+    Entity(EntityKind k, std::string n) : name(std::move(n)), kind(k) {}
+
+    std::string name;
+
+private:
+    const EntityKind kind;
+};
+
+class Player : public Entity
+{
+    template <typename>
+    friend struct ::layout::Fields;
+
+public:
+    Player(std::string n, int lvl) : Player(EntityKind::Player, std::move(n), lvl) {}
+
+    int castSpell() const { return level * 10; } // ˺ֵ demo Ĵӡ
+    int getLevel() const { return level; }
+
+    static bool classof(const Entity *e)
+    {
+        return e->getKind() >= EntityKind::Player && e->getKind() <= EntityKind::LastPlayer;
+    }
+
+protected:
+    Player(EntityKind k, std::string n, int lvl) : Entity(k, std::move(n)), level(lvl) {}
+
+    int level;
+};
+
+class Hero final : public Player
+{
+public:
+    Hero(std::string n, int lvl, int g) : Player(EntityKind::Hero, std::move(n), lvl), glory(g) {}
+
+    int getGlory() const { return glory; }
+
+    static bool classof(const Entity *e) { return e->getKind() == EntityKind::Hero; }
+
+private:
+    int glory;
+};
+
+class Enemy : public Entity
+{
+public:
+    Enemy(std::string n, int t = 1) : Enemy(EntityKind::Enemy, std::move(n), t) {}
+
+    int roar() const { return threat; } // вֵ demo Ĵӡ
+    int getThreat() const { return threat; }
+
+    static bool classof(const Entity *e)
+    {
+        return e->getKind() >= EntityKind::Enemy && e->getKind() <= EntityKind::LastEnemy;
+    }
+
+protected:
+    Enemy(EntityKind k, std::string n, int t) : Entity(k, std::move(n)), threat(t) {}
+
+    int threat;
+};
+
+class Boss final : public Enemy
+{
+public:
+    Boss(std::string n, int t, int p) : Enemy(EntityKind::Boss, std::move(n), t), phase(p) {}
+
+    int getPhase() const { return phase; }
+
+    static bool classof(const Entity *e) { return e->getKind() == EntityKind::Boss; }
+
+private:
+    int phase;
+};
+
+// ==========================================
+// 3. ʹ dyn_cast  processGameEntity ( dynamic_cast.md İ汾)
+// ==========================================
+inline void processGameEntity(Entity *e)
+{
+    if (!e)
+        return;
+
+    e->update();
+
+    if (Player *p = dyn_cast<Player>(e))
+        std::cout << "[Type Check] It's a Player. Spell damage: " << p->castSpell() << std::endl;
+    else if (Enemy *enemy = dyn_cast<Enemy>(e))
+        std::cout << "[Type Check] It's an Enemy. Threat: " << enemy->roar() << std::endl;
+    else
+        std::cout << "[Type Check] Unknown Entity type." << std::endl;
+}
+
+// ==========================================
+// 4. ͷͰע (Bucketed Registry)
+// ==========================================
+// ÿһ std::vectorֵš
+// " Enemy" = α Enemy Ͱ Boss ͰÿͰڶڴ棬Ҫκжϡ
+// ע⣺ std::vector һadd() ܵԪصĵַʧЧҪڱԪָ롣
+class EntityRegistry
+{
+private:
+    std::tuple<std::vector<Entity>, std::vector<Player>, std::vector<Hero>,
+               std::vector<Enemy>, std::vector<Boss>>
+        m_Buckets;
+
+public:
+    template <typename T, typename... Args>
+    T &add(Args &&...args)
+    {
+        return bucket<T>().emplace_back(std::forward<Args>(args)...);
+    }
+
+    template <typename T>
+    void reserve(std::size_t n) { bucket<T>().reserve(n); }
+
+    // ֱӷĳ͵Ͱ ()
+    template <typename T>
+    std::vector<T> &bucket() { return std::get<std::vector<T>>(m_Buckets); }
+
+    template <typename T>
+    const std::vector<T> &bucket() const { return std::get<std::vector<T>>(m_Buckets); }
+
+    // " T"Ķ ( T )func յǾ͵
+    // ЩͰڱھ;ˣÿͰľ Uֻ U  T ʱչѭ
+    template <typename T, typename Func>
+    void forEach(Func &&func)
+    {
+        std::apply([&](auto &...buckets)
+                   { (visitBucketIf<T>(buckets, func), ...); },
+                   m_Buckets);
+    }
+
+    std::size_t size() const
+    {
+        return std::apply([](const auto &...buckets)
+                          { return (buckets.size() + ...); },
+                          m_Buckets);
+    }
+
+private:
+    template <typename T, typename U, typename Func>
+    static void visitBucketIf(std::vector<U> &items, Func &func)
+    {
+        if constexpr (std::is_base_of_v<T, U>)
+            for (U &item : items)
+                func(item);
+    }
+};
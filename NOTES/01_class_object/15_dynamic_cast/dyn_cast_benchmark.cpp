@@ -0,0 +1,121 @@
+/**
+ * @file dyn_cast_benchmark.cpp
+ * @brief dynamic_cast vs ͱǩ dyn_cast<> vs Ͱע 100 ʵϵתͿ
+ * @note : g++ -O3 -std=c++17 dyn_cast_benchmark.cpp -o dyn_cast_benchmark
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "GameEntities.h"
+#include "../../23_Benchmarking/Timer.h"
+
+constexpr std::size_t kEntities = 1000000;
+constexpr int kFrames = 10;
+
+int main()
+{
+    std::cout << "=== 1. processGameEntity with dyn_cast<> ===" << std::endl;
+    {
+        Player hero("Hero_01", 99);
+        Boss dragon("Dragon", 50, 3);
+        Entity rock("Stone_Rock");
+        processGameEntity(&hero);
+        processGameEntity(&dragon); // Boss Ҳ Enemy
+        processGameEntity(&rock);
+        std::cout << "isa<Enemy>(&dragon) = " << isa<Enemy>(&dragon)
+                  << ", isa<Hero>(&hero) = " << isa<Hero>(&hero) << std::endl;
+    }
+
+    // ==========================================
+    // 2. һϡʵб
+    // ==========================================
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> pick(0, 4);
+
+    std::vector<std::unique_ptr<Entity>> owned;
+    EntityRegistry registry;
+    owned.reserve(kEntities);
+    for (std::size_t i = 0; i < kEntities; i++)
+    {
+        int level = static_cast<int>(i % 100);
+        switch (pick(rng))
+        {
+        case 0:
+            owned.push_back(std::make_unique<Entity>("Rock"));
+            registry.add<Entity>("Rock");
+            break;
+        case 1:
+            owned.push_back(std::make_unique<Player>("Player", level));
+            registry.add<Player>("Player", level);
+            break;
+        case 2:
+            owned.push_back(std::make_unique<Hero>("Hero", level, 7));
+            registry.add<Hero>("Hero", level, 7);
+            break;
+        case 3:
+            owned.push_back(std::make_unique<Enemy>("Goblin", level));
+            registry.add<Enemy>("Goblin", level);
+            break;
+        default:
+            owned.push_back(std::make_unique<Boss>("Dragon", level, 3));
+            registry.add<Boss>("Dragon", level, 3);
+            break;
+        }
+    }
+    std::vector<Entity *> entities;
+    entities.reserve(kEntities);
+    for (auto &e : owned)
+        entities.push_back(e.get());
+
+    // ==========================================
+    // 3. ׼ԣÿ֡ Player ķ˺ Enemy вֵ
+    // ==========================================
+    std::cout << "\n=== 2. Benchmark (" << kEntities << " entities x " << kFrames << " frames) ===" << std::endl;
+    for (int pass = 0; pass < 2; pass++)
+    {
+        long long a = 0, b = 0, c = 0;
+        {
+            Timer timer("dynamic_cast", kEntities * kFrames);
+            for (int f = 0; f < kFrames; f++)
+                for (Entity *e : entities)
+                {
+                    if (Player *p = dynamic_cast<Player *>(e))
+                        a += p->castSpell();
+                    else if (Enemy *en = dynamic_cast<Enemy *>(e))
+                        a += en->roar();
+                }
+            timer.Stop();
+            DoNotOptimize(a);
+        }
+        {
+            Timer timer("dyn_cast<> (type tag)", kEntities * kFrames);
+            for (int f = 0; f < kFrames; f++)
+                for (Entity *e : entities)
+                {
+                    if (Player *p = dyn_cast<Player>(e))
+                        b += p->castSpell();
+                    else if (Enemy *en = dyn_cast<Enemy>(e))
+                        b += en->roar();
+                }
+            timer.Stop();
+            DoNotOptimize(b);
+        }
+        {
+            Timer timer("EntityRegistry buckets", kEntities * kFrames);
+            for (int f = 0; f < kFrames; f++)
+            {
+                registry.forEach<Player>([&](const auto &p) { c += p.castSpell(); });
+                registry.forEach<Enemy>([&](const auto &en) { c += en.roar(); });
+            }
+            timer.Stop();
+            DoNotOptimize(c);
+        }
+        std::cout << "Results match: " << ((a == b && b == c) ? "yes" : "NO") << " (" << a << ")" << std::endl;
+        std::cout << "--------------------------------" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,271 @@
+/**
+ * @file Inventory.h
+ * @brief Ʒ Inventory ϵͳSlot Map 洢 +  (Generational Handle) + פ (String Interning)
+ * @note Ҫ C++17 (std::string_view)
+ *
+ * demo.cpp е InventoryItem ÿζѷ (std::string name  SSO ʱ + new int)
+ * ҪһָתûԶ忽/ƶ delete ͬһ int (double free)
+ * Inventory "д洢"
+ *   -  ID һ std::vectorƷٵڴ
+ *   - פֻͬһݣÿƷֻ 4 ֽڵ NameId
+ *   - ⲿõ ItemHandle {λ, }ƷɾλĴ +1ɾԶʧЧ (ָ)
+ *   - ɾʱһƷᵽλ (swap and pop)ʼսգֻɨڴ
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace inventory
+{
+    using NameId = std::uint32_t;
+
+    // ==========================================
+    // 1. פ (String Interning)
+    // ==========================================
+    // ÿַڶϣvector ֻᶯָ룬ַ string_view һֱЧ
+    //  std::dequelibstdc++  deque ƶҪµĿ쳣NameTable û noexcept ƶ
+    class NameTable
+    {
+    private:
+        std::vector<std::unique_ptr<std::string>> m_Names;
+        std::unordered_map<std::string_view, NameId> m_Index;
+
+        void CopyNames(const NameTable &other)
+        {
+            m_Names.clear();
+            m_Names.reserve(other.m_Names.size());
+            for (const std::unique_ptr<std::string> &name : other.m_Names)
+                m_Names.push_back(std::make_unique<std::string>(*name));
+        }
+
+        void RebuildIndex()
+        {
+            m_Index.clear();
+            m_Index.reserve(m_Names.size());
+            for (std::size_t i = 0; i < m_Names.size(); i++)
+                m_Index.emplace(*m_Names[i], static_cast<NameId>(i));
+        }
+
+    public:
+        NameTable() = default;
+
+        // ָ"Լ"ַöԷ string_view
+        NameTable(const NameTable &other)
+        {
+            CopyNames(other);
+            RebuildIndex();
+        }
+        NameTable &operator=(const NameTable &other)
+        {
+            if (this != &other)
+            {
+                CopyNames(other);
+                RebuildIndex();
+            }
+            return *this;
+        }
+        // ƶֻתָ룬ַЧԱƶ쳣 ( static_assert)
+        NameTable(NameTable &&) = default;
+        NameTable &operator=(NameTable &&) = default;
+
+        NameId Intern(std::string_view name)
+        {
+            auto it = m_Index.find(name);
+            if (it != m_Index.end())
+                return it->second;
+            NameId id = static_cast<NameId>(m_Names.size());
+            m_Names.push_back(std::make_unique<std::string>(name));
+            m_Index.emplace(*m_Names.back(), id);
+            return id;
+        }
+
+        std::string_view Get(NameId id) const { return *m_Names[id]; }
+        std::size_t Size() const { return m_Names.size(); }
+    };
+    // Inventory  noexcept ƶһ㣺ƶ쳣 ( std::deque) ʱʧ
+    static_assert(std::is_nothrow_move_constructible_v<NameTable> && std::is_nothrow_move_assignable_v<NameTable>);
+
+    // ==========================================
+    // 2.  (Generational Handle)
+    // ==========================================
+    struct ItemHandle
+    {
+        std::uint32_t slot = UINT32_MAX;
+        std::uint32_t generation = 0;
+
+        bool operator==(const ItemHandle &other) const { return slot == other.slot && generation == other.generation; }
+        bool operator!=(const ItemHandle &other) const { return !(*this == other); }
+    };
+
+    // ==========================================
+    // 3. InventorySlot Map + д洢
+    // ==========================================
+    class Inventory
+    {
+    private:
+        static constexpr std::uint32_t kNoSlot = UINT32_MAX;
+
+        // λ -> е±ꣻλƶвλ
+        struct Slot
+        {
+            std::uint32_t dense = kNoSlot; // ʱΪ±꣬ʱΪһвλ
+            std::uint32_t generation = 0;
+            bool alive = false;
+        };
+
+        std::vector<Slot> m_Slots;
+        std::uint32_t m_FreeHead = kNoSlot;
+
+        // յ (±һһӦ)
+        std::vector<int> m_Quantities;
+        std::vector<NameId> m_NameIds;
+        std::vector<std::uint32_t> m_Owners; // 飺± -> λɾʱ
+
+        NameTable m_Names;
+
+        const Slot *Resolve(ItemHandle handle) const
+        {
+            if (handle.slot >= m_Slots.size())
+                return nullptr;
+            const Slot &slot = m_Slots[handle.slot];
+            return slot.alive && slot.generation == handle.generation ? &slot : nullptr;
+        }
+
+        std::uint32_t DenseIndexOrThrow(ItemHandle handle) const
+        {
+            const Slot *slot = Resolve(handle);
+            if (slot == nullptr)
+                throw std::out_of_range("Inventory: stale or invalid ItemHandle");
+            return slot->dense;
+        }
+
+    public:
+        Inventory() = default;
+        // гԱֵĬϵĿ/ƶȷ ( InventoryItem ָȨ)
+        Inventory(const Inventory &) = default;
+        Inventory &operator=(const Inventory &) = default;
+        Inventory(Inventory &&) noexcept = default;
+        Inventory &operator=(Inventory &&) noexcept = default;
+
+        void Reserve(std::size_t count)
+        {
+            m_Slots.reserve(count);
+            m_Quantities.reserve(count);
+            m_NameIds.reserve(count);
+            m_Owners.reserve(count);
+        }
+
+        ItemHandle Add(std::string_view name, int quantity)
+        {
+            std::uint32_t slotIndex;
+            if (m_FreeHead != kNoSlot)
+            {
+                slotIndex = m_FreeHead;
+                m_FreeHead = m_Slots[slotIndex].dense;
+            }
+            else
+            {
+                slotIndex = static_cast<std::uint32_t>(m_Slots.size());
+                m_Slots.emplace_back();
+            }
+
+            Slot &slot = m_Slots[slotIndex];
+            slot.dense = static_cast<std::uint32_t>(m_Quantities.size());
+            slot.alive = true;
+
+            m_Quantities.push_back(quantity);
+            m_NameIds.push_back(m_Names.Intern(name));
+            m_Owners.push_back(slotIndex);
+            return {slotIndex, slot.generation};
+        }
+
+        // ɾɹ trueʧЧ false
+        bool Remove(ItemHandle handle)
+        {
+            if (Resolve(handle) == nullptr)
+                return false;
+            Slot &slot = m_Slots[handle.slot];
+            std::uint32_t hole = slot.dense;
+            std::uint32_t last = static_cast<std::uint32_t>(m_Quantities.size() - 1);
+
+            // swap and popһƷλĲλ
+            if (hole != last)
+            {
+                m_Quantities[hole] = m_Quantities[last];
+                m_NameIds[hole] = m_NameIds[last];
+                m_Owners[hole] = m_Owners[last];
+                m_Slots[m_Owners[hole]].dense = hole;
+            }
+            m_Quantities.pop_back();
+            m_NameIds.pop_back();
+            m_Owners.pop_back();
+
+            slot.alive = false;
+            slot.generation++; // оɾʧЧ
+            slot.dense = m_FreeHead;
+            m_FreeHead = handle.slot;
+            return true;
+        }
+
+        bool Contains(ItemHandle handle) const { return Resolve(handle) != nullptr; }
+
+        // ʧЧʱ nullptr
+        int *FindQuantity(ItemHandle handle)
+        {
+            const Slot *slot = Resolve(handle);
+            return slot ? &m_Quantities[slot->dense] : nullptr;
+        }
+
+        // ʧЧʱ׳ std::out_of_range
+        int Quantity(ItemHandle handle) const { return m_Quantities[DenseIndexOrThrow(handle)]; }
+        void SetQuantity(ItemHandle handle, int quantity) { m_Quantities[DenseIndexOrThrow(handle)] = quantity; }
+        void AddQuantity(ItemHandle handle, int delta) { m_Quantities[DenseIndexOrThrow(handle)] += delta; }
+        std::string_view Name(ItemHandle handle) const { return m_Names.Get(m_NameIds[DenseIndexOrThrow(handle)]); }
+
+        // ֱɨ ()
+        long long TotalQuantity() const
+        {
+            long long total = 0;
+            for (int q : m_Quantities)
+                total += q;
+            return total;
+        }
+
+        // f(std::string_view name, int &quantity)˳򲻱֤˳һ
+        template <typename F>
+        void ForEach(F &&f)
+        {
+            for (std::size_t i = 0; i < m_Quantities.size(); i++)
+                f(m_Names.Get(m_NameIds[i]), m_Quantities[i]);
+        }
+
+        void Clear()
+        {
+            // дλ +1 ŻؿɾȫʧЧ
+            for (std::uint32_t owner : m_Owners)
+            {
+                Slot &slot = m_Slots[owner];
+                slot.alive = false;
+                slot.generation++;
+                slot.dense = m_FreeHead;
+                m_FreeHead = owner;
+            }
+            m_Quantities.clear();
+            m_NameIds.clear();
+            m_Owners.clear();
+        }
+
+        std::size_t Size() const { return m_Quantities.size(); }
+        bool Empty() const { return m_Quantities.empty(); }
+        std::size_t DistinctNames() const { return m_Names.Size(); }
+    };
+} // namespace inventory
@@ -12,6 +12,8 @@ class InventoryItem
 private:
     std::string name;
     int *quantityPtr; // ʹָʾ̬ڴ
+    // ע⣺ûԶ忽/ֵ delete ͬһڴ (Rule of Three)
+    // Ҫ洢Ʒʱ Inventory.h
 
 public:
     // ==========================================
@@ -0,0 +1,157 @@
+/**
+ * @file inventory_benchmark.cpp
+ * @brief demo.cpp  InventoryItem (string + new int) vs Inventory (Slot Map + д洢 + פ)װء¡
+ * @note : g++ -O3 -std=c++17 inventory_benchmark.cpp -o inventory_benchmark
+ *       : ./inventory_benchmark [ƷĬ 10000000]
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Inventory.h"
+#include "../../23_Benchmarking/Timer.h"
+
+// ==========================================
+// 1. ԭ InventoryItem (ȥ˴ӡ)
+// ==========================================
+//  demo.cpp ͬname һη (Ƴ SSO )quantityPtr һη䡣
+// עûԶ忽죺vector ʱǳָ룬ɶ¶ quantityPtr ա
+// ֻ reserve   Ȿԭ"ûп/ƶȫ"Ĵ
+class InventoryItem
+{
+private:
+    std::string name;
+    int *quantityPtr;
+
+public:
+    InventoryItem(std::string n, int q) : name(std::move(n)), quantityPtr(new int(q)) {}
+    ~InventoryItem() { delete quantityPtr; }
+
+    void addQuantity(int delta) { *quantityPtr += delta; }
+    int getQuantity() const { return *quantityPtr; }
+    const std::string &getName() const { return name; }
+};
+
+// ==========================================
+// 2. ݣ1000 Ʒ ( 15 ֽڣ SSO)
+// ==========================================
+std::vector<std::string> MakeCatalogue()
+{
+    const char *kinds[] = {"Potion of Healing", "Golden Sword of Dawn", "Iron Shield (Rusty)", "Scroll of Teleport"};
+    std::vector<std::string> names;
+    for (int i = 0; i < 1000; i++)
+        names.push_back(std::string(kinds[i % 4]) + " #" + std::to_string(i));
+    return names;
+}
+
+void DemoHandles()
+{
+    std::cout << "=== 1. Generational handles ===" << std::endl;
+    inventory::Inventory bag;
+    inventory::ItemHandle apple = bag.Add("Apple", 10);
+    inventory::ItemHandle sword = bag.Add("Golden Sword", 1);
+    bag.AddQuantity(apple, 5);
+    std::cout << "  " << bag.Name(apple) << " x" << bag.Quantity(apple) << ", " << bag.Name(sword) << " x"
+              << bag.Quantity(sword) << std::endl;
+
+    bag.Remove(apple);
+    inventory::ItemHandle potion = bag.Add("Potion", 3); //  apple Ĳλͬ
+    std::cout << "  potion reuses slot " << potion.slot << " (apple had slot " << apple.slot
+              << "), old apple handle valid: " << std::boolalpha << bag.Contains(apple) << std::endl;
+    try
+    {
+        bag.Quantity(apple);
+    }
+    catch (const std::out_of_range &e)
+    {
+        std::cout << "  Quantity(apple) -> " << e.what() << std::endl;
+    }
+
+    // Ӱ (ԭ InventoryItem  double free)
+    inventory::Inventory copy = bag;
+    copy.SetQuantity(sword, 99);
+    inventory::Inventory moved = std::move(copy);
+    std::cout << "  original sword x" << bag.Quantity(sword) << ", moved copy sword x" << moved.Quantity(sword)
+              << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    const std::vector<std::string> catalogue = MakeCatalogue();
+
+    DemoHandles();
+
+    std::cout << "\n=== 2. " << count << " items (Run in Release Mode! -O3) ===" << std::endl;
+    long long legacyTotal = 0, slabTotal = 0;
+    {
+        std::cout << "-- InventoryItem (std::string + new int) --" << std::endl;
+        auto *items = new std::vector<InventoryItem>();
+        {
+            Timer timer("load", count);
+            items->reserve(count);
+            for (std::size_t i = 0; i < count; i++)
+                items->emplace_back(catalogue[i % catalogue.size()], static_cast<int>(i % 100));
+        }
+        {
+            Timer timer("update (+1 each)", count);
+            for (InventoryItem &item : *items)
+                item.addQuantity(1);
+        }
+        {
+            Timer timer("sum quantities", count);
+            for (const InventoryItem &item : *items)
+                legacyTotal += item.getQuantity();
+            DoNotOptimize(legacyTotal);
+        }
+        {
+            Timer timer("destroy", count);
+            delete items;
+        }
+    }
+    {
+        std::cout << "-- Inventory (slot map + columns + interned names) --" << std::endl;
+        auto *bag = new inventory::Inventory();
+        std::vector<inventory::ItemHandle> handles;
+        {
+            Timer timer("load", count);
+            bag->Reserve(count);
+            handles.reserve(count);
+            for (std::size_t i = 0; i < count; i++)
+                handles.push_back(bag->Add(catalogue[i % catalogue.size()], static_cast<int>(i % 100)));
+        }
+        {
+            Timer timer("update (+1 via handle)", count);
+            for (inventory::ItemHandle h : handles)
+                bag->AddQuantity(h, 1);
+        }
+        {
+            Timer timer("update (+1 via ForEach)", count);
+            bag->ForEach([](std::string_view, int &q) { q += 1; });
+        }
+        {
+            Timer timer("sum quantities", count);
+            slabTotal = bag->TotalQuantity() - static_cast<long long>(count); // ۵ ForEach ӵ 1
+            DoNotOptimize(slabTotal);
+        }
+        std::cout << "  distinct names stored: " << bag->DistinctNames() << std::endl;
+        {
+            Timer timer("remove every other item", count / 2);
+            for (std::size_t i = 0; i < count; i += 2)
+                bag->Remove(handles[i]);
+        }
+        std::cout << "  after removal: " << bag->Size() << " items, stale handle valid: " << std::boolalpha
+                  << bag->Contains(handles[0]) << ", live handle valid: " << bag->Contains(handles[1]) << std::endl;
+        {
+            Timer timer("destroy", count);
+            delete bag;
+        }
+    }
+    std::cout << "\nchecksum legacy " << legacyTotal << " vs inventory " << slabTotal
+              << (legacyTotal == slabTotal ? " (match)" : " (MISMATCH)") << std::endl;
+    return 0;
+}
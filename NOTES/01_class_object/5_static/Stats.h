@@ -0,0 +1,260 @@
+/**
+ * @file Stats.h
+ * @brief ߳µͳʩƬ ShardedCounterGaugeͰֱͼ HistogramԼ CRTP ʵ Counted<T>
+ * @note Ҫ C++17 (inline static Ա)
+ *
+ * demo.cpp е User::userCount ͨ static int
+ *   - ߳ͬʱ/ User ʱuserCount++ "--д"ᶪʧ (ݾδΪ)
+ *   -  std::atomic<int> ȷ̶߳ͬһУ߳ԽԽ
+ * ShardedCounter ׼ɸжļۣÿ̶߳ռһ (ԭӼӷֻԼĻϣû)
+ * ȡʱٰвۼдٵͳƳ (ۼֽ) ʺ"дʱɢʱ"
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace stats
+{
+    inline constexpr std::size_t kCacheLine = 64;
+    inline constexpr std::size_t kShards = 64;
+
+    // ==========================================
+    // 0. ̲߳λÿ̶߳ռһۣ߳˳λ黹
+    // ==========================================
+    // ߳ kShards ʱ̹߳һ""
+    // ռĲҲ fetch_add £load + store Ȼֻһдߣ Reset() 㽻ǰֵдȥ
+    struct ThreadSlot
+    {
+        std::size_t index;
+        bool exclusive;
+    };
+
+    class SlotRegistry
+    {
+    private:
+        std::atomic<std::uint64_t> m_Used{0}; //  i λΪ 1 ʾ i ѱĳ߳ռ
+        static_assert(kShards == 64, "λͼֻ 64 λ");
+
+    public:
+        static SlotRegistry &Instance()
+        {
+            static SlotRegistry registry;
+            return registry;
+        }
+
+        ThreadSlot Acquire()
+        {
+            std::uint64_t used = m_Used.load(std::memory_order_relaxed);
+            while (used != ~0ull)
+            {
+                std::size_t bit = 0;
+                while (used & (1ull << bit))
+                    bit++;
+                // acquireһռڸòдֵ
+                if (m_Used.compare_exchange_weak(used, used | (1ull << bit), std::memory_order_acquire,
+                                                 std::memory_order_relaxed))
+                    return {bit, true};
+            }
+            return {kShards, false};
+        }
+
+        // releaseһռ߿߳дֵ
+        void Release(ThreadSlot slot)
+        {
+            if (slot.exclusive)
+                m_Used.fetch_and(~(1ull << slot.index), std::memory_order_release);
+        }
+    };
+
+    inline ThreadSlot ThisThreadSlot()
+    {
+        struct Lease
+        {
+            ThreadSlot slot = SlotRegistry::Instance().Acquire();
+            ~Lease() { SlotRegistry::Instance().Release(slot); }
+        };
+        thread_local Lease lease;
+        return lease.slot;
+    }
+
+    // ==========================================
+    // 1. ShardedCounterƬ (ɼӿɼ)
+    // ==========================================
+    class ShardedCounter
+    {
+    private:
+        struct alignas(kCacheLine) Cell
+        {
+            std::atomic<std::int64_t> value{0};
+        };
+        std::array<Cell, kShards + 1> m_Cells; // һ
+
+    public:
+        // ֻԼ̵߳Ĳۣrelaxed ͹ˣͬ
+        void Add(std::int64_t delta)
+        {
+            m_Cells[ThisThreadSlot().index].value.fetch_add(delta, std::memory_order_relaxed);
+        }
+        void Increment() { Add(1); }
+        void Decrement() { Add(-1); }
+
+        // вۡ벢дͬʱʱõ"ĳʱ"ֵдֹͣǾȷֵ
+        std::int64_t Value() const
+        {
+            std::int64_t sum = 0;
+            for (const Cell &cell : m_Cells)
+                sum += cell.value.load(std::memory_order_relaxed);
+            return sum;
+        }
+
+        void Reset()
+        {
+            for (Cell &cell : m_Cells)
+                cell.value.store(0, std::memory_order_relaxed);
+        }
+    };
+
+    // ==========================================
+    // 2. Gaugeǰֵ + ʷֵ (г)
+    // ==========================================
+    class Gauge
+    {
+    private:
+        std::atomic<std::int64_t> m_Value{0};
+        std::atomic<std::int64_t> m_Max{std::numeric_limits<std::int64_t>::min()};
+
+        void UpdateMax(std::int64_t candidate)
+        {
+            std::int64_t current = m_Max.load(std::memory_order_relaxed);
+            while (candidate > current &&
+                   !m_Max.compare_exchange_weak(current, candidate, std::memory_order_relaxed))
+            {
+            }
+        }
+
+    public:
+        void Set(std::int64_t value)
+        {
+            m_Value.store(value, std::memory_order_relaxed);
+            UpdateMax(value);
+        }
+
+        void Add(std::int64_t delta) { UpdateMax(m_Value.fetch_add(delta, std::memory_order_relaxed) + delta); }
+
+        std::int64_t Value() const { return m_Value.load(std::memory_order_relaxed); }
+        std::int64_t Max() const { return m_Max.load(std::memory_order_relaxed); }
+    };
+
+    // ==========================================
+    // 3. Histogram 2 ݷͰֱͼ (ʱֲ)̷ͬ߳Ƭ
+    // ==========================================
+    //  0 Ͱ 0 i Ͱ (i >= 1)  [2^(i-1), 2^i)ȡʱзƬ
+    class Histogram
+    {
+    public:
+        static constexpr std::size_t kBuckets = 65;
+
+        struct Snapshot
+        {
+            std::array<std::uint64_t, kBuckets> buckets{};
+            std::uint64_t count = 0;
+            std::uint64_t sum = 0;
+
+            double Mean() const { return count == 0 ? 0.0 : static_cast<double>(sum) / static_cast<double>(count); }
+
+            // Ʒλص p λͰϽ (p ȡ 0~1)
+            std::uint64_t Percentile(double p) const
+            {
+                if (count == 0)
+                    return 0;
+                auto rank = static_cast<std::uint64_t>(p * static_cast<double>(count - 1)) + 1;
+                std::uint64_t seen = 0;
+                for (std::size_t i = 0; i < kBuckets; i++)
+                {
+                    seen += buckets[i];
+                    if (seen >= rank)
+                        return i == 0 ? 0 : (i >= 64 ? std::numeric_limits<std::uint64_t>::max() : (1ull << i) - 1);
+                }
+                return std::numeric_limits<std::uint64_t>::max();
+            }
+        };
+
+    private:
+        struct alignas(kCacheLine) Shard
+        {
+            std::array<std::atomic<std::uint64_t>, kBuckets> buckets{};
+            std::atomic<std::uint64_t> count{0};
+            std::atomic<std::uint64_t> sum{0};
+        };
+        std::array<Shard, kShards + 1> m_Shards;
+
+        static std::size_t BucketOf(std::uint64_t value)
+        {
+            std::size_t bits = 0;
+            while (value != 0) // ȼ 64 - countl_zero(value)
+            {
+                value >>= 1;
+                bits++;
+            }
+            return bits;
+        }
+
+    public:
+        void Record(std::uint64_t value)
+        {
+            Shard &shard = m_Shards[ThisThreadSlot().index];
+            shard.buckets[BucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+            shard.count.fetch_add(1, std::memory_order_relaxed);
+            shard.sum.fetch_add(value, std::memory_order_relaxed);
+        }
+
+        Snapshot Read() const
+        {
+            Snapshot snap;
+            for (const Shard &shard : m_Shards)
+            {
+                for (std::size_t i = 0; i < kBuckets; i++)
+                    snap.buckets[i] += shard.buckets[i].load(std::memory_order_relaxed);
+                snap.count += shard.count.load(std::memory_order_relaxed);
+                snap.sum += shard.sum.load(std::memory_order_relaxed);
+            }
+            return snap;
+        }
+    };
+
+    // ==========================================
+    // 4. Counted<T>CRTP ʵ (Mixin)
+    // ==========================================
+    // class User : public stats::Counted<User> { ... };
+    // ÿͬ T ʵһ Counted<T>ӵԼһ static 
+    // Ҫÿд static int userCount ⶨ (inline static ڼɶ)
+    template <typename T>
+    class Counted
+    {
+    private:
+        static inline ShardedCounter s_Live;    // ǰʵ
+        static inline ShardedCounter s_Created; // ۼƴʵ
+
+    protected:
+        Counted()
+        {
+            s_Live.Increment();
+            s_Created.Increment();
+        }
+        // /ƶҲһ¶ͬҪ
+        Counted(const Counted &) : Counted() {}
+        Counted(Counted &&) noexcept : Counted() {}
+        Counted &operator=(const Counted &) = default;
+        Counted &operator=(Counted &&) noexcept = default;
+        ~Counted() { s_Live.Decrement(); } // 飺Counted<T> ָֻ࣬ͨɾ
+
+    public:
+        static std::int64_t LiveCount() { return s_Live.Value(); }
+        static std::int64_t CreatedCount() { return s_Created.Value(); }
+    };
+} // namespace stats
@@ -0,0 +1,144 @@
+/**
+ * @file counter_benchmark.cpp
+ * @brief User ʵдstatic int (ݾ) vs static std::atomic<int> vs CRTP Counted<T> (Ƭ)
+ * @note : g++ -O3 -std=c++17 -pthread counter_benchmark.cpp -o counter_benchmark
+ */
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Stats.h"
+#include "../../23_Benchmarking/Timer.h"
+
+// ==========================================
+// 1. 汾 User
+// ==========================================
+// ԭ (demo.cpp)ͨ static int߳ ++/-- ᶪʧ
+class RacyUser
+{
+private:
+    std::string username;
+    static int userCount;
+
+public:
+    RacyUser(std::string name) : username(std::move(name)) { userCount++; }
+    ~RacyUser() { userCount--; }
+    static int getUserCount() { return userCount; }
+};
+int RacyUser::userCount = 0;
+
+// ԭӰ棺ȷ߳ͬһ
+class AtomicUser
+{
+private:
+    std::string username;
+    static std::atomic<int> userCount;
+
+public:
+    AtomicUser(std::string name) : username(std::move(name)) { userCount.fetch_add(1, std::memory_order_relaxed); }
+    ~AtomicUser() { userCount.fetch_sub(1, std::memory_order_relaxed); }
+    static int getUserCount() { return userCount.load(); }
+};
+std::atomic<int> AtomicUser::userCount{0};
+
+// CRTP 棺 Counted<CountedUser> ṩÿ߳дԼķƬ
+class CountedUser : public stats::Counted<CountedUser>
+{
+private:
+    std::string username;
+
+public:
+    CountedUser(std::string name) : username(std::move(name)) {}
+    static std::int64_t getUserCount() { return LiveCount(); }
+};
+
+// ==========================================
+// 2. ԣÿ̷߳һ User 
+// ==========================================
+constexpr int kUsersPerThread = 2000000;
+constexpr int kBatch = 16; // ÿͬʱ 16 
+
+stats::Histogram g_BatchLatency; // ÿ ( +  16 ) ĺʱֲλ ns
+
+template <typename UserType>
+void Worker(bool recordLatency)
+{
+    for (int i = 0; i < kUsersPerThread; i += kBatch)
+    {
+        auto start = std::chrono::steady_clock::now();
+        {
+            std::vector<UserType> users;
+            users.reserve(kBatch);
+            for (int k = 0; k < kBatch; k++)
+                users.emplace_back("user");
+            DoNotOptimize(users);
+        }
+        if (recordLatency)
+        {
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+            g_BatchLatency.Record(static_cast<std::uint64_t>(ns.count()));
+        }
+    }
+}
+
+template <typename UserType>
+void RunCase(const char *name, int threadCount)
+{
+    std::size_t total = static_cast<std::size_t>(kUsersPerThread) * threadCount;
+    std::vector<std::thread> threads;
+    Timer timer(name, total);
+    for (int t = 0; t < threadCount; t++)
+        threads.emplace_back(Worker<UserType>, false);
+    for (auto &t : threads)
+        t.join();
+    double us = timer.Stop();
+    std::cout << "    -> " << std::fixed << std::setprecision(1) << total / us << " M ctor+dtor/s" << std::defaultfloat
+              << std::setprecision(6) << ", final count " << UserType::getUserCount() << " (expected 0)" << std::endl;
+}
+
+int main()
+{
+    std::cout << "=== 1. Counted<T> basics ===" << std::endl;
+    {
+        CountedUser alice("Alice");
+        CountedUser bob("Bob");
+        CountedUser copy = alice;
+        std::cout << "  live " << CountedUser::LiveCount() << ", created " << CountedUser::CreatedCount() << std::endl;
+    }
+    std::cout << "  after scope: live " << CountedUser::LiveCount() << ", created " << CountedUser::CreatedCount()
+              << std::endl;
+
+    stats::Gauge online;
+    for (int delta : {+3, +5, -2, +4, -10})
+        online.Add(delta);
+    std::cout << "  gauge: value " << online.Value() << ", high-water mark " << online.Max() << std::endl;
+
+    std::cout << "\n=== 2. Constructor throughput (" << kUsersPerThread << " users per thread, hardware threads "
+              << std::thread::hardware_concurrency() << ", Run in Release Mode! -O3) ===" << std::endl;
+    for (int threads : {1, 2, 4, 8, 16})
+    {
+        std::cout << "-- " << threads << " thread(s) --" << std::endl;
+        RunCase<RacyUser>("static int (racy)", threads);
+        RunCase<AtomicUser>("static std::atomic<int>", threads);
+        RunCase<CountedUser>("Counted<T> (sharded)", threads);
+    }
+
+    std::cout << "\n=== 3. Histogram: batch latency with Counted<T>, 4 threads ===" << std::endl;
+    {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; t++)
+            threads.emplace_back(Worker<CountedUser>, true);
+        for (auto &t : threads)
+            t.join();
+        stats::Histogram::Snapshot snap = g_BatchLatency.Read();
+        std::cout << "  batches " << snap.count << ", mean " << snap.Mean() << " ns, p50 <= " << snap.Percentile(0.5)
+                  << " ns, p99 <= " << snap.Percentile(0.99) << " ns, p99.9 <= " << snap.Percentile(0.999) << " ns"
+                  << std::endl;
+    }
+    return 0;
+}
@@ -20,6 +20,7 @@ private:
     std::string username;
 
     // ̬ User 
+    // ע⣺ͨ int ڶ߳ͬʱ/ʱᶪʧ£̰߳ȫҿչд Stats.h е Counted<T>
     static int userCount;
 
 public:
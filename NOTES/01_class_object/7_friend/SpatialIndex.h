@@ -0,0 +1,451 @@
+/**
+ * @file SpatialIndex.h
+ * @brief άĿռSoA  PointCloudSIMD ƽںˡ k-d  KdTree (k  / 뾶ѯ)
+ *        Լһѯп齻̳߳ص KnnBatch / RadiusBatch
+ * @note Ҫ C++20 ( 17_thread/ThreadPool.h) -pthread SSE2 ʱһ 2 룬 -mavx һ 4 
+ *
+ * README е calculateDistance(p1, p2) Ԫһһ롣ڲѯֻܱ
+ * ÿβѯҪȫ N һΣÿζһ sqrtĸķ㣺
+ *   - ֣PointCloud  xy ֱ (SoA)һ SIMD ָͬʱڵļ
+ *   - ںˣSquaredDistances ֻƽ롣ȽԶҪҪʱٶսһ sqrt
+ *   - KdTree һҶĵ㰴˳ų SoA 䣬Ҷֱӵںˡ
+ *           ѯʱĳһָߵľѾǰ k ľ룬
+ * ѯ֮以Ӱ죬KnnBatch / RadiusBatch Ѳѯгɹ̶СĿ齻 ThreadPool
+ * ѯ˳У߳޹ء
+ * ʱ±Сţ k ڽȷģͱĽͬ
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../../17_thread/ThreadPool.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define SPATIAL_INDEX_HAS_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SPATIAL_INDEX_HAS_SSE2 1
+#endif
+
+namespace spatial
+{
+    // ==========================================
+    // 1. PointCloudxy ֿ (SoA)
+    // ==========================================
+    class PointCloud
+    {
+    public:
+        PointCloud() = default;
+        PointCloud(std::vector<double> xs, std::vector<double> ys) : m_X(std::move(xs)), m_Y(std::move(ys))
+        {
+            if (m_X.size() != m_Y.size())
+                throw std::invalid_argument("PointCloud: x and y must have the same length");
+        }
+
+        void Reserve(std::size_t n)
+        {
+            m_X.reserve(n);
+            m_Y.reserve(n);
+        }
+        void Add(double x, double y)
+        {
+            m_X.push_back(x);
+            m_Y.push_back(y);
+        }
+
+        std::size_t Size() const { return m_X.size(); }
+        double X(std::size_t i) const { return m_X[i]; }
+        double Y(std::size_t i) const { return m_Y[i]; }
+        const double *XData() const { return m_X.data(); }
+        const double *YData() const { return m_Y.data(); }
+
+    private:
+        std::vector<double> m_X;
+        std::vector<double> m_Y;
+    };
+
+    // ѯԭ PointCloud е± + ƽ (Ҫʵʱ Distance())
+    struct Neighbor
+    {
+        std::uint32_t index;
+        double distSq;
+
+        double Distance() const { return std::sqrt(distSq); }
+        friend bool operator<(const Neighbor &a, const Neighbor &b)
+        {
+            return a.distSq < b.distSq || (a.distSq == b.distSq && a.index < b.index);
+        }
+        friend bool operator==(const Neighbor &a, const Neighbor &b) { return a.index == b.index && a.distSq == b.distSq; }
+    };
+
+    // ==========================================
+    // 2. ƽںˣout[i] = (xs[i]-qx)^2 + (ys[i]-qy)^2˳㷵еСֵ
+    // ==========================================
+    // ֻм˷ͼӷû sqrt -mfma ʱ SIMD βĽλͬ
+    // صСֵõ÷ɸѡ (ûбȵǰ k ĵʱ)n == 0 ʱ +inf
+    inline double SquaredDistances(double qx, double qy, const double *xs, const double *ys, std::size_t n, double *out)
+    {
+        double best = std::numeric_limits<double>::infinity();
+        std::size_t i = 0;
+#if defined(SPATIAL_INDEX_HAS_AVX)
+        const std::size_t vectorEnd = n / 4 * 4;
+        const __m256d vx = _mm256_set1_pd(qx);
+        const __m256d vy = _mm256_set1_pd(qy);
+        __m256d vmin = _mm256_set1_pd(best);
+        for (; i < vectorEnd; i += 4)
+        {
+            __m256d dx = _mm256_sub_pd(_mm256_loadu_pd(xs + i), vx);
+            __m256d dy = _mm256_sub_pd(_mm256_loadu_pd(ys + i), vy);
+            __m256d d = _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy));
+            _mm256_storeu_pd(out + i, d);
+            vmin = _mm256_min_pd(vmin, d);
+        }
+        alignas(32) double lanes[4];
+        _mm256_store_pd(lanes, vmin);
+        best = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+#elif defined(SPATIAL_INDEX_HAS_SSE2)
+        const std::size_t vectorEnd = n / 2 * 2;
+        const __m128d vx = _mm_set1_pd(qx);
+        const __m128d vy = _mm_set1_pd(qy);
+        __m128d vmin = _mm_set1_pd(best);
+        for (; i < vectorEnd; i += 2)
+        {
+            __m128d dx = _mm_sub_pd(_mm_loadu_pd(xs + i), vx);
+            __m128d dy = _mm_sub_pd(_mm_loadu_pd(ys + i), vy);
+            __m128d d = _mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy));
+            _mm_storeu_pd(out + i, d);
+            vmin = _mm_min_pd(vmin, d);
+        }
+        best = std::min(_mm_cvtsd_f64(vmin), _mm_cvtsd_f64(_mm_unpackhi_pd(vmin, vmin)));
+#endif
+        for (; i < n; i++)
+        {
+            double dx = xs[i] - qx;
+            double dy = ys[i] - qy;
+            out[i] = dx * dx + dy * dy;
+            best = std::min(best, out[i]);
+        }
+        return best;
+    }
+
+    namespace detail
+    {
+        // ĺѡ (k ͨСȶѸ)δʱ Worst() Ϊ
+        class KnnList
+        {
+        public:
+            void Reset(std::size_t k)
+            {
+                m_K = k;
+                m_Items.clear();
+            }
+            double Worst() const
+            {
+                return m_Items.size() < m_K ? std::numeric_limits<double>::infinity() : m_Items.back().distSq;
+            }
+            void Offer(std::uint32_t index, double distSq)
+            {
+                Neighbor item{index, distSq};
+                if (m_K == 0 || (m_Items.size() == m_K && !(item < m_Items.back())))
+                    return;
+                if (m_Items.size() == m_K)
+                    m_Items.pop_back();
+                auto pos = std::upper_bound(m_Items.begin(), m_Items.end(), item);
+                m_Items.insert(pos, item);
+            }
+            const std::vector<Neighbor> &Items() const { return m_Items; }
+
+        private:
+            std::size_t m_K = 0;
+            std::vector<Neighbor> m_Items;
+        };
+
+        // ѡ±ʱ (k-d Ҷ) õɨ裺ÿ kBlock ƽ룬ɸѡ
+        constexpr std::size_t kBlock = 256;
+
+        inline void ScanKnn(double qx, double qy, const double *xs, const double *ys, const std::uint32_t *ids,
+                            std::uint32_t firstId, std::size_t n, KnnList &list)
+        {
+            double dist[kBlock];
+            for (std::size_t b = 0; b < n; b += kBlock)
+            {
+                const std::size_t m = std::min(kBlock, n - b);
+                double worst = list.Worst();
+                if (SquaredDistances(qx, qy, xs + b, ys + b, m, dist) > worst)
+                    continue; // 鶼ȵǰ k ĵԶ (ѯڵĳ)
+                for (std::size_t i = 0; i < m; i++)
+                    if (dist[i] <= worst)
+                    {
+                        list.Offer(ids ? ids[b + i] : static_cast<std::uint32_t>(firstId + b + i), dist[i]);
+                        worst = list.Worst();
+                    }
+            }
+        }
+
+        inline void ScanRadius(double qx, double qy, double radiusSq, const double *xs, const double *ys,
+                               const std::uint32_t *ids, std::uint32_t firstId, std::size_t n,
+                               std::vector<std::uint32_t> &out)
+        {
+            double dist[kBlock];
+            for (std::size_t b = 0; b < n; b += kBlock)
+            {
+                const std::size_t m = std::min(kBlock, n - b);
+                if (SquaredDistances(qx, qy, xs + b, ys + b, m, dist) > radiusSq)
+                    continue;
+                for (std::size_t i = 0; i < m; i++)
+                    if (dist[i] <= radiusSq)
+                        out.push_back(ids ? ids[b + i] : static_cast<std::uint32_t>(firstId + b + i));
+            }
+        }
+
+        inline void CheckIndexRange(std::size_t n)
+        {
+            if (n > std::numeric_limits<std::uint32_t>::max())
+                throw std::length_error("spatial: more than 2^32 - 1 points");
+        }
+    } // namespace detail
+
+    // ==========================================
+    // 3.  (SoA + ں)Ϊ KdTree ĶգҲʺϵٵĳ
+    // ==========================================
+    //  (, ±) С k 
+    inline void BruteForceKnn(const PointCloud &cloud, double qx, double qy, std::size_t k, std::vector<Neighbor> &out)
+    {
+        detail::CheckIndexRange(cloud.Size());
+        detail::KnnList list;
+        list.Reset(k);
+        detail::ScanKnn(qx, qy, cloud.XData(), cloud.YData(), nullptr, 0, cloud.Size(), list);
+        out = list.Items();
+    }
+
+    // ==========================================
+    // 4. KdTree (ÿذΧнϳһȡλз)Ҷ SoA 
+    // ==========================================
+    class KdTree
+    {
+    public:
+        static constexpr std::uint32_t kLeafSize = 32;
+
+        KdTree() = default;
+        explicit KdTree(const PointCloud &cloud) { Build(cloud); }
+
+        // һݵ (˳) cloud ͷŻ޸
+        void Build(const PointCloud &cloud)
+        {
+            detail::CheckIndexRange(cloud.Size());
+            const std::uint32_t n = static_cast<std::uint32_t>(cloud.Size());
+            m_Nodes.clear();
+            m_Ids.resize(n);
+            for (std::uint32_t i = 0; i < n; i++)
+                m_Ids[i] = i;
+            if (n > 0)
+            {
+                m_Nodes.reserve(2 * (n / kLeafSize + 1));
+                BuildNode(cloud, 0, n);
+            }
+            // Ҷ˳ռ꣺ѯʱÿҶֻڴ
+            m_X.resize(n);
+            m_Y.resize(n);
+            for (std::uint32_t i = 0; i < n; i++)
+            {
+                m_X[i] = cloud.X(m_Ids[i]);
+                m_Y[i] = cloud.Y(m_Ids[i]);
+            }
+        }
+
+        std::size_t Size() const { return m_Ids.size(); }
+        std::size_t NodeCount() const { return m_Nodes.size(); }
+
+        // k ڣout  (, ±) С k 
+        void Knn(double qx, double qy, std::size_t k, std::vector<Neighbor> &out) const
+        {
+            detail::KnnList list;
+            Knn(qx, qy, k, list);
+            out = list.Items();
+        }
+
+        // 뾶ѯѾ <= radius ĵ±׷ӵ out (˳򲻱֤)
+        void Radius(double qx, double qy, double radius, std::vector<std::uint32_t> &out) const
+        {
+            if (!m_Nodes.empty() && radius >= 0)
+                SearchRadius(0, qx, qy, radius * radius, out);
+        }
+
+        //  KnnBatch úѡÿβѯڴ
+        void Knn(double qx, double qy, std::size_t k, detail::KnnList &list) const
+        {
+            list.Reset(k);
+            if (!m_Nodes.empty() && k > 0)
+                SearchKnn(0, qx, qy, list);
+        }
+
+    private:
+        // ǰţӽڸڵֻ֮¼Һӵλ
+        struct Node
+        {
+            double split;
+            std::uint32_t begin, end;
+            std::uint32_t right; // 0 ʾҶ (ڵ㲻Ǳ˵Һ)
+            std::uint32_t axis;  // 0 = x, 1 = y
+        };
+
+        std::uint32_t BuildNode(const PointCloud &cloud, std::uint32_t begin, std::uint32_t end)
+        {
+            const std::uint32_t self = static_cast<std::uint32_t>(m_Nodes.size());
+            m_Nodes.push_back({0.0, begin, end, 0, 0});
+            if (end - begin <= kLeafSize)
+                return self;
+
+            double minX = cloud.X(m_Ids[begin]), maxX = minX;
+            double minY = cloud.Y(m_Ids[begin]), maxY = minY;
+            for (std::uint32_t i = begin + 1; i < end; i++)
+            {
+                minX = std::min(minX, cloud.X(m_Ids[i]));
+                maxX = std::max(maxX, cloud.X(m_Ids[i]));
+                minY = std::min(minY, cloud.Y(m_Ids[i]));
+                maxY = std::max(maxY, cloud.Y(m_Ids[i]));
+            }
+            const std::uint32_t axis = (maxY - minY > maxX - minX) ? 1 : 0;
+            const double *coord = axis == 0 ? cloud.XData() : cloud.YData();
+            const std::uint32_t mid = begin + (end - begin) / 2;
+            // ߵ <= split <= Ұߵ
+            std::nth_element(m_Ids.begin() + begin, m_Ids.begin() + mid, m_Ids.begin() + end,
+                             [coord](std::uint32_t a, std::uint32_t b) { return coord[a] < coord[b]; });
+            const double split = coord[m_Ids[mid]];
+
+            BuildNode(cloud, begin, mid);
+            const std::uint32_t right = BuildNode(cloud, mid, end);
+            m_Nodes[self].split = split;
+            m_Nodes[self].axis = axis;
+            m_Nodes[self].right = right;
+            return self;
+        }
+
+        void SearchKnn(std::uint32_t index, double qx, double qy, detail::KnnList &list) const
+        {
+            const Node &node = m_Nodes[index];
+            if (node.right == 0)
+            {
+                detail::ScanKnn(qx, qy, m_X.data() + node.begin, m_Y.data() + node.begin, m_Ids.data() + node.begin, 0,
+                                node.end - node.begin, list);
+                return;
+            }
+            const double diff = (node.axis == 0 ? qx : qy) - node.split;
+            const std::uint32_t nearChild = diff < 0 ? index + 1 : node.right;
+            const std::uint32_t farChild = diff < 0 ? node.right : index + 1;
+            SearchKnn(nearChild, qx, qy, list);
+            // һĵ㵽ѯľ |diff|ȡ <=þȡ±Сĵл
+            if (diff * diff <= list.Worst())
+                SearchKnn(farChild, qx, qy, list);
+        }
+
+        void SearchRadius(std::uint32_t index, double qx, double qy, double radiusSq, std::vector<std::uint32_t> &out) const
+        {
+            const Node &node = m_Nodes[index];
+            if (node.right == 0)
+            {
+                detail::ScanRadius(qx, qy, radiusSq, m_X.data() + node.begin, m_Y.data() + node.begin,
+                                   m_Ids.data() + node.begin, 0, node.end - node.begin, out);
+                return;
+            }
+            const double diff = (node.axis == 0 ? qx : qy) - node.split;
+            const std::uint32_t nearChild = diff < 0 ? index + 1 : node.right;
+            const std::uint32_t farChild = diff < 0 ? node.right : index + 1;
+            SearchRadius(nearChild, qx, qy, radiusSq, out);
+            if (diff * diff <= radiusSq)
+                SearchRadius(farChild, qx, qy, radiusSq, out);
+        }
+
+        std::vector<Node> m_Nodes;
+        std::vector<double> m_X, m_Y;     // Ҷ˳ź
+        std::vector<std::uint32_t> m_Ids; // ź i ԭ PointCloud е±
+    };
+
+    // ==========================================
+    // 5. ѯ̶СĿз֣̳߳
+    // ==========================================
+    struct BatchOptions
+    {
+        ThreadPool *pool = nullptr; // nullptr ʾڵ߳ϴִ
+        std::size_t grain = 256;    // ÿĲѯ (̶߳޹)
+    };
+
+    namespace detail
+    {
+        template <typename ChunkBody>
+        void ForEachQueryChunk(std::size_t count, const BatchOptions &opt, ChunkBody &&body)
+        {
+            const std::size_t grain = std::max<std::size_t>(1, opt.grain);
+            const std::size_t chunks = (count + grain - 1) / grain;
+            auto run = [&](std::size_t c) { body(c * grain, std::min(count, (c + 1) * grain), c); };
+            if (!opt.pool || opt.pool->size() <= 1 || chunks <= 1)
+            {
+                for (std::size_t c = 0; c < chunks; c++)
+                    run(c);
+                return;
+            }
+            opt.pool->parallel_for(0, chunks, run, 1);
+        }
+    } // namespace detail
+
+    //  i ѯĽ [i * k, i * k + k) k  ( k) ʱʣλΪ {UINT32_MAX, +inf}
+    inline std::vector<Neighbor> KnnBatch(const KdTree &tree, const PointCloud &queries, std::size_t k,
+                                          const BatchOptions &opt = {})
+    {
+        const Neighbor empty{std::numeric_limits<std::uint32_t>::max(), std::numeric_limits<double>::infinity()};
+        std::vector<Neighbor> result(queries.Size() * k, empty);
+        detail::ForEachQueryChunk(queries.Size(), opt, [&](std::size_t b, std::size_t e, std::size_t)
+                                  {
+            detail::KnnList list; // ÿһݣڵĲѯ
+            for (std::size_t q = b; q < e; q++)
+            {
+                tree.Knn(queries.X(q), queries.Y(q), k, list);
+                std::copy(list.Items().begin(), list.Items().end(), result.begin() + q * k);
+            } });
+        return result;
+    }
+
+    // ѹиʽ (CSR) i ѯе± indices[offsets[i], offsets[i + 1])ÿΰ±
+    struct RadiusResult
+    {
+        std::vector<std::size_t> offsets;
+        std::vector<std::uint32_t> indices;
+
+        std::size_t Count(std::size_t query) const { return offsets[query + 1] - offsets[query]; }
+    };
+
+    inline RadiusResult RadiusBatch(const KdTree &tree, const PointCloud &queries, double radius,
+                                    const BatchOptions &opt = {})
+    {
+        const std::size_t count = queries.Size();
+        const std::size_t grain = std::max<std::size_t>(1, opt.grain);
+        std::vector<std::vector<std::uint32_t>> chunkHits((count + grain - 1) / grain);
+        RadiusResult result;
+        result.offsets.assign(count + 1, 0);
+        detail::ForEachQueryChunk(count, opt, [&](std::size_t b, std::size_t e, std::size_t c)
+                                  {
+            std::vector<std::uint32_t> &hits = chunkHits[c];
+            for (std::size_t q = b; q < e; q++)
+            {
+                const std::size_t before = hits.size();
+                tree.Radius(queries.X(q), queries.Y(q), radius, hits);
+                std::sort(hits.begin() + before, hits.end());
+                result.offsets[q + 1] = hits.size() - before; // ȼǸϲʱתǰ׺
+            } });
+        for (std::size_t q = 0; q < count; q++)
+            result.offsets[q + 1] += result.offsets[q];
+        result.indices.reserve(result.offsets[count]);
+        for (const std::vector<std::uint32_t> &hits : chunkHits)
+            result.indices.insert(result.indices.end(), hits.begin(), hits.end());
+        return result;
+    }
+} // namespace spatial
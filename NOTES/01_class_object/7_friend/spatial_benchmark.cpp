@@ -0,0 +1,368 @@
+/**
+ * @file spatial_benchmark.cpp
+ * @brief  / k  / 뾶ѯREADME  Point + calculateDistance  vs SoA + SIMD  vs KdTree
+ *        Լ KnnBatch / RadiusBatch ڲͬ߳µ
+ * @note : g++ -O3 -std=c++20 -pthread spatial_benchmark.cpp -o spatial_benchmark (ټ -mavx  4 · SIMD)
+ *       : ./spatial_benchmark [Ĭ 2000000]
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "SpatialIndex.h"
+#include "../../23_Benchmarking/Timer.h"
+
+// ==========================================
+// 1. README е Point Ԫ calculateDistance
+// ==========================================
+class Point
+{
+private:
+    double x, y;
+
+public:
+    Point(double xVal, double yVal) : x(xVal), y(yVal) {}
+
+    friend double calculateDistance(const Point &p1, const Point &p2);
+    // һԪ˽ SoA ƣҪΪ˼ getter
+    friend spatial::PointCloud ToCloud(const std::vector<Point> &points);
+};
+
+double calculateDistance(const Point &p1, const Point &p2)
+{
+    double dx = p1.x - p2.x;
+    double dy = p1.y - p2.y;
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+spatial::PointCloud ToCloud(const std::vector<Point> &points)
+{
+    spatial::PointCloud cloud;
+    cloud.Reserve(points.size());
+    for (const Point &p : points)
+        cloud.Add(p.x, p.y);
+    return cloud;
+}
+
+// ԭдÿһ calculateDistance (ÿζ)
+std::uint32_t LegacyNearest(const std::vector<Point> &points, const Point &q)
+{
+    std::uint32_t best = 0;
+    double bestDist = calculateDistance(points[0], q);
+    for (std::uint32_t i = 1; i < points.size(); i++)
+    {
+        double d = calculateDistance(points[i], q);
+        if (d < bestDist)
+        {
+            bestDist = d;
+            best = i;
+        }
+    }
+    return best;
+}
+
+// k ڵԭдȫ룬 partial_sort ȡǰ k 
+std::vector<std::uint32_t> LegacyKnn(const std::vector<Point> &points, const Point &q, std::size_t k,
+                                     std::vector<std::pair<double, std::uint32_t>> &scratch)
+{
+    scratch.resize(points.size());
+    for (std::uint32_t i = 0; i < points.size(); i++)
+        scratch[i] = {calculateDistance(points[i], q), i};
+    k = std::min(k, scratch.size());
+    std::partial_sort(scratch.begin(), scratch.begin() + k, scratch.end());
+    std::vector<std::uint32_t> result(k);
+    for (std::size_t i = 0; i < k; i++)
+        result[i] = scratch[i].second;
+    return result;
+}
+
+std::size_t LegacyRadiusCount(const std::vector<Point> &points, const Point &q, double radius)
+{
+    std::size_t count = 0;
+    for (const Point &p : points)
+        count += calculateDistance(p, q) <= radius;
+    return count;
+}
+
+std::vector<Point> RandomPoints(std::size_t n, unsigned seed, double extent = 1000.0)
+{
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> dist(0.0, extent);
+    std::vector<Point> points;
+    points.reserve(n);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        double x = dist(rng);
+        points.emplace_back(x, dist(rng));
+    }
+    return points;
+}
+
+std::vector<std::uint32_t> Indices(const std::vector<spatial::Neighbor> &neighbors)
+{
+    std::vector<std::uint32_t> ids;
+    for (const spatial::Neighbor &n : neighbors)
+        ids.push_back(n.index);
+    return ids;
+}
+
+// ==========================================
+// 2. Լ죺KdTree 뱩ͬ (ظꡢk ڵյ)ѯ߳޹
+// ==========================================
+bool SelfCheck()
+{
+    bool ok = true;
+    std::mt19937 rng(7);
+    std::vector<spatial::Neighbor> expected, actual;
+    for (std::size_t n : {0, 1, 31, 33, 1000, 20000})
+    {
+        // ꣺ȵĵ㣬 (, ±) ȷ
+        spatial::PointCloud cloud;
+        for (std::size_t i = 0; i < n; i++)
+            cloud.Add(static_cast<double>(rng() % 50), static_cast<double>(rng() % 50));
+        spatial::KdTree tree(cloud);
+        for (int q = 0; q < 200; q++)
+        {
+            const double qx = static_cast<double>(rng() % 60) - 5, qy = (rng() % 120) * 0.5 - 5;
+            for (std::size_t k : {1, 4, 40})
+            {
+                spatial::BruteForceKnn(cloud, qx, qy, k, expected);
+                tree.Knn(qx, qy, k, actual);
+                ok &= expected == actual && actual.size() == std::min(k, n);
+            }
+            const double radius = (rng() % 40) * 0.25;
+            std::vector<std::uint32_t> hits, reference;
+            tree.Radius(qx, qy, radius, hits);
+            for (std::uint32_t i = 0; i < n; i++)
+            {
+                double dx = cloud.X(i) - qx, dy = cloud.Y(i) - qy;
+                if (dx * dx + dy * dy <= radius * radius)
+                    reference.push_back(i);
+            }
+            std::sort(hits.begin(), hits.end());
+            ok &= hits == reference;
+        }
+    }
+
+    // ꣺ calculateDistance һ£λͬ
+    std::vector<Point> points = RandomPoints(5000, 3);
+    spatial::PointCloud cloud = ToCloud(points);
+    spatial::KdTree tree(cloud);
+    std::vector<Point> queryPoints = RandomPoints(1000, 4);
+    spatial::PointCloud queries = ToCloud(queryPoints);
+    for (std::size_t q = 0; q < queryPoints.size(); q++)
+    {
+        tree.Knn(queries.X(q), queries.Y(q), 1, actual);
+        std::uint32_t legacy = LegacyNearest(points, queryPoints[q]);
+        ok &= actual[0].index == legacy && actual[0].Distance() == calculateDistance(points[legacy], queryPoints[q]);
+    }
+
+    // ѯ̳߳ؽͬ뵥βѯͬ
+    ThreadPool pool(4);
+    spatial::BatchOptions parallel{&pool, 64};
+    std::vector<spatial::Neighbor> serialKnn = spatial::KnnBatch(tree, queries, 5);
+    ok &= serialKnn == spatial::KnnBatch(tree, queries, 5, parallel);
+    spatial::RadiusResult serialRadius = spatial::RadiusBatch(tree, queries, 20.0);
+    spatial::RadiusResult parallelRadius = spatial::RadiusBatch(tree, queries, 20.0, parallel);
+    ok &= serialRadius.offsets == parallelRadius.offsets && serialRadius.indices == parallelRadius.indices;
+    for (std::size_t q = 0; q < queries.Size(); q += 37)
+    {
+        tree.Knn(queries.X(q), queries.Y(q), 5, actual);
+        ok &= std::equal(actual.begin(), actual.end(), serialKnn.begin() + q * 5);
+        ok &= serialRadius.Count(q) == LegacyRadiusCount(points, queryPoints[q], 20.0);
+    }
+
+    // k ڵʱKnnBatch  {UINT32_MAX, inf} 
+    spatial::PointCloud few;
+    few.Add(1, 1);
+    spatial::KdTree small(few);
+    std::vector<spatial::Neighbor> padded = spatial::KnnBatch(small, queries, 2);
+    ok &= padded[0].index == 0 && padded[1].index == UINT32_MAX && std::isinf(padded[1].distSq);
+    return ok;
+}
+
+// ==========================================
+// 3.  vs KdTreeβѯ
+// ==========================================
+void SingleQueries(const std::vector<Point> &points, const spatial::PointCloud &cloud, const spatial::KdTree &tree)
+{
+    const std::vector<Point> queryPoints = RandomPoints(200, 21);
+    const spatial::PointCloud queries = ToCloud(queryPoints);
+    const std::size_t q = queryPoints.size();
+    std::vector<spatial::Neighbor> result;
+
+    std::cout << "-- nearest neighbour (k = 1), " << q << " queries --" << std::endl;
+    std::vector<std::uint32_t> legacy, brute, indexed;
+    {
+        Timer timer("Point + calculateDistance loop (sqrt per point)", q);
+        for (const Point &p : queryPoints)
+            legacy.push_back(LegacyNearest(points, p));
+    }
+    {
+        Timer timer("SoA + SIMD squared distances, brute force", q);
+        for (std::size_t i = 0; i < q; i++)
+        {
+            spatial::BruteForceKnn(cloud, queries.X(i), queries.Y(i), 1, result);
+            brute.push_back(result[0].index);
+        }
+    }
+    {
+        Timer timer("KdTree::Knn", q);
+        for (std::size_t i = 0; i < q; i++)
+        {
+            tree.Knn(queries.X(i), queries.Y(i), 1, result);
+            indexed.push_back(result[0].index);
+        }
+    }
+    std::cout << "  results " << (legacy == brute && brute == indexed ? "identical" : "DIFFER") << std::endl;
+
+    const std::size_t k = 16;
+    std::cout << "-- k nearest (k = " << k << "), " << q << " queries --" << std::endl;
+    std::vector<std::vector<std::uint32_t>> legacyKnn, bruteKnn, treeKnn;
+    {
+        std::vector<std::pair<double, std::uint32_t>> scratch;
+        Timer timer("calculateDistance into vector + partial_sort", q);
+        for (const Point &p : queryPoints)
+            legacyKnn.push_back(LegacyKnn(points, p, k, scratch));
+    }
+    {
+        Timer timer("SoA + SIMD brute force, bounded candidate list", q);
+        for (std::size_t i = 0; i < q; i++)
+        {
+            spatial::BruteForceKnn(cloud, queries.X(i), queries.Y(i), k, result);
+            bruteKnn.push_back(Indices(result));
+        }
+    }
+    {
+        Timer timer("KdTree::Knn", q);
+        for (std::size_t i = 0; i < q; i++)
+        {
+            tree.Knn(queries.X(i), queries.Y(i), k, result);
+            treeKnn.push_back(Indices(result));
+        }
+    }
+    std::cout << "  results " << (legacyKnn == bruteKnn && bruteKnn == treeKnn ? "identical" : "DIFFER") << std::endl;
+
+    const double radius = 5.0;
+    std::cout << "-- radius " << radius << " (about " << points.size() * 3.14159 * radius * radius / 1e6
+              << " hits per query), " << q << " queries --" << std::endl;
+    std::size_t legacyHits = 0, treeHits = 0;
+    {
+        Timer timer("calculateDistance(p, q) <= r loop", q);
+        for (const Point &p : queryPoints)
+            legacyHits += LegacyRadiusCount(points, p, radius);
+    }
+    {
+        std::vector<std::uint32_t> hits;
+        Timer timer("KdTree::Radius", q);
+        for (std::size_t i = 0; i < q; i++)
+        {
+            hits.clear();
+            tree.Radius(queries.X(i), queries.Y(i), radius, hits);
+            treeHits += hits.size();
+        }
+    }
+    std::cout << "  total hits " << legacyHits << " vs " << treeHits << (legacyHits == treeHits ? " (identical)" : " (DIFFER)")
+              << std::endl;
+}
+
+// ==========================================
+// 4. ڻʱں˲ࣺ4096  (64 KB)ѯ
+// ==========================================
+void InCacheKernel()
+{
+    const std::vector<Point> points = RandomPoints(4096, 5);
+    const spatial::PointCloud cloud = ToCloud(points);
+    const std::vector<Point> queryPoints = RandomPoints(20000, 6);
+    const spatial::PointCloud queries = ToCloud(queryPoints);
+    const std::size_t q = queryPoints.size();
+    std::cout << "-- nearest of " << points.size() << " points (fits in cache), " << q << " queries --" << std::endl;
+    std::uint64_t legacySum = 0, kernelSum = 0;
+    {
+        Timer timer("Point + calculateDistance loop", q);
+        for (const Point &p : queryPoints)
+            legacySum += LegacyNearest(points, p);
+    }
+    {
+        std::vector<spatial::Neighbor> result;
+        Timer timer("SoA + SIMD squared distances", q);
+        for (std::size_t i = 0; i < q; i++)
+        {
+            spatial::BruteForceKnn(cloud, queries.X(i), queries.Y(i), 1, result);
+            kernelSum += result[0].index;
+        }
+    }
+    std::cout << "  results " << (legacySum == kernelSum ? "identical" : "DIFFER") << std::endl;
+}
+
+// ==========================================
+// 5. ѯKnnBatch / RadiusBatchͬ߳
+// ==========================================
+void BatchQueries(const spatial::KdTree &tree, std::size_t count)
+{
+    const spatial::PointCloud queries = ToCloud(RandomPoints(count, 33));
+    std::cout << "-- " << count << " queries per batch, hardware threads " << std::thread::hardware_concurrency() << " --"
+              << std::endl;
+    std::vector<spatial::Neighbor> reference;
+    {
+        Timer timer("KnnBatch k = 8, serial (no pool)", count);
+        reference = spatial::KnnBatch(tree, queries, 8);
+    }
+    bool same = true;
+    for (unsigned threads : {1u, 2u, 4u, 8u})
+    {
+        ThreadPool pool(threads);
+        spatial::BatchOptions opt{&pool, 256};
+        std::string name = "KnnBatch k = 8, pool of " + std::to_string(threads);
+        {
+            Timer timer(name.c_str(), count);
+            same &= spatial::KnnBatch(tree, queries, 8, opt) == reference;
+        }
+        name = "RadiusBatch r = 2, pool of " + std::to_string(threads);
+        Timer timer(name.c_str(), count);
+        DoNotOptimize(spatial::RadiusBatch(tree, queries, 2.0, opt).indices.size());
+    }
+    std::cout << "  results " << (same ? "identical" : "DIFFER") << " across thread counts" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+    std::cout << "=== 1. Self-check ===" << std::endl;
+    std::cout << "  " << (SelfCheck() ? "k-NN, radius, ties, batches all match brute force" : "MISMATCH") << std::endl;
+
+#if defined(SPATIAL_INDEX_HAS_AVX)
+    const char *kernel = "AVX, 4 lanes";
+#elif defined(SPATIAL_INDEX_HAS_SSE2)
+    const char *kernel = "SSE2, 2 lanes";
+#else
+    const char *kernel = "scalar";
+#endif
+    std::cout << "\n=== 2. " << count << " points, kernel " << kernel << " (Run in Release Mode! -O3) ===" << std::endl;
+    const std::vector<Point> points = RandomPoints(count, 1);
+    spatial::PointCloud cloud;
+    {
+        Timer timer("copy Point[] into PointCloud (SoA)", count);
+        cloud = ToCloud(points);
+    }
+    spatial::KdTree tree;
+    {
+        Timer timer("KdTree bulk build", count);
+        tree.Build(cloud);
+    }
+    std::cout << "  " << tree.NodeCount() << " nodes, leaf size " << spatial::KdTree::kLeafSize << std::endl;
+    SingleQueries(points, cloud, tree);
+    InCacheKernel();
+
+    std::cout << "\n=== 3. Batched queries ===" << std::endl;
+    BatchQueries(tree, std::min<std::size_t>(count, 1000000));
+    return 0;
+}
@@ -0,0 +1,165 @@
+/**
+ * @file PaymentBatch.h
+ * @brief ֧ϵͳ"ȥ黯"ͷţÿһյķѭﴦ
+ * @note Ҫ C++17 (۵ʽ)
+ *
+ * demo.cpp е std::vector<PaymentMethod *> ⣺
+ *   1. ÿ󵥶 newʱָ׷ (Pointer Chasing)ʵ
+ *   2. ͻʱÿ pay() ļתĿ궼ڱ䣬֧Ԥ²
+ * ǣΪ finalͷŽԵ std::vector<T> (ֵ塢ڴ)
+ *  std::vector<CreditCard> ϵ pay() ʱѾ֪ȷͣûᱻֱӵȡ
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace payments
+{
+    //  ( demo  std::cout²ÿʶӡ)
+    struct Ledger
+    {
+        double cardVolume = 0.0; // ÿ˽
+        double cardFees = 0.0;   // ÿ
+        double btcVolume = 0.0;  // رת (BTC)
+        std::size_t genericReceipts = 0;
+        std::size_t blockchainProofs = 0;
+    };
+
+    // ==========================================
+    // 1.  demo.cpp ͬļ̳ϵ (ȥӡΪ)
+    // ==========================================
+    class PaymentMethod
+    {
+    protected:
+        std::string ownerName;
+
+    public:
+        PaymentMethod(std::string name) : ownerName(std::move(name)) {}
+        virtual ~PaymentMethod() = default;
+
+        virtual void pay(double amount, Ledger &ledger) const = 0;
+
+        virtual void printReceipt(Ledger &ledger) const
+        {
+            ledger.genericReceipts++;
+        }
+
+        const std::string &getOwner() const { return ownerName; }
+    };
+
+    // final߱ûи࣬ͨ CreditCard /õÿԱȥ黯
+    class CreditCard final : public PaymentMethod
+    {
+    private:
+        std::string cardNumber;
+
+    public:
+        CreditCard(std::string name, std::string number)
+            : PaymentMethod(std::move(name)), cardNumber(std::move(number)) {}
+
+        void pay(double amount, Ledger &ledger) const override
+        {
+            ledger.cardVolume += amount;
+            ledger.cardFees += amount * 0.029 + 0.30; // 2.9% + 0.30 ˢ
+        }
+    };
+
+    class Bitcoin final : public PaymentMethod
+    {
+    private:
+        std::string walletAddress;
+
+    public:
+        Bitcoin(std::string name, std::string addr)
+            : PaymentMethod(std::move(name)), walletAddress(std::move(addr)) {}
+
+        void pay(double amount, Ledger &ledger) const override
+        {
+            ledger.btcVolume += amount / 50000.0;
+        }
+
+        void printReceipt(Ledger &ledger) const override
+        {
+            ledger.blockchainProofs++;
+        }
+    };
+
+    // ==========================================
+    // 2. ͷĴ洢 (Type-Partitioned Store)
+    // ==========================================
+    // ÿһ std::vector<T>ֵţе new
+    template <typename... Ts>
+    class PartitionedStore
+    {
+    private:
+        std::tuple<std::vector<Ts>...> m_Groups;
+
+    public:
+        template <typename T, typename... Args>
+        T &emplace(Args &&...args)
+        {
+            return std::get<std::vector<T>>(m_Groups).emplace_back(std::forward<Args>(args)...);
+        }
+
+        template <typename T>
+        std::vector<T> &group() { return std::get<std::vector<T>>(m_Groups); }
+
+        template <typename T>
+        const std::vector<T> &group() const { return std::get<std::vector<T>>(m_Groups); }
+
+        template <typename T>
+        void reserve(std::size_t n) { group<T>().reserve(n); }
+
+        std::size_t size() const { return (std::get<std::vector<Ts>>(m_Groups).size() + ... + 0); }
+
+        // ÿ func(const std::vector<T>&)֮Ǳչģʱ
+        template <typename Func>
+        void forEachGroup(Func &&func) const
+        {
+            (func(std::get<std::vector<Ts>>(m_Groups)), ...);
+        }
+
+        void clear() { (std::get<std::vector<Ts>>(m_Groups).clear(), ...); }
+    };
+
+    // ==========================================
+    // 3. ֧
+    // ==========================================
+    class BatchPaymentProcessor
+    {
+    private:
+        PartitionedStore<CreditCard, Bitcoin> m_Store;
+
+    public:
+        template <typename T, typename... Args>
+        T &add(Args &&...args)
+        {
+            return m_Store.emplace<T>(std::forward<Args>(args)...);
+        }
+
+        template <typename T>
+        void reserve(std::size_t n) { m_Store.reserve<T>(n); }
+
+        std::size_t size() const { return m_Store.size(); }
+
+        // ֧ʽִ pay(amount) + printReceipt()
+        // ÿڲһֻԵһ͵ѭûмתÿɱ
+        void processAll(double amount, Ledger &ledger) const
+        {
+            m_Store.forEachGroup([&](const auto &group)
+                                 {
+                for (const auto &method : group)
+                {
+                    method.pay(amount, ledger);
+                    method.printReceipt(ledger);
+                } });
+        }
+
+        void clear() { m_Store.clear(); }
+    };
+} // namespace payments
@@ -0,0 +1,93 @@
+/**
+ * @file batch_benchmark.cpp
+ * @brief 100 ֧std::vector<PaymentMethod *>  vs ͷ
+ * @note : g++ -O3 -std=c++17 batch_benchmark.cpp -o batch_benchmark
+ */
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "PaymentBatch.h"
+#include "../../../23_Benchmarking/Timer.h"
+
+using namespace payments;
+
+constexpr std::size_t kPayments = 1000000;
+constexpr int kRounds = 10;
+
+int main()
+{
+    // ֧ʽ (Լ 50/50)֧Ԥ²һ
+    std::mt19937 rng(42);
+    std::bernoulli_distribution isCard(0.5);
+    std::vector<bool> kinds(kPayments);
+    for (std::size_t i = 0; i < kPayments; i++)
+        kinds[i] = isCard(rng);
+
+    // ==========================================
+    // 1. ԭ棺ָÿ󵥶 new
+    // ==========================================
+    std::vector<PaymentMethod *> wallets;
+    wallets.reserve(kPayments);
+    for (std::size_t i = 0; i < kPayments; i++)
+    {
+        if (kinds[i])
+            wallets.push_back(new CreditCard("Alice", "1234-5678-9012-3456"));
+        else
+            wallets.push_back(new Bitcoin("Bob", "1A1zP1eP5QGefi2DMPTfTL5SLmv7DivfNa"));
+    }
+
+    // ==========================================
+    // 2. ͬĶͷ顢ֵ
+    // ==========================================
+    BatchPaymentProcessor batch;
+    batch.reserve<CreditCard>(kPayments);
+    batch.reserve<Bitcoin>(kPayments);
+    for (std::size_t i = 0; i < kPayments; i++)
+    {
+        if (kinds[i])
+            batch.add<CreditCard>("Alice", "1234-5678-9012-3456");
+        else
+            batch.add<Bitcoin>("Bob", "1A1zP1eP5QGefi2DMPTfTL5SLmv7DivfNa");
+    }
+
+    std::cout << "=== " << kPayments << " payments x " << kRounds << " rounds ===" << std::endl;
+    for (int pass = 0; pass < 2; pass++)
+    {
+        Ledger virtualLedger, batchLedger;
+        {
+            Timer timer("Virtual (vector<PaymentMethod*>)", kPayments * kRounds);
+            for (int r = 0; r < kRounds; r++)
+            {
+                for (const auto *method : wallets)
+                {
+                    method->pay(100.0, virtualLedger);
+                    method->printReceipt(virtualLedger);
+                }
+            }
+            timer.Stop();
+            DoNotOptimize(virtualLedger);
+        }
+        {
+            Timer timer("Batch (type-partitioned)", kPayments * kRounds);
+            for (int r = 0; r < kRounds; r++)
+                batch.processAll(100.0, batchLedger);
+            timer.Stop();
+            DoNotOptimize(batchLedger);
+        }
+
+        // ַʽļ˽һ (ۼ˳ֻͬȽϼ)
+        bool same = virtualLedger.genericReceipts == batchLedger.genericReceipts &&
+                    virtualLedger.blockchainProofs == batchLedger.blockchainProofs;
+        std::cout << "Receipts: " << batchLedger.genericReceipts << " card / "
+                  << batchLedger.blockchainProofs << " btc, results match: " << (same ? "yes" : "NO") << std::endl;
+        std::cout << "--------------------------------" << std::endl;
+    }
+
+    for (auto *method : wallets)
+        delete method;
+    wallets.clear();
+    return 0;
+}
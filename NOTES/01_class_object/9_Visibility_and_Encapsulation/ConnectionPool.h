@@ -0,0 +1,366 @@
+/**
+ * @file ConnectionPool.h
+ * @brief нӳ ConnectionPool<Conn>Ԥȡ/黹ӡ顢աȴʱ
+ * @note Ҫ C++20 ( 17_thread/ConcurrentQueue.h е MpmcQueue) -pthread
+ *
+ * ÿ½һ DBConnection (TCP  + ֤) Ȳѯӳص˼·
+ *   - ԤȽ (Warm-up)黹ǹر
+ *   - ӷ MPMC · (п) Ͻ/黹
+ *   - ޣﵽʱŶӣ acquireTimeout ׳ ConnectionPoolTimeout
+ *   - ǰ飺 maxLifetime ֱӹرؽ̫õ ( SELECT 1)
+ *   - ؿָΪʧܣ׳ ConnectionFactoryErrorӲ
+ *
+ * Էװ֣صʹֻõ PooledConnection ޷ֶ delete ӻƹ黹߼
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../../17_thread/ConcurrentQueue.h"
+
+struct ConnectionPoolOptions
+{
+    std::size_t maxSize = 8;                                      //  ( + )
+    std::size_t warmUp = 4;                                       // ʱԤȽ
+    std::chrono::milliseconds acquireTimeout{1000};               // ûпʱȴ
+    std::chrono::milliseconds maxLifetime{30 * 60 * 1000};        // ʱ䣬ںؽ
+    std::chrono::milliseconds healthCheckAfterIdle{5 * 1000};     // гʱӣǰ
+};
+
+struct ConnectionPoolStats
+{
+    std::uint64_t acquired = 0;
+    std::uint64_t created = 0;
+    std::uint64_t recycledByLifetime = 0;
+    std::uint64_t failedHealthCheck = 0;
+    std::uint64_t brokenReturned = 0;
+    std::uint64_t timeouts = 0;
+    std::uint64_t waited = 0; // ʱҪŶӵȴĴ
+};
+
+class ConnectionPoolTimeout : public std::runtime_error
+{
+public:
+    using std::runtime_error::runtime_error;
+};
+
+// ˿յ unique_ptr (罨ʧʱ쳣Ƿ nullptr)
+class ConnectionFactoryError : public std::runtime_error
+{
+public:
+    using std::runtime_error::runtime_error;
+};
+
+template <typename Conn>
+class ConnectionPool;
+
+// ==========================================
+// 1. PooledConnectionӾ (RAIIʱԶ黹)
+// ==========================================
+template <typename Conn>
+class PooledConnection
+{
+private:
+    friend class ConnectionPool<Conn>;
+    using Entry = typename ConnectionPool<Conn>::Entry;
+
+    ConnectionPool<Conn> *m_Pool = nullptr;
+    Entry *m_Entry = nullptr;
+    bool m_Broken = false;
+
+    PooledConnection(ConnectionPool<Conn> *pool, Entry *entry) : m_Pool(pool), m_Entry(entry) {}
+
+public:
+    PooledConnection() = default;
+    PooledConnection(PooledConnection &&other) noexcept
+        : m_Pool(std::exchange(other.m_Pool, nullptr)), m_Entry(std::exchange(other.m_Entry, nullptr)),
+          m_Broken(other.m_Broken)
+    {
+    }
+    PooledConnection &operator=(PooledConnection &&other) noexcept
+    {
+        if (this != &other)
+        {
+            Release();
+            m_Pool = std::exchange(other.m_Pool, nullptr);
+            m_Entry = std::exchange(other.m_Entry, nullptr);
+            m_Broken = other.m_Broken;
+        }
+        return *this;
+    }
+    PooledConnection(const PooledConnection &) = delete;
+    PooledConnection &operator=(const PooledConnection &) = delete;
+
+    ~PooledConnection() { Release(); }
+
+    Conn *operator->() const { return m_Entry->conn.get(); }
+    Conn &operator*() const { return *m_Entry->conn; }
+    explicit operator bool() const { return m_Entry != nullptr; }
+
+    // ѯзѶϿ黹ʱػֱӹرǷŻؿж
+    void MarkBroken() { m_Broken = true; }
+
+    // ǰ黹
+    void Release()
+    {
+        if (m_Entry)
+            m_Pool->Return(m_Entry, m_Broken);
+        m_Pool = nullptr;
+        m_Entry = nullptr;
+        m_Broken = false;
+    }
+};
+
+// ==========================================
+// 2. ConnectionPool<Conn>
+// ==========================================
+template <typename Conn>
+class ConnectionPool
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    using Factory = std::function<std::unique_ptr<Conn>()>;
+    using HealthCheck = std::function<bool(Conn &)>;
+
+private:
+    friend class PooledConnection<Conn>;
+
+    struct Entry
+    {
+        std::unique_ptr<Conn> conn;
+        Clock::time_point createdAt;
+        Clock::time_point lastUsed;
+    };
+
+    Factory m_Factory;
+    HealthCheck m_HealthCheck;
+    ConnectionPoolOptions m_Options;
+
+    concurrent::MpmcQueue<Entry *> m_Idle; //  >= maxSize黹ʱһŵ
+    std::atomic<std::size_t> m_Total{0};   // Ѵ (ڴ) 
+
+    // ·ûпѴʱŶ
+    std::mutex m_WaitMutex;
+    std::condition_variable m_WaitCv;
+    std::atomic<std::size_t> m_Waiters{0};
+
+    struct AtomicStats
+    {
+        std::atomic<std::uint64_t> acquired{0}, created{0}, recycledByLifetime{0}, failedHealthCheck{0},
+            brokenReturned{0}, timeouts{0}, waited{0};
+    } m_Stats;
+
+    Entry *CreateEntry()
+    {
+        std::unique_ptr<Conn> conn = m_Factory();
+        if (!conn) // ܴ֮ľÿָ
+            throw ConnectionFactoryError("ConnectionPool: factory returned a null connection");
+        m_Stats.created.fetch_add(1, std::memory_order_relaxed);
+        Clock::time_point now = Clock::now();
+        return new Entry{std::move(conn), now, now};
+    }
+
+    void DestroyEntry(Entry *entry)
+    {
+        delete entry;
+        m_Total.fetch_sub(1, std::memory_order_acq_rel);
+        NotifyWaiter(); // ڳһŶӵ߳̿ȥ½
+    }
+
+    void NotifyWaiter()
+    {
+        //  Acquire " m_Waiters + 1 "ԣ֤ᶪʧ
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_Waiters.load(std::memory_order_relaxed) == 0)
+            return;
+        std::lock_guard<std::mutex> lock(m_WaitMutex);
+        m_WaitCv.notify_one();
+    }
+
+    // ǰ飺ڵġйҽʧֱܵӹر
+    bool Validate(Entry *entry)
+    {
+        Clock::time_point now = Clock::now();
+        if (now - entry->createdAt >= m_Options.maxLifetime)
+        {
+            m_Stats.recycledByLifetime.fetch_add(1, std::memory_order_relaxed);
+            DestroyEntry(entry);
+            return false;
+        }
+        if (m_HealthCheck && now - entry->lastUsed >= m_Options.healthCheckAfterIdle && !m_HealthCheck(*entry->conn))
+        {
+            m_Stats.failedHealthCheck.fetch_add(1, std::memory_order_relaxed);
+            DestroyEntry(entry);
+            return false;
+        }
+        return true;
+    }
+
+    // δʱռһ (ֻ CAS)
+    bool TryReserve()
+    {
+        std::size_t total = m_Total.load(std::memory_order_relaxed);
+        while (total < m_Options.maxSize)
+        {
+            if (m_Total.compare_exchange_weak(total, total + 1, std::memory_order_acq_rel))
+                return true;
+        }
+        return false;
+    }
+
+    // Ϊռӣʧ (쳣򷵻ؿָ) ʱ黹
+    Entry *CreateReserved()
+    {
+        try
+        {
+            return CreateEntry();
+        }
+        catch (...)
+        {
+            m_Total.fetch_sub(1, std::memory_order_acq_rel);
+            NotifyWaiter();
+            throw;
+        }
+    }
+
+    // · -> ½ӣз nullptr
+    Entry *TryCheckout()
+    {
+        Entry *entry = nullptr;
+        while (m_Idle.TryPop(entry))
+        {
+            if (Validate(entry))
+                return entry;
+        }
+        if (TryReserve())
+            return CreateReserved();
+        return nullptr;
+    }
+
+    void Return(Entry *entry, bool broken)
+    {
+        if (broken)
+        {
+            m_Stats.brokenReturned.fetch_add(1, std::memory_order_relaxed);
+            DestroyEntry(entry);
+            return;
+        }
+        entry->lastUsed = Clock::now();
+        m_Idle.TryPush(entry); //  >= maxSizeʧ
+        NotifyWaiter();
+    }
+
+public:
+    ConnectionPool(Factory factory, ConnectionPoolOptions options = {}, HealthCheck healthCheck = nullptr)
+        : m_Factory(std::move(factory)), m_HealthCheck(std::move(healthCheck)), m_Options(options),
+          m_Idle(options.maxSize)
+    {
+        if (!m_Factory)
+            throw std::invalid_argument("ConnectionPool: factory is empty");
+        // Ԥȣʱͽӣһóеӳ١
+        // ȫ֮ǰɾֲ unique_ptr У; m_Factory 쳣ʱ캯ʧܡУ
+        // Ѿõӿͷţ m_Idle й©
+        std::size_t warm = std::min(m_Options.warmUp, m_Options.maxSize);
+        std::vector<std::unique_ptr<Entry>> warmed;
+        warmed.reserve(warm); // ֮ push_back ٷ䣬CreateEntry صָ벻ᶪ
+        for (std::size_t i = 0; i < warm; i++)
+            warmed.push_back(std::unique_ptr<Entry>(CreateEntry()));
+        for (std::unique_ptr<Entry> &entry : warmed)
+            m_Idle.TryPush(entry.release());
+        m_Total.store(warm, std::memory_order_relaxed);
+    }
+
+    // ǰ PooledConnection Ѿ黹
+    ~ConnectionPool()
+    {
+        Entry *entry = nullptr;
+        while (m_Idle.TryPop(entry))
+            delete entry;
+    }
+
+    ConnectionPool(const ConnectionPool &) = delete;
+    ConnectionPool &operator=(const ConnectionPool &) = delete;
+
+    // һӣʱ׳ ConnectionPoolTimeoutҪ½Ӷؿָʱ׳ ConnectionFactoryError
+    PooledConnection<Conn> Acquire() { return Acquire(m_Options.acquireTimeout); }
+
+    PooledConnection<Conn> Acquire(std::chrono::milliseconds timeout)
+    {
+        Clock::time_point deadline = Clock::now() + timeout;
+        bool counted = false;
+        while (true)
+        {
+            // ·
+            if (Entry *entry = TryCheckout())
+            {
+                m_Stats.acquired.fetch_add(1, std::memory_order_relaxed);
+                return PooledConnection<Conn>(this, entry);
+            }
+
+            // ·Ŷӵȴ黹ֻ"ȡ""ռ"ӡ鶼ŵ
+            if (!counted)
+            {
+                m_Stats.waited.fetch_add(1, std::memory_order_relaxed);
+                counted = true;
+            }
+            Entry *idle = nullptr;
+            bool reserved = false;
+            {
+                std::unique_lock<std::mutex> lock(m_WaitMutex);
+                m_Waiters.fetch_add(1, std::memory_order_seq_cst);
+                bool ok = m_WaitCv.wait_until(lock, deadline, [&]
+                                              { return m_Idle.TryPop(idle) || (reserved = TryReserve()); });
+                m_Waiters.fetch_sub(1, std::memory_order_relaxed);
+                if (!ok)
+                {
+                    m_Stats.timeouts.fetch_add(1, std::memory_order_relaxed);
+                    throw ConnectionPoolTimeout("ConnectionPool: acquire timed out");
+                }
+            }
+            Entry *entry = reserved ? CreateReserved() : (Validate(idle) ? idle : nullptr);
+            if (entry)
+            {
+                m_Stats.acquired.fetch_add(1, std::memory_order_relaxed);
+                return PooledConnection<Conn>(this, entry);
+            }
+            // ȡĿʧЧ (ѱرղڳ)ص·
+        }
+    }
+
+    // ȴûпʱؿվ½ʧʱ Acquire һ׳쳣
+    PooledConnection<Conn> TryAcquire()
+    {
+        Entry *entry = TryCheckout();
+        if (entry)
+            m_Stats.acquired.fetch_add(1, std::memory_order_relaxed);
+        return PooledConnection<Conn>(this, entry);
+    }
+
+    std::size_t TotalConnections() const { return m_Total.load(std::memory_order_relaxed); }
+    const ConnectionPoolOptions &Options() const { return m_Options; }
+
+    ConnectionPoolStats Stats() const
+    {
+        ConnectionPoolStats s;
+        s.acquired = m_Stats.acquired.load(std::memory_order_relaxed);
+        s.created = m_Stats.created.load(std::memory_order_relaxed);
+        s.recycledByLifetime = m_Stats.recycledByLifetime.load(std::memory_order_relaxed);
+        s.failedHealthCheck = m_Stats.failedHealthCheck.load(std::memory_order_relaxed);
+        s.brokenReturned = m_Stats.brokenReturned.load(std::memory_order_relaxed);
+        s.timeouts = m_Stats.timeouts.load(std::memory_order_relaxed);
+        s.waited = m_Stats.waited.load(std::memory_order_relaxed);
+        return s;
+    }
+};
@@ -33,6 +33,7 @@ public:
     // Public: ӿ
     std::string dbName; // ҲԱ¶һЩǹؼ
 
+    // ˿дΪ 3306ÿʹöҪ connect()ö˿ + Ӹü ConnectionPool.h / pool_benchmark.cpp
     DBConnection(std::string name, std::string key)
         : dbName(name), secretKey(key), port(3306), connectionState("READY") {}
 
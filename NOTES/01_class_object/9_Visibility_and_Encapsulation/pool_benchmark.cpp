@@ -0,0 +1,336 @@
+/**
+ * @file pool_benchmark.cpp
+ * @brief ÿ½ DBConnection vs ConnectionPool<DBConnection>µĻȡӳ (p50 / p99)Լʱաʾ
+ * @note : g++ -O2 -std=c++20 -pthread pool_benchmark.cpp -o pool_benchmark
+ *       ǽڵ FakeDatabaseӵӳٿãҪʵ MySQL
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ConnectionPool.h"
+
+using namespace std::chrono_literals;
+using Clock = std::chrono::steady_clock;
+
+// ==========================================
+// 1. ڵļݿ
+// ==========================================
+class FakeDatabase
+{
+private:
+    std::chrono::microseconds m_ConnectLatency;
+    std::atomic<int> m_Generation{0}; // ÿ Restart() +1ȫʧЧ
+    std::atomic<int> m_Handshakes{0};
+
+public:
+    explicit FakeDatabase(std::chrono::microseconds connectLatency) : m_ConnectLatency(connectLatency) {}
+
+    // ģ TCP  + ֤ر""
+    int Handshake()
+    {
+        std::this_thread::sleep_for(m_ConnectLatency);
+        m_Handshakes++;
+        return m_Generation.load();
+    }
+
+    bool IsAlive(int generation) const { return generation == m_Generation.load(); }
+    void Restart() { m_Generation++; }
+    int Handshakes() const { return m_Handshakes.load(); }
+};
+
+// ==========================================
+// 2. DBConnectiondemo.cpp ͬ""汾
+// ==========================================
+// ˿ڲдΪ 3306״̬ enum class ַɼԹ demo.cpp ͬ
+struct ConnectionConfig
+{
+    std::string dbName;
+    std::string secretKey;
+    int port = 3306;
+};
+
+class DBConnection
+{
+public:
+    enum class State
+    {
+        Ready,
+        Connected,
+        Broken
+    };
+
+private:
+    ConnectionConfig config; // Կⲿɼ
+    FakeDatabase &backend;
+    int generation = -1;
+
+protected:
+    State connectionState = State::Ready;
+
+public:
+    DBConnection(ConnectionConfig cfg, FakeDatabase &db) : config(std::move(cfg)), backend(db)
+    {
+        generation = backend.Handshake();
+        connectionState = State::Connected;
+    }
+
+    //  (൱ SELECT 1)
+    bool Ping() const { return connectionState == State::Connected && backend.IsAlive(generation); }
+
+    // ģһβѯʱʧЧ
+    bool Query(std::chrono::microseconds work)
+    {
+        if (!backend.IsAlive(generation))
+        {
+            connectionState = State::Broken;
+            return false;
+        }
+        std::this_thread::sleep_for(work);
+        return true;
+    }
+
+    State GetState() const { return connectionState; }
+    int GetPort() const { return config.port; }
+};
+
+// ==========================================
+// 3. ӳͳ
+// ==========================================
+struct LatencyReport
+{
+    double p50Us, p99Us, maxUs;
+};
+
+LatencyReport Summarize(std::vector<double> samples)
+{
+    std::sort(samples.begin(), samples.end());
+    auto at = [&](double p) { return samples[static_cast<std::size_t>(p * (samples.size() - 1))]; };
+    return {at(0.50), at(0.99), samples.back()};
+}
+
+void PrintReport(const char *name, int threads, const LatencyReport &r)
+{
+    std::cout << "  " << std::left << std::setw(26) << name << std::right << " threads " << std::setw(2) << threads
+              << " | acquire p50 " << std::setw(9) << std::fixed << std::setprecision(1) << r.p50Us << " us"
+              << " | p99 " << std::setw(9) << r.p99Us << " us | max " << std::setw(9) << r.maxUs << " us"
+              << std::defaultfloat << std::setprecision(6) << std::endl;
+}
+
+constexpr auto kConnectLatency = 2000us; // һ 2ms
+constexpr auto kQueryTime = 100us;       // һβѯ 0.1ms
+constexpr int kRequestsPerThread = 200;
+
+// ÿ½һ (൱ demo.cpp ÷)
+LatencyReport RunWithoutPool(FakeDatabase &db, int threadCount)
+{
+    std::vector<std::vector<double>> perThread(threadCount);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++)
+        threads.emplace_back([&, t]
+                             {
+            for (int i = 0; i < kRequestsPerThread; i++)
+            {
+                auto start = Clock::now();
+                DBConnection conn({"UserDB", "xk8-29a-vz1", 3306}, db);
+                perThread[t].push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+                conn.Query(kQueryTime);
+            } });
+    for (auto &t : threads)
+        t.join();
+    std::vector<double> all;
+    for (auto &v : perThread)
+        all.insert(all.end(), v.begin(), v.end());
+    return Summarize(std::move(all));
+}
+
+LatencyReport RunWithPool(ConnectionPool<DBConnection> &pool, int threadCount)
+{
+    std::vector<std::vector<double>> perThread(threadCount);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++)
+        threads.emplace_back([&, t]
+                             {
+            for (int i = 0; i < kRequestsPerThread; i++)
+            {
+                auto start = Clock::now();
+                PooledConnection<DBConnection> conn = pool.Acquire();
+                perThread[t].push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+                if (!conn->Query(kQueryTime))
+                    conn.MarkBroken();
+            } });
+    for (auto &t : threads)
+        t.join();
+    std::vector<double> all;
+    for (auto &v : perThread)
+        all.insert(all.end(), v.begin(), v.end());
+    return Summarize(std::move(all));
+}
+
+void PrintStats(const ConnectionPool<DBConnection> &pool)
+{
+    ConnectionPoolStats s = pool.Stats();
+    std::cout << "  stats: acquired " << s.acquired << ", created " << s.created << ", waited " << s.waited
+              << ", timeouts " << s.timeouts << ", recycled(lifetime) " << s.recycledByLifetime
+              << ", failed health check " << s.failedHealthCheck << ", broken returned " << s.brokenReturned
+              << ", open " << pool.TotalConnections() << std::endl;
+}
+
+// ==========================================
+// 4. ʧܣԤ;쳣ʱѾõӱ뱻ͷţؿָʱʧܲ黹
+// ==========================================
+struct CountedConnection
+{
+    static inline int s_Live = 0;
+    CountedConnection() { s_Live++; }
+    ~CountedConnection() { s_Live--; }
+};
+
+void TestWarmUpFailure()
+{
+    int attempts = 0;
+    auto flakyFactory = [&attempts]
+    {
+        if (++attempts == 3)
+            throw std::runtime_error("handshake failed");
+        return std::make_unique<CountedConnection>();
+    };
+    ConnectionPoolOptions options;
+    options.maxSize = 4;
+    options.warmUp = 4;
+    try
+    {
+        ConnectionPool<CountedConnection> pool(flakyFactory, options);
+    }
+    catch (const std::runtime_error &e)
+    {
+        std::cout << "  constructor threw: " << e.what() << std::endl;
+    }
+    std::cout << "  live connections after failed warm-up: " << CountedConnection::s_Live
+              << (CountedConnection::s_Live == 0 ? " (none leaked)" : " (LEAKED)") << std::endl;
+}
+
+void TestNullFactory()
+{
+    bool failing = true;
+    auto nullFactory = [&failing]
+    { return failing ? std::unique_ptr<CountedConnection>() : std::make_unique<CountedConnection>(); };
+    ConnectionPoolOptions options;
+    options.maxSize = 1;
+    options.warmUp = 0;
+    ConnectionPool<CountedConnection> pool(nullFactory, options);
+    int errors = 0;
+    for (int i = 0; i < 2; i++)
+    {
+        try
+        {
+            auto conn = i == 0 ? pool.Acquire(10ms) : pool.TryAcquire();
+        }
+        catch (const ConnectionFactoryError &)
+        {
+            errors++;
+        }
+    }
+    failing = false; // ѹ黹ָܽ赽
+    bool recovered = static_cast<bool>(pool.Acquire(10ms));
+    std::cout << "  null factory: " << errors << "/2 acquires threw ConnectionFactoryError, "
+              << (recovered && pool.Stats().created == 1 ? "OK (slot returned, pool recovered)" : "FAILED") << std::endl;
+
+    try
+    {
+        options.warmUp = 1;
+        ConnectionPool<CountedConnection> warm([] { return std::unique_ptr<CountedConnection>(); }, options);
+    }
+    catch (const ConnectionFactoryError &e)
+    {
+        std::cout << "  null factory during warm-up: " << e.what() << std::endl;
+    }
+}
+
+int main()
+{
+    FakeDatabase db(kConnectLatency);
+    auto factory = [&db] { return std::make_unique<DBConnection>(ConnectionConfig{"UserDB", "xk8-29a-vz1", 3306}, db); };
+    auto healthCheck = [](DBConnection &c) { return c.Ping(); };
+
+    std::cout << "=== 1. Acquire latency (connect " << kConnectLatency.count() << " us, query " << kQueryTime.count()
+              << " us, " << kRequestsPerThread << " requests/thread) ===" << std::endl;
+    for (int threads : {1, 4, 16, 32})
+    {
+        PrintReport("new DBConnection/request", threads, RunWithoutPool(db, threads));
+
+        ConnectionPoolOptions options;
+        options.maxSize = 8;
+        options.warmUp = 8;
+        auto warmStart = Clock::now();
+        ConnectionPool<DBConnection> pool(factory, options, healthCheck);
+        double warmMs = std::chrono::duration<double, std::milli>(Clock::now() - warmStart).count();
+        PrintReport("ConnectionPool (max 8)", threads, RunWithPool(pool, threads));
+        std::cout << "  (warm-up of " << options.warmUp << " connections took " << warmMs << " ms)" << std::endl;
+        PrintStats(pool);
+    }
+
+    std::cout << "\n=== 2. Wait-queue timeout ===" << std::endl;
+    {
+        ConnectionPoolOptions options;
+        options.maxSize = 2;
+        options.warmUp = 2;
+        ConnectionPool<DBConnection> pool(factory, options, healthCheck);
+        auto a = pool.Acquire();
+        auto b = pool.Acquire();
+        auto start = Clock::now();
+        try
+        {
+            auto c = pool.Acquire(20ms);
+        }
+        catch (const ConnectionPoolTimeout &e)
+        {
+            double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            std::cout << "  third Acquire: " << e.what() << " after " << ms << " ms" << std::endl;
+        }
+        // һ߳Ժ黹ȴ߱
+        std::thread releaser([&] { std::this_thread::sleep_for(5ms); a.Release(); });
+        start = Clock::now();
+        auto c = pool.Acquire(100ms);
+        double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        std::cout << "  Acquire while another thread returns after 5 ms: got it after " << ms << " ms" << std::endl;
+        releaser.join();
+    }
+
+    std::cout << "\n=== 3. Max-lifetime recycling and health checks ===" << std::endl;
+    {
+        ConnectionPoolOptions options;
+        options.maxSize = 4;
+        options.warmUp = 4;
+        options.maxLifetime = 30ms;
+        options.healthCheckAfterIdle = 0ms; // ÿν
+        ConnectionPool<DBConnection> pool(factory, options, healthCheck);
+        for (int i = 0; i < 4; i++)
+            pool.Acquire()->Query(kQueryTime);
+        std::this_thread::sleep_for(40ms); // ӳ
+        pool.Acquire()->Query(kQueryTime);
+        PrintStats(pool);
+
+        db.Restart(); // ݿʣµȫʧЧ
+        auto conn = pool.Acquire();
+        std::cout << "  after backend restart, acquired connection is alive: " << std::boolalpha << conn->Ping()
+                  << std::endl;
+        conn.Release();
+        PrintStats(pool);
+    }
+
+    std::cout << "\n=== 4. Connection factory failures ===" << std::endl;
+    TestWarmUpFailure();
+    TestNullFactory();
+
+    std::cout << "\nTotal handshakes performed by the fake backend: " << db.Handshakes() << std::endl;
+    return 0;
+}
@@ -0,0 +1,354 @@
+/**
+ * @file LruCache.h
+ * @brief ̰߳ȫķƬ LRU  LruCache<K, V> 뺯仯װ Memoized<F>
+ * @note Ҫ C++17
+ *
+ * demo.cpp  BigDataCalculator  mutable cachedResult / isCached / accessCount ʵֻ棬⣺
+ *   1. ߳ͬʱͬһ const  getComplexResult()Ƕ mutable Աݾ
+ *   2. ֻܻ"һ"
+ * "߼ + mutable "ɿɸõ
+ *   -  key ĹϣֳɷƬ (Shard)ÿƬһͬƬķʻ
+ *   -  (Single-Flight)߳ͬʱδͬһ key ʱֻеһ̼߳㣬̵߳ȴĽ
+ *   - ѡ TTL (ʱ)Լ /δ/̭/ 
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cache
+{
+    struct CacheStats
+    {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;      // ں¼
+        std::uint64_t evictions = 0;   // ʱ LRU ̭
+        std::uint64_t expirations = 0; //  TTL ڱ
+        std::uint64_t computations = 0; // GetOrCompute ʵʵü㺯Ĵ (Чʱ < misses)
+
+        double HitRate() const
+        {
+            std::uint64_t total = hits + misses;
+            return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+        }
+    };
+
+    // ==========================================
+    // 1. LruCache<K, V>Ƭ +  + TTL
+    // ==========================================
+    template <typename K, typename V, typename Hash = std::hash<K>>
+    class LruCache
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+        using Duration = Clock::duration;
+
+    private:
+        struct Entry
+        {
+            K key;
+            V value;
+            Clock::time_point expiresAt;
+        };
+
+        // ڼе key߳õͬһ shared_future Ƚ
+        struct Flight
+        {
+            std::promise<V> promise;
+            std::shared_future<V> result = promise.get_future().share();
+        };
+
+        struct alignas(64) Shard
+        {
+            std::mutex mutex;
+            std::list<Entry> lru; // ͷ = ʹ
+            std::unordered_map<K, typename std::list<Entry>::iterator, Hash> index;
+            std::unordered_map<K, std::shared_ptr<Flight>, Hash> inFlight;
+            CacheStats stats;
+        };
+
+        std::size_t m_ShardCapacity;
+        Duration m_Ttl; // Duration::zero() ʾ
+        Hash m_Hash;
+        std::vector<std::unique_ptr<Shard>> m_Shards;
+
+        Shard &ShardFor(const K &key) const
+        {
+            // ϣֵٽһΣ std::hash<int> ȹϣ key ͬһƬĹ̶ģʽ
+            std::uint64_t h = static_cast<std::uint64_t>(m_Hash(key)) * 0x9E3779B97F4A7C15ull;
+            return *m_Shards[(h >> 32) % m_Shards.size()];
+        }
+
+        bool IsExpired(const Entry &entry, Clock::time_point now) const
+        {
+            return m_Ttl != Duration::zero() && now >= entry.expiresAt;
+        }
+
+        //  *Locked Ҫѳ shard.mutex
+        std::optional<V> LookupLocked(Shard &shard, const K &key)
+        {
+            auto it = shard.index.find(key);
+            if (it == shard.index.end())
+                return std::nullopt;
+            if (IsExpired(*it->second, Clock::now()))
+            {
+                shard.lru.erase(it->second);
+                shard.index.erase(it);
+                shard.stats.expirations++;
+                return std::nullopt;
+            }
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second); // ƵͷO(1)Ԫ
+            return it->second->value;
+        }
+
+        void InsertLocked(Shard &shard, const K &key, V value)
+        {
+            Clock::time_point expiresAt = (m_Ttl == Duration::zero()) ? Clock::time_point::max() : Clock::now() + m_Ttl;
+            auto it = shard.index.find(key);
+            if (it != shard.index.end())
+            {
+                it->second->value = std::move(value);
+                it->second->expiresAt = expiresAt;
+                shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+                return;
+            }
+            if (shard.lru.size() >= m_ShardCapacity)
+            {
+                shard.index.erase(shard.lru.back().key); // ̭δʹõ
+                shard.lru.pop_back();
+                shard.stats.evictions++;
+            }
+            shard.lru.push_front(Entry{key, std::move(value), expiresAt});
+            shard.index.emplace(key, shard.lru.begin());
+        }
+
+    public:
+        // capacity ΪƽֵƬshardCount = 1 ʱһȫͨ LRU
+        explicit LruCache(std::size_t capacity, std::size_t shardCount = 16, Duration ttl = Duration::zero())
+            : m_ShardCapacity(std::max<std::size_t>(1, (capacity + shardCount - 1) / std::max<std::size_t>(1, shardCount))),
+              m_Ttl(ttl)
+        {
+            shardCount = std::max<std::size_t>(1, shardCount);
+            m_Shards.reserve(shardCount);
+            for (std::size_t i = 0; i < shardCount; i++)
+                m_Shards.push_back(std::make_unique<Shard>());
+        }
+
+        LruCache(const LruCache &) = delete;
+        LruCache &operator=(const LruCache &) = delete;
+
+        std::optional<V> Get(const K &key)
+        {
+            Shard &shard = ShardFor(key);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            std::optional<V> value = LookupLocked(shard, key);
+            if (value)
+                shard.stats.hits++;
+            else
+                shard.stats.misses++;
+            return value;
+        }
+
+        void Put(const K &key, V value)
+        {
+            Shard &shard = ShardFor(key);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            InsertLocked(shard, key, std::move(value));
+        }
+
+        // ֱӷأδʱ compute() 㲢档
+        // compute ִ (ͬһƬ key)ͬһ key ͬʱֻһΡ
+        // compute ׳쳣ᴫеȴ key ̣߳ҽᱻ
+        template <typename Compute>
+        V GetOrCompute(const K &key, Compute &&compute)
+        {
+            Shard &shard = ShardFor(key);
+            std::shared_ptr<Flight> flight;
+            std::shared_future<V> pendingResult;
+            {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                if (std::optional<V> value = LookupLocked(shard, key))
+                {
+                    shard.stats.hits++;
+                    return std::move(*value);
+                }
+                shard.stats.misses++;
+
+                auto pending = shard.inFlight.find(key);
+                if (pending != shard.inFlight.end())
+                {
+                    pendingResult = pending->second->result; // ߳㣺ͷ֮ٵȴ
+                }
+                else
+                {
+                    flight = std::make_shared<Flight>();
+                    shard.inFlight.emplace(key, flight);
+                    shard.stats.computations++;
+                }
+            }
+            if (pendingResult.valid())
+                return pendingResult.get();
+
+            try
+            {
+                V value = compute();
+                {
+                    std::lock_guard<std::mutex> lock(shard.mutex);
+                    InsertLocked(shard, key, value);
+                    shard.inFlight.erase(key);
+                }
+                flight->promise.set_value(value);
+                return value;
+            }
+            catch (...)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(shard.mutex);
+                    shard.inFlight.erase(key);
+                }
+                flight->promise.set_exception(std::current_exception());
+                throw;
+            }
+        }
+
+        bool Erase(const K &key)
+        {
+            Shard &shard = ShardFor(key);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto it = shard.index.find(key);
+            if (it == shard.index.end())
+                return false;
+            shard.lru.erase(it->second);
+            shard.index.erase(it);
+            return true;
+        }
+
+        void Clear()
+        {
+            for (auto &shard : m_Shards)
+            {
+                std::lock_guard<std::mutex> lock(shard->mutex);
+                shard->lru.clear();
+                shard->index.clear();
+            }
+        }
+
+        std::size_t Size() const
+        {
+            std::size_t total = 0;
+            for (auto &shard : m_Shards)
+            {
+                std::lock_guard<std::mutex> lock(shard->mutex);
+                total += shard->lru.size();
+            }
+            return total;
+        }
+
+        CacheStats Stats() const
+        {
+            CacheStats total;
+            for (auto &shard : m_Shards)
+            {
+                std::lock_guard<std::mutex> lock(shard->mutex);
+                total.hits += shard->stats.hits;
+                total.misses += shard->stats.misses;
+                total.evictions += shard->stats.evictions;
+                total.expirations += shard->stats.expirations;
+                total.computations += shard->stats.computations;
+            }
+            return total;
+        }
+
+        std::size_t ShardCount() const { return m_Shards.size(); }
+    };
+
+    // ==========================================
+    // 2. Memoized<F>Ѵװ"ĺ"
+    // ==========================================
+    //  std::tuple Ϊ keyҪһ tuple ϣ
+    struct TupleHash
+    {
+        template <typename... Ts>
+        std::size_t operator()(const std::tuple<Ts...> &t) const
+        {
+            std::size_t seed = 0;
+            std::apply([&](const auto &...parts)
+                       { ((seed ^= std::hash<std::decay_t<decltype(parts)>>{}(parts) + 0x9E3779B9 + (seed << 6) + (seed >> 2)), ...); },
+                       t);
+            return seed;
+        }
+    };
+
+    namespace detail
+    {
+        // Ӻָ / ģ operator()  Lambda Ƶ R(Args...)
+        template <typename F>
+        struct CallableTraits : CallableTraits<decltype(&F::operator())>
+        {
+        };
+        template <typename R, typename... Args>
+        struct CallableTraits<R (*)(Args...)>
+        {
+            using Result = R;
+            using Key = std::tuple<std::decay_t<Args>...>;
+        };
+        template <typename C, typename R, typename... Args>
+        struct CallableTraits<R (C::*)(Args...) const> : CallableTraits<R (*)(Args...)>
+        {
+        };
+        template <typename C, typename R, typename... Args>
+        struct CallableTraits<R (C::*)(Args...)> : CallableTraits<R (*)(Args...)>
+        {
+        };
+    } // namespace detail
+
+    template <typename F>
+    class Memoized
+    {
+    private:
+        using Traits = detail::CallableTraits<F>;
+        using Key = typename Traits::Key;
+        using Result = typename Traits::Result;
+
+        F m_Func;
+        //  BigDataCalculator ͬ˼· mutable ģoperator()  const
+        //  LruCache ڲԴԶ߳ͬʱͬһ const Memoized ǰȫ
+        mutable LruCache<Key, Result, TupleHash> m_Cache;
+
+    public:
+        explicit Memoized(F func, std::size_t capacity = 1024, std::size_t shardCount = 16,
+                          typename LruCache<Key, Result, TupleHash>::Duration ttl = {})
+            : m_Func(std::move(func)), m_Cache(capacity, shardCount, ttl)
+        {
+        }
+
+        template <typename... Args>
+        Result operator()(Args &&...args) const
+        {
+            Key key(std::forward<Args>(args)...);
+            return m_Cache.GetOrCompute(key, [&] { return std::apply(m_Func, key); });
+        }
+
+        CacheStats Stats() const { return m_Cache.Stats(); }
+        void Invalidate() { m_Cache.Clear(); }
+    };
+
+    template <typename F>
+    Memoized(F) -> Memoized<F>;
+    template <typename F>
+    Memoized(F, std::size_t) -> Memoized<F>;
+} // namespace cache
@@ -23,6 +23,9 @@ private:
     // /ͳ
     mutable int accessCount;
 
+    // ע⣺ mutable Աûκͬ߳ͬʱ getComplexResult() ݾ
+    // ֻܻһ̰߳ȫɻİ汾 LruCache.h / memo_cache_benchmark.cpp
+
 public:
 
     //ʼб
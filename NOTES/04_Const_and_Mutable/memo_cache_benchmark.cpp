@@ -0,0 +1,173 @@
+/**
+ * @file memo_cache_benchmark.cpp
+ * @brief ̰߳ȫ mutable 棺ɡTTLMemoized ʾԼ 1~32 ߳µ LRU vs Ƭ LRU ò
+ * @note : g++ -O3 -std=c++17 -pthread memo_cache_benchmark.cpp -o memo_cache_benchmark
+ */
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "LruCache.h"
+#include "../23_Benchmarking/Timer.h"
+
+using namespace std::chrono_literals;
+
+// ==========================================
+// 1. BigDataCalculator ̰߳ȫ汾
+// ==========================================
+//  demo.cpp ͬgetComplexResult()  const ģ mutable ġ
+// ͬ㣺ԴԻ룬߳ͬʱͬһ const Ҳûݾ
+class ConcurrentCalculator
+{
+private:
+    int factor;
+    mutable cache::LruCache<int, long long> cache{1024};
+    mutable std::atomic<int> heavyRuns{0};
+
+public:
+    explicit ConcurrentCalculator(int f) : factor(f) {}
+
+    long long getComplexResult(int input) const
+    {
+        return cache.GetOrCompute(input, [&]
+                                  {
+            heavyRuns++;
+            std::this_thread::sleep_for(1ms); // ģʱ
+            return static_cast<long long>(input) * input * factor; });
+    }
+
+    int getHeavyRuns() const { return heavyRuns.load(); }
+    cache::CacheStats getStats() const { return cache.Stats(); }
+};
+
+void PrintStats(const char *label, const cache::CacheStats &s)
+{
+    std::cout << "  " << label << ": hits " << s.hits << ", misses " << s.misses << ", computations "
+              << s.computations << ", evictions " << s.evictions << ", expirations " << s.expirations
+              << ", hit rate " << std::fixed << std::setprecision(1) << s.HitRate() * 100 << "%" << std::defaultfloat
+              << std::setprecision(6) << std::endl;
+}
+
+void DemoConstObject()
+{
+    std::cout << "=== 1. const object shared by 8 threads ===" << std::endl;
+    const ConcurrentCalculator calc(10);
+    std::vector<std::thread> threads;
+    std::atomic<long long> checksum{0};
+    for (int t = 0; t < 8; t++)
+        threads.emplace_back([&]
+                             {
+            for (int i = 0; i < 100; i++)
+                checksum += calc.getComplexResult(i % 20); });
+    for (auto &t : threads)
+        t.join();
+    std::cout << "  800 calls over 20 distinct inputs -> heavy computations: " << calc.getHeavyRuns() << std::endl;
+    PrintStats("stats", calc.getStats());
+}
+
+// ==========================================
+// 2. ɣ16 ߳ͬʱͬһδ key
+// ==========================================
+void DemoSingleFlight()
+{
+    std::cout << "\n=== 2. Single-flight (16 concurrent misses on one key) ===" << std::endl;
+    cache::LruCache<std::string, int> config(64);
+    std::atomic<int> loads{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 16; t++)
+        threads.emplace_back([&]
+                             { config.GetOrCompute("max_connections", [&]
+                                                   {
+                loads++;
+                std::this_thread::sleep_for(50ms); // ģݿ / Զ̷
+                return 128; }); });
+    for (auto &t : threads)
+        t.join();
+    std::cout << "  loader ran " << loads.load() << " time(s)" << std::endl;
+    PrintStats("stats", config.Stats());
+}
+
+// ==========================================
+// 3. TTL  Memoized
+// ==========================================
+void DemoTtlAndMemoized()
+{
+    std::cout << "\n=== 3. TTL + Memoized<F> ===" << std::endl;
+    cache::LruCache<int, int> session(16, 1, 20ms);
+    session.Put(1, 100);
+    std::cout << "  Get(1) right away: " << (session.Get(1) ? "hit" : "miss") << std::endl;
+    std::this_thread::sleep_for(30ms);
+    std::cout << "  Get(1) after 30ms (ttl 20ms): " << (session.Get(1) ? "hit" : "miss") << std::endl;
+    PrintStats("session", session.Stats());
+
+    std::atomic<int> calls{0};
+    const cache::Memoized distance([&](int x, int y)
+                                   {
+        calls++;
+        return x * x + y * y; });
+    long long sum = 0;
+    for (int round = 0; round < 3; round++)
+        for (int x = 0; x < 10; x++)
+            sum += distance(x, x + 1);
+    std::cout << "  Memoized: 30 calls, underlying function ran " << calls.load() << " times (sum " << sum << ")"
+              << std::endl;
+}
+
+// ==========================================
+// 4. òԣȫ vs 16 Ƭ
+// ==========================================
+constexpr int kOpsPerThread = 200000;
+constexpr int kKeySpace = 8192;
+constexpr std::size_t kCapacity = 4096;
+
+void RunContention(const char *name, std::size_t shards, int threadCount)
+{
+    cache::LruCache<int, long long> lru(kCapacity, shards);
+    std::vector<std::thread> threads;
+    std::size_t totalOps = static_cast<std::size_t>(kOpsPerThread) * threadCount;
+
+    Timer timer(name, totalOps);
+    for (int t = 0; t < threadCount; t++)
+        threads.emplace_back([&lru, t]
+                             {
+            std::mt19937 rng(t + 1);
+            // 80% ķ 20% ȵ key  (ӽʵķʷֲ)
+            std::uniform_int_distribution<int> hot(0, kKeySpace / 5 - 1), cold(0, kKeySpace - 1), coin(0, 9);
+            long long sink = 0;
+            for (int i = 0; i < kOpsPerThread; i++)
+            {
+                int key = coin(rng) < 8 ? hot(rng) : cold(rng);
+                sink += lru.GetOrCompute(key, [key] { return static_cast<long long>(key) * key; });
+            }
+            DoNotOptimize(sink); });
+    for (auto &t : threads)
+        t.join();
+    double us = timer.Stop();
+    cache::CacheStats s = lru.Stats();
+    std::cout << "    -> " << std::fixed << std::setprecision(2) << totalOps / us << " Mops/s, hit rate "
+              << std::setprecision(1) << s.HitRate() * 100 << "%" << std::defaultfloat << std::setprecision(6)
+              << std::endl;
+}
+
+int main()
+{
+    DemoConstObject();
+    DemoSingleFlight();
+    DemoTtlAndMemoized();
+
+    std::cout << "\n=== 4. Contention (" << kOpsPerThread << " GetOrCompute per thread, hardware threads "
+              << std::thread::hardware_concurrency() << ", Run in Release Mode! -O3) ===" << std::endl;
+    for (int threads : {1, 2, 4, 8, 16, 32})
+    {
+        std::cout << "-- " << threads << " thread(s) --" << std::endl;
+        RunContention("LruCache, 1 shard (global lock)", 1, threads);
+        RunContention("LruCache, 16 shards", 16, threads);
+    }
+    return 0;
+}
@@ -0,0 +1,397 @@
+/**
+ * @file StructLayout.h
+ * @brief ""Ľṹ岼ַǼֶαڱС롢ֽڡ绺еֶΡ
+ *        /ֶηֲ static_assert Ԥ飬ɽֶ˳
+ * @note Ҫ C++20 (constexpr std::array ָʼ)offsetof ԷǱ׼ (麯̳) 
+ *       "֧"ģGCC / Clang / MSVC û̳ʱ֧֣ͷļڵǼǴ -Winvalid-offsetof
+ *
+ * arrow.md  PrintOffsets()  &((Vector3*)nullptr)->x ֹӡһṹƫɿɸõĹߣ
+ *   -  LAYOUT_REGISTER Ǽֶα (֡ƫơС롢/)ƫԱ׼ offsetof
+ *   - layout::Analyze<T>()  constexpr ģֱд static_assertֶ˳򱻸Ļʱʧ
+ *   - layout::Suggest<T>() ģŲ򣬱Ƚϼֺѡ˳򣬷ֶλ١Сһ
+ * ûеǼǵĳԱᱻ䣬ֶαҪඨ屣ͬ (Analyze ֶԽص)
+ * صͳƼӻ㿪ʼ (Ԫأ alignas(64) )
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+namespace layout
+{
+    inline constexpr std::size_t kCacheLine = 64;
+
+    // ֶαǣkHot / kCold ѡһkPinned ʾλòɱ (ָ롢ӻ̳еĳԱ)
+    enum FieldFlags : unsigned
+    {
+        kHot = 1,
+        kCold = 2,
+        kPinned = 4,
+    };
+
+    struct FieldInfo
+    {
+        const char *name;
+        std::size_t offset;
+        std::size_t size;
+        std::size_t align;
+        unsigned flags;
+
+        constexpr std::size_t End() const { return offset + size; }
+        constexpr bool Hot() const { return (flags & kHot) != 0; }
+        constexpr bool Pinned() const { return (flags & kPinned) != 0; }
+        // ӻ㿪ʼֶǷ
+        constexpr bool Straddles() const { return size > 0 && offset / kCacheLine != (End() - 1) / kCacheLine; }
+    };
+
+    //  LAYOUT_REGISTER ػkNamekList (std::array<FieldInfo, N>)
+    template <typename T>
+    struct Fields;
+
+    namespace detail
+    {
+        template <typename Member>
+        constexpr FieldInfo MakeField(const char *name, std::size_t offset, unsigned flags)
+        {
+            return {name, offset, sizeof(Member), alignof(Member), flags};
+        }
+    } // namespace detail
+} // namespace layout
+
+// ==========================================
+// 1. ǼǺ
+// ==========================================
+// ඨ Fields<T> ܶȡ˽гԱƫ ( 7_friend Ԫͬһ)
+// ͷļ ( GameEntities.h) ǰ layout::FieldsֱдչԪ
+#define LAYOUT_FRIEND                 \
+    template <typename>               \
+    friend struct ::layout::Fields
+
+// ֻ LAYOUT_REGISTER Ĳʹ (Self ǱǼǵ)֧λóԱ
+#define LAYOUT_FIELD(member, flags) \
+    ::layout::detail::MakeField<decltype(Self::member)>(#member, offsetof(Self, member), (flags))
+
+// ָ룺Itanium ABI  MSVC ûзĶ̬Ŀͷ
+#define LAYOUT_VPTR() \
+    ::layout::FieldInfo { "<vptr>", 0, sizeof(void *), alignof(void *), ::layout::kHot | ::layout::kPinned }
+
+#if defined(__GNUC__)
+#define LAYOUT_DETAIL_PUSH _Pragma("GCC diagnostic push") _Pragma("GCC diagnostic ignored \"-Winvalid-offsetof\"")
+#define LAYOUT_DETAIL_POP _Pragma("GCC diagnostic pop")
+#else
+#define LAYOUT_DETAIL_PUSH
+#define LAYOUT_DETAIL_POP
+#endif
+
+// ȫʹãLAYOUT_REGISTER(Student, LAYOUT_FIELD(name, layout::kCold), LAYOUT_FIELD(score, layout::kHot))
+#define LAYOUT_REGISTER(Type, ...)                                   \
+    LAYOUT_DETAIL_PUSH                                               \
+    template <>                                                      \
+    struct layout::Fields<Type>                                      \
+    {                                                                \
+        using Self = Type;                                           \
+        static constexpr const char *kName = #Type;                  \
+        static constexpr std::array kList{__VA_ARGS__};              \
+    };                                                               \
+    LAYOUT_DETAIL_POP
+
+namespace layout
+{
+    // ==========================================
+    // 2. ڷ
+    // ==========================================
+    struct LayoutReport
+    {
+        std::size_t size = 0;
+        std::size_t align = 0;
+        std::size_t fieldBytes = 0;  // Ǽֶεֽ֮
+        std::size_t padding = 0;     // size - fieldBytes (ĩβ)
+        std::size_t tailPadding = 0; // һֶ֮
+        std::size_t holes = 0;       // ֶ֮Ŀն (ĩβ)
+        std::size_t cacheLines = 0;  // ռ
+        std::size_t straddles = 0;   // 绺еֶθ
+        std::size_t hotStraddles = 0;
+        std::size_t hotBytes = 0;
+        std::size_t hotLines = 0;     // ֶ漰Ļ
+        bool hotInterleaved = false;  // ֶֶ֮
+    };
+
+    namespace detail
+    {
+        constexpr std::size_t AlignUp(std::size_t value, std::size_t align) { return (value + align - 1) / align * align; }
+
+        // constexpr ȶ (ֶ٣std::stable_sort  C++20 в constexpr)
+        template <typename Array, typename Less>
+        constexpr void InsertionSort(Array &items, std::size_t count, Less less)
+        {
+            for (std::size_t i = 1; i < count; i++)
+            {
+                auto item = items[i];
+                std::size_t j = i;
+                for (; j > 0 && less(item, items[j - 1]); j--)
+                    items[j] = items[j - 1];
+                items[j] = item;
+            }
+        }
+
+        template <std::size_t N>
+        constexpr std::array<FieldInfo, N> ByOffset(std::array<FieldInfo, N> fields)
+        {
+            InsertionSort(fields, N, [](const FieldInfo &a, const FieldInfo &b) { return a.offset < b.offset; });
+            return fields;
+        }
+
+        // ֶζڶڲһص
+        template <std::size_t N>
+        constexpr bool Valid(const std::array<FieldInfo, N> &list, std::size_t size)
+        {
+            const std::array<FieldInfo, N> fields = ByOffset(list);
+            for (std::size_t i = 0; i < N; i++)
+            {
+                if (fields[i].End() > size || (i > 0 && fields[i].offset < fields[i - 1].End()))
+                    return false;
+            }
+            return true;
+        }
+
+        template <std::size_t N>
+        constexpr LayoutReport Measure(const std::array<FieldInfo, N> &list, std::size_t size, std::size_t align)
+        {
+            const std::array<FieldInfo, N> fields = ByOffset(list);
+            LayoutReport r;
+            r.size = size;
+            r.align = align;
+            r.cacheLines = (size + kCacheLine - 1) / kCacheLine;
+            std::size_t cursor = 0, lastHotLine = 0;
+            bool seenHot = false, coldAfterHot = false;
+            for (const FieldInfo &f : fields)
+            {
+                r.fieldBytes += f.size;
+                r.holes += f.offset > cursor;
+                cursor = f.End();
+                r.straddles += f.Straddles();
+                if (f.Hot())
+                {
+                    r.hotStraddles += f.Straddles();
+                    r.hotBytes += f.size;
+                    // ֶ漰Ļ (ƫźֻһֶεһбȽ)
+                    const std::size_t first = f.offset / kCacheLine, last = (f.End() - 1) / kCacheLine;
+                    if (!seenHot || first > lastHotLine)
+                        r.hotLines += last - first + 1;
+                    else if (last > lastHotLine)
+                        r.hotLines += last - lastHotLine;
+                    lastHotLine = seenHot ? std::max(lastHotLine, last) : last;
+                    r.hotInterleaved |= coldAfterHot;
+                    seenHot = true;
+                }
+                else
+                    coldAfterHot |= seenHot;
+            }
+            r.padding = size - r.fieldBytes;
+            r.tailPadding = size - cursor;
+            return r;
+        }
+    } // namespace detail
+
+    template <typename T>
+    constexpr LayoutReport Analyze()
+    {
+        static_assert(detail::Valid(Fields<T>::kList, sizeof(T)),
+                      "LAYOUT_REGISTER: a field lies outside the object or overlaps another field");
+        return detail::Measure(Fields<T>::kList, sizeof(T), alignof(T));
+    }
+
+    // ==========================================
+    // 3. Ԥ㣺д static_assertֱʱʧ
+    // ==========================================
+    struct Budget
+    {
+        std::size_t maxSize = std::numeric_limits<std::size_t>::max();
+        std::size_t maxPadding = std::numeric_limits<std::size_t>::max();
+        std::size_t maxHotLines = std::numeric_limits<std::size_t>::max();
+        std::size_t maxHotStraddles = std::numeric_limits<std::size_t>::max();
+        bool requireSuggested = false; // Сֶλ Suggest<T>() 
+    };
+
+    // ==========================================
+    // 4. ֶ˳
+    // ==========================================
+    template <std::size_t N>
+    struct Suggestion
+    {
+        std::array<FieldInfo, N> fields{}; // ƫ
+        LayoutReport report;
+        bool changed = false; // 뵱ǰ˳ͬ
+    };
+
+    namespace detail
+    {
+        //  order ˳ŲƶֶΣ̶ֶԭزƶֶδӹ̶ֶ֮ʼ
+        // ΰԵĶ (ĹͬšǰĿն)
+        template <std::size_t N>
+        constexpr Suggestion<N> Place(std::array<FieldInfo, N> order, std::size_t align)
+        {
+            std::size_t cursor = 0;
+            for (const FieldInfo &f : order)
+                if (f.Pinned())
+                    cursor = std::max(cursor, f.End());
+            for (FieldInfo &f : order)
+                if (!f.Pinned())
+                {
+                    f.offset = AlignUp(cursor, f.align);
+                    cursor = f.End();
+                }
+            Suggestion<N> s;
+            s.fields = ByOffset(order);
+            s.report = Measure(order, AlignUp(std::max<std::size_t>(cursor, 1), align), align);
+            return s;
+        }
+
+        constexpr bool AlignDesc(const FieldInfo &a, const FieldInfo &b) { return a.align > b.align; }
+        constexpr bool AlignAsc(const FieldInfo &a, const FieldInfo &b) { return a.align < b.align; }
+
+        // ֶǰ (ӴС)ֶںcoldAscending СֶֶµĿ϶
+        template <std::size_t N>
+        constexpr std::array<FieldInfo, N> HotFirst(std::array<FieldInfo, N> fields, bool coldAscending)
+        {
+            InsertionSort(fields, N, [coldAscending](const FieldInfo &a, const FieldInfo &b)
+                          {
+                if (a.Hot() != b.Hot())
+                    return a.Hot();
+                if (a.Hot())
+                    return AlignDesc(a, b);
+                return coldAscending ? AlignAsc(a, b) : AlignDesc(a, b); });
+            return fields;
+        }
+
+        constexpr bool Better(const LayoutReport &a, const LayoutReport &b)
+        {
+            if (a.hotLines != b.hotLines)
+                return a.hotLines < b.hotLines;
+            if (a.size != b.size)
+                return a.size < b.size;
+            if (a.hotStraddles != b.hotStraddles)
+                return a.hotStraddles < b.hotStraddles;
+            return !a.hotInterleaved && b.hotInterleaved; // ͬʱֶһƬĸ׶
+        }
+
+        //  Better ͬıȽ˳򣬵 hotInterleaved
+        constexpr bool Improves(const LayoutReport &a, const LayoutReport &b)
+        {
+            if (a.hotLines != b.hotLines)
+                return a.hotLines < b.hotLines;
+            if (a.size != b.size)
+                return a.size < b.size;
+            return a.hotStraddles < b.hotStraddles;
+        }
+    } // namespace detail
+
+    // ѡǰ˳ȫ뽵ֶǰ (ֶν / )ȡֶλ١Сһ
+    // ֶλССֶζûбʱԭ (changed == false)
+    template <typename T>
+    constexpr auto Suggest()
+    {
+        constexpr std::size_t N = std::tuple_size_v<std::decay_t<decltype(Fields<T>::kList)>>;
+        const std::array<FieldInfo, N> current = detail::ByOffset(Fields<T>::kList);
+        std::array<FieldInfo, N> byAlign = current;
+        detail::InsertionSort(byAlign, N, detail::AlignDesc);
+
+        Suggestion<N> best; // ǰ˳ԱʵʽΪ׼
+        best.fields = current;
+        best.report = detail::Measure(current, sizeof(T), alignof(T));
+        const Suggestion<N> original = best;
+        for (const std::array<FieldInfo, N> &order :
+             {byAlign, detail::HotFirst(current, false), detail::HotFirst(current, true)})
+        {
+            Suggestion<N> candidate = detail::Place(order, alignof(T));
+            if (detail::Better(candidate.report, best.report))
+                best = candidate;
+        }
+        // ֶֻλССֶʱŽĶ"ֶһƬ"ֵøඨ
+        if (!detail::Improves(best.report, original.report))
+            return original;
+        best.changed = true;
+        return best;
+    }
+
+    template <typename T>
+    constexpr bool WithinBudget(const Budget &budget)
+    {
+        const LayoutReport r = Analyze<T>();
+        if (r.size > budget.maxSize || r.padding > budget.maxPadding || r.hotLines > budget.maxHotLines ||
+            r.hotStraddles > budget.maxHotStraddles)
+            return false;
+        if (budget.requireSuggested)
+        {
+            const LayoutReport s = Suggest<T>().report;
+            return r.size <= s.size && r.hotLines <= s.hotLines;
+        }
+        return true;
+    }
+
+    // ==========================================
+    // 5. ʱӡֱ + ˳
+    // ==========================================
+    namespace detail
+    {
+        inline void PrintRows(std::ostream &os, const FieldInfo *fields, std::size_t count, std::size_t size)
+        {
+            std::size_t cursor = 0;
+            auto pad = [&](std::size_t from, std::size_t to)
+            {
+                if (to > from)
+                    os << "    " << std::setw(6) << from << std::setw(6) << to - from << "        (padding)\n";
+            };
+            for (std::size_t i = 0; i < count; i++)
+            {
+                const FieldInfo &f = fields[i];
+                pad(cursor, f.offset);
+                os << "    " << std::setw(6) << f.offset << std::setw(6) << f.size << std::setw(6) << f.align << "  "
+                   << f.name << (f.Hot() ? "  [hot]" : "  [cold]") << (f.Pinned() ? " [pinned]" : "")
+                   << (f.Straddles() ? " [straddles line]" : "") << "\n";
+                cursor = f.End();
+            }
+            pad(cursor, size);
+        }
+    } // namespace detail
+
+    template <typename T>
+    void PrintReport(std::ostream &os)
+    {
+        constexpr LayoutReport r = Analyze<T>();
+        const auto fields = detail::ByOffset(Fields<T>::kList);
+        os << Fields<T>::kName << ": size " << r.size << ", align " << r.align << ", padding " << r.padding << " ("
+           << r.holes << " holes + " << r.tailPadding << " tail), " << r.cacheLines << " cache line(s), "
+           << r.straddles << " straddling field(s)\n";
+        os << "    offset  size align  field\n";
+        detail::PrintRows(os, fields.data(), fields.size(), r.size);
+        os << "  hot: " << r.hotBytes << " bytes in " << r.hotLines << " line(s)"
+           << (r.hotInterleaved ? ", interleaved with cold fields" : "") << "\n";
+    }
+
+    // ˳ԱбŸඨ
+    template <typename T>
+    void PrintSuggestion(std::ostream &os)
+    {
+        constexpr LayoutReport r = Analyze<T>();
+        constexpr auto s = Suggest<T>();
+        if (!s.changed)
+        {
+            os << "  suggestion: keep the current order\n";
+            return;
+        }
+        os << "  suggestion: " << r.size << " -> " << s.report.size << " bytes, hot lines " << r.hotLines << " -> "
+           << s.report.hotLines << ", padding " << r.padding << " -> " << s.report.padding << "\n";
+        os << "    // member order for " << Fields<T>::kName << "\n";
+        for (const FieldInfo &f : s.fields)
+            os << "    //   " << f.name << ";  // offset " << f.offset
+               << (f.Hot() ? ", hot" : ", cold") << (f.Pinned() ? ", pinned" : "") << "\n";
+    }
+} // namespace layout
@@ -0,0 +1,237 @@
+/**
+ * @file layout_report.cpp
+ * @brief StructLayout.h գPrintOffsets  Vector3StudentEntity / PlayerInventoryItem ĲֱԤ㣬
+ *        Լֶ˳ܲ ParticleBad 밴ź Particle ʱĺʱԱ
+ * @note : g++ -O3 -std=c++20 layout_report.cpp -o layout_report
+ *       : ./layout_report [ӸĬ 4000000]
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "StructLayout.h"
+#include "../01_class_object/15_dynamic_cast/GameEntities.h"
+#include "../23_Benchmarking/Timer.h"
+
+// ==========================================
+// 1. õ
+// ==========================================
+// Entity / Player ֱʹ 01_class_object/15_dynamic_cast/GameEntities.h ʵ (д layout::Fields Ԫ)
+// isa<> / dyn_cast<> ÿζ kindupdate() 
+// 漸ֻ .md / demo.cpp ûпɰͷļֻճԱ (ȥ˳Ա)
+
+// arrow.md
+struct Vector3
+{
+    float x, y, z;
+};
+
+// 00_algo/Sort/std_sort/std_sort.mdʱȽ score  age
+struct Student
+{
+    std::string name;
+    int score;
+    int age;
+};
+
+// 01_class_object/4_constructor-destructor/demo.cpp
+class InventoryItem
+{
+    LAYOUT_FRIEND;
+
+private:
+    std::string name;
+    int *quantityPtr;
+};
+
+LAYOUT_REGISTER(Vector3,
+                LAYOUT_FIELD(x, layout::kHot),
+                LAYOUT_FIELD(y, layout::kHot),
+                LAYOUT_FIELD(z, layout::kHot))
+
+LAYOUT_REGISTER(Student,
+                LAYOUT_FIELD(name, layout::kCold),
+                LAYOUT_FIELD(score, layout::kHot),
+                LAYOUT_FIELD(age, layout::kHot))
+
+LAYOUT_REGISTER(Entity,
+                LAYOUT_VPTR(),
+                LAYOUT_FIELD(name, layout::kCold),
+                LAYOUT_FIELD(kind, layout::kHot))
+
+// ̳ĳԱΪ kPinnedPlayer ֻܾ level 
+LAYOUT_REGISTER(Player,
+                LAYOUT_VPTR(),
+                LAYOUT_FIELD(name, layout::kCold | layout::kPinned),
+                LAYOUT_FIELD(kind, layout::kHot | layout::kPinned),
+                LAYOUT_FIELD(level, layout::kHot))
+
+LAYOUT_REGISTER(InventoryItem,
+                LAYOUT_FIELD(name, layout::kCold),
+                LAYOUT_FIELD(quantityPtr, layout::kHot))
+
+// Ԥ (ֵ x86-64 + libstdc++ ϵĽ)˵ֶ˳ֶòֱʱʧ
+static_assert(layout::WithinBudget<Vector3>({.maxSize = 12, .maxPadding = 0}));
+static_assert(layout::WithinBudget<Student>({.maxSize = 40, .maxPadding = 0, .maxHotLines = 1, .requireSuggested = true}));
+static_assert(layout::WithinBudget<Entity>({.maxSize = 48, .maxHotLines = 1, .requireSuggested = true}));
+static_assert(layout::WithinBudget<Player>({.maxSize = 48, .maxHotLines = 1, .requireSuggested = true}));
+// Entity ֶǰֶֻһƬСͻ䣬ֵýĶ
+static_assert(!layout::Suggest<Entity>().changed && !layout::Suggest<Player>().changed);
+static_assert(layout::WithinBudget<InventoryItem>({.maxSize = 40, .maxPadding = 0}));
+// level Ž Entity ĩβ 7 ֽ (Itanium ABI Ḵ÷ POD β)Player ûб
+static_assert(sizeof(Player) == sizeof(Entity) && layout::Analyze<Player>().padding == 3);
+
+// ==========================================
+// 2. ֶ˳ܲӣֶɢмֶΣ18 ֽ
+// ==========================================
+struct ParticleBad
+{
+    bool alive;         // hot
+    double x, y;        // hot
+    int id;             // cold
+    double vx;          // hot
+    char debugName[36]; // cold
+    double vy;          // hot
+    bool selected;      // cold
+    float mass;         // hot
+};
+
+LAYOUT_REGISTER(ParticleBad,
+                LAYOUT_FIELD(alive, layout::kHot),
+                LAYOUT_FIELD(x, layout::kHot),
+                LAYOUT_FIELD(y, layout::kHot),
+                LAYOUT_FIELD(id, layout::kCold),
+                LAYOUT_FIELD(vx, layout::kHot),
+                LAYOUT_FIELD(debugName, layout::kCold),
+                LAYOUT_FIELD(vy, layout::kHot),
+                LAYOUT_FIELD(selected, layout::kCold),
+                LAYOUT_FIELD(mass, layout::kHot))
+
+//  PrintSuggestion<ParticleBad> ˳д
+struct Particle
+{
+    double x, y;
+    double vx, vy;
+    float mass;
+    bool alive;
+    char debugName[36];
+    bool selected;
+    int id;
+};
+
+LAYOUT_REGISTER(Particle,
+                LAYOUT_FIELD(x, layout::kHot),
+                LAYOUT_FIELD(y, layout::kHot),
+                LAYOUT_FIELD(vx, layout::kHot),
+                LAYOUT_FIELD(vy, layout::kHot),
+                LAYOUT_FIELD(mass, layout::kHot),
+                LAYOUT_FIELD(alive, layout::kHot),
+                LAYOUT_FIELD(debugName, layout::kCold),
+                LAYOUT_FIELD(selected, layout::kCold),
+                LAYOUT_FIELD(id, layout::kCold))
+
+static_assert(!layout::WithinBudget<ParticleBad>({.requireSuggested = true}), "ParticleBad can be improved");
+static_assert(layout::WithinBudget<Particle>({.maxHotLines = 1, .maxHotStraddles = 0, .requireSuggested = true}));
+static_assert(layout::Suggest<ParticleBad>().changed && layout::Suggest<ParticleBad>().report.size == sizeof(Particle));
+
+// ==========================================
+// 3. 
+// ==========================================
+void Reports()
+{
+    std::cout << "=== 1. PrintOffsets() vs layout::Fields<Vector3> ===" << std::endl;
+    // arrow.md д (UB)
+    std::size_t offsetY = (std::size_t)&((Vector3 *)nullptr)->y;
+    std::size_t offsetZ = (std::size_t)&((Vector3 *)nullptr)->z;
+    const auto &fields = layout::Fields<Vector3>::kList;
+    std::cout << "  nullptr trick: y " << offsetY << ", z " << offsetZ << "; registry: y " << fields[1].offset << ", z "
+              << fields[2].offset << (offsetY == fields[1].offset && offsetZ == fields[2].offset ? " (same)" : " (DIFFER)")
+              << std::endl;
+    layout::PrintReport<Vector3>(std::cout);
+
+    std::cout << "\n=== 2. Acceptance types ===" << std::endl;
+    layout::PrintReport<Student>(std::cout);
+    layout::PrintSuggestion<Student>(std::cout);
+    layout::PrintReport<Entity>(std::cout);
+    layout::PrintSuggestion<Entity>(std::cout);
+    layout::PrintReport<Player>(std::cout);
+    layout::PrintSuggestion<Player>(std::cout);
+    layout::PrintReport<InventoryItem>(std::cout);
+    layout::PrintSuggestion<InventoryItem>(std::cout);
+    std::cout << "  note: quantityPtr is hot but its int lives in a separate heap block (see Inventory.h)" << std::endl;
+
+    std::cout << "\n=== 3. ParticleBad -> Particle ===" << std::endl;
+    layout::PrintReport<ParticleBad>(std::cout);
+    layout::PrintSuggestion<ParticleBad>(std::cout);
+    layout::PrintReport<Particle>(std::cout);
+}
+
+// ==========================================
+// 4. ֻдֶΣֲָһ
+// ==========================================
+template <typename P>
+std::vector<P> MakeParticles(std::size_t count)
+{
+    std::vector<P> particles(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        P &p = particles[i];
+        p.alive = i % 8 != 0;
+        p.x = static_cast<double>(i % 1000);
+        p.y = static_cast<double>(i % 777);
+        p.vx = 1.0 + static_cast<double>(i % 3);
+        p.vy = -0.5;
+        p.mass = 1.0f + static_cast<float>(i % 5);
+        p.id = static_cast<int>(i);
+        p.selected = false;
+        p.debugName[0] = '\0';
+    }
+    return particles;
+}
+
+template <typename P>
+double Step(std::vector<P> &particles, int frames)
+{
+    double momentum = 0;
+    for (int frame = 0; frame < frames; frame++)
+        for (P &p : particles)
+            if (p.alive)
+            {
+                p.x += p.vx * 0.016;
+                p.y += p.vy * 0.016;
+                momentum += p.mass * p.vx;
+            }
+    return momentum;
+}
+
+void Benchmark(std::size_t count)
+{
+    const int frames = 10;
+    std::cout << "\n=== 4. " << count << " particles x " << frames << " frames, hot fields only (Run in Release Mode! -O3) ===" << std::endl;
+    std::vector<ParticleBad> bad = MakeParticles<ParticleBad>(count);
+    std::vector<Particle> good = MakeParticles<Particle>(count);
+    double badResult, goodResult;
+    std::cout << "  ParticleBad " << sizeof(ParticleBad) * count / (1 << 20) << " MB, Particle "
+              << sizeof(Particle) * count / (1 << 20) << " MB" << std::endl;
+    {
+        Timer timer("ParticleBad (96 B, hot fields in 2 lines)", count * frames);
+        badResult = Step(bad, frames);
+    }
+    {
+        Timer timer("Particle (suggested order)", count * frames);
+        goodResult = Step(good, frames);
+    }
+    std::cout << "  results " << (badResult == goodResult ? "identical" : "DIFFER") << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4000000;
+    Reports();
+    Benchmark(count);
+    return 0;
+}
@@ -0,0 +1,368 @@
+/**
+ * @file IntrusivePtr.h
+ * @brief ʽüָ IntrusivePtr<T> / WeakIntrusivePtr<T>
+ * @note Ҫ C++17
+ *
+ *  std::shared_ptr 
+ *   1. üͶͬһڴ (ǰһ 8 ֽͷ)ָ뱾ֻ 8 ֽ (shared_ptr  16 ֽ)
+ *   2. ʽɲ (Policy) ĬԭӼ using RefCountPolicy = NonAtomicRefCount;
+ *      лΪͨ߳̽׶ÿοٸԭָĴ
+ *   3. òҪĿƿ飺ǿùʱֻڴȵҲͷ
+ *   4. ָ (Ա this) ʱµõһ IntrusivePtr൱ѵ enable_shared_from_this
+ *
+ * ڴ沼 (һη)
+ *   [ strong | weak | () | T  ]
+ *              ^ Header            ^ IntrusivePtr ָ
+ * IntrusivePtr<Base> ǻӶĵַ̳ʱһǶ㣻
+ * ̬ dynamic_cast<void *> һ㣬ǰͷ
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// ==========================================
+// 1.  (Policy)
+// ==========================================
+// ̰߳ȫ shared_ptr һµԭӼ
+struct AtomicRefCount
+{
+    using Counter = std::atomic<std::uint32_t>;
+
+    static void Increment(Counter &c) { c.fetch_add(1, std::memory_order_relaxed); }
+
+    // صݼֵǸ߳Ҫ֮߳ǰд룬 acq_rel
+    static std::uint32_t Decrement(Counter &c) { return c.fetch_sub(1, std::memory_order_acq_rel) - 1; }
+
+    static std::uint32_t Load(const Counter &c) { return c.load(std::memory_order_acquire); }
+
+    // ֻм 0 ʱ +1
+    static bool IncrementIfNonZero(Counter &c)
+    {
+        std::uint32_t current = c.load(std::memory_order_relaxed);
+        while (current != 0)
+        {
+            if (c.compare_exchange_weak(current, current + 1, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+        }
+        return false;
+    }
+};
+
+// ̣߳ͨһ inc/dec ָ
+struct NonAtomicRefCount
+{
+    using Counter = std::uint32_t;
+
+    static void Increment(Counter &c) { ++c; }
+    static std::uint32_t Decrement(Counter &c) { return --c; }
+    static std::uint32_t Load(const Counter &c) { return c; }
+    static bool IncrementIfNonZero(Counter &c)
+    {
+        if (c == 0)
+            return false;
+        ++c;
+        return true;
+    }
+};
+
+// ͨ using RefCountPolicy = ...; ѡԣδʱĬԭӼ
+template <typename T, typename = void>
+struct RefCountPolicyOf
+{
+    using type = AtomicRefCount;
+};
+
+template <typename T>
+struct RefCountPolicyOf<T, std::void_t<typename T::RefCountPolicy>>
+{
+    using type = typename T::RefCountPolicy;
+};
+
+template <typename T>
+class IntrusivePtr;
+template <typename T>
+class WeakIntrusivePtr;
+
+namespace intrusive_detail
+{
+    template <typename T>
+    struct Block
+    {
+        using Policy = typename RefCountPolicyOf<T>::type;
+
+        struct Header
+        {
+            typename Policy::Counter strong;
+            typename Policy::Counter weak; // ǿúҲ 1 
+        };
+
+        static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "IntrusivePtr: ݲֳ֧");
+
+        // ڷƫƣͷСȡ T Ķ
+        static constexpr std::size_t kObjectOffset =
+            (sizeof(Header) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+        // object 뻹ţdynamic_cast<void *> Ҫ"ƫ"
+        static Header *HeaderOf(const T *object)
+        {
+            auto *mutableObject = const_cast<std::remove_cv_t<T> *>(object);
+            void *start = mutableObject;
+            if constexpr (std::is_polymorphic_v<T>)
+                start = dynamic_cast<void *>(mutableObject);
+            auto *bytes = static_cast<unsigned char *>(start);
+            return std::launder(reinterpret_cast<Header *>(bytes - kObjectOffset));
+        }
+
+        static void AddStrong(const T *object) { Policy::Increment(HeaderOf(object)->strong); }
+        static void AddWeak(const T *object) { Policy::Increment(HeaderOf(object)->weak); }
+
+        static void ReleaseWeak(Header *header)
+        {
+            if (Policy::Decrement(header->weak) == 0)
+            {
+                header->~Header();
+                ::operator delete(static_cast<void *>(header));
+            }
+        }
+
+        static void ReleaseStrong(T *object)
+        {
+            Header *header = HeaderOf(object);
+            if (Policy::Decrement(header->strong) == 0)
+            {
+                object->~T();        // ǿù㣺 (ͷеԴ)
+                ReleaseWeak(header); // "ǿ"е 1 
+            }
+        }
+    };
+
+    // IntrusivePtr<U> -> IntrusivePtr<T>ͬһּͷľͬ
+    // T  (Ƕ̬)HeaderOf ͷӶĸƫƶ
+    template <typename U, typename T>
+    T *Upcast(U *p) noexcept
+    {
+        static_assert(std::is_same_v<typename Block<U>::Policy, typename Block<T>::Policy>,
+                      "IntrusivePtr: ʹͬ RefCountPolicy");
+        static_assert(Block<U>::kObjectOffset == Block<T>::kObjectOffset,
+                      "IntrusivePtr: Ķ벻ͬͷλöԲ");
+        static_assert(std::is_same_v<std::remove_cv_t<U>, std::remove_cv_t<T>> || std::has_virtual_destructor_v<T>,
+                      "IntrusivePtr: ָͨͷŶҪ");
+        return p;
+    }
+} // namespace intrusive_detail
+
+// ==========================================
+// 2. IntrusivePtr<T>ǿ
+// ==========================================
+template <typename T>
+class IntrusivePtr
+{
+private:
+    using Block = intrusive_detail::Block<T>;
+    T *m_Ptr = nullptr;
+
+    struct AdoptTag
+    {
+    };
+    IntrusivePtr(T *p, AdoptTag) noexcept : m_Ptr(p) {} // ӹһѾƹ
+
+    template <typename U, typename... Args>
+    friend IntrusivePtr<U> MakeIntrusive(Args &&...args);
+    friend class WeakIntrusivePtr<T>;
+    template <typename U>
+    friend class IntrusivePtr;
+
+public:
+    IntrusivePtr() noexcept = default;
+    IntrusivePtr(std::nullptr_t) noexcept {}
+
+    // ָ»ǿãp  MakeIntrusive Ȼ (ڳԱﴫ this)
+    static IntrusivePtr FromThis(T *p) noexcept
+    {
+        if (p)
+            Block::AddStrong(p);
+        return IntrusivePtr(p, AdoptTag{});
+    }
+
+    IntrusivePtr(const IntrusivePtr &other) noexcept : m_Ptr(other.m_Ptr)
+    {
+        if (m_Ptr)
+            Block::AddStrong(m_Ptr);
+    }
+
+    IntrusivePtr(IntrusivePtr &&other) noexcept : m_Ptr(other.m_Ptr) { other.m_Ptr = nullptr; }
+
+    IntrusivePtr &operator=(const IntrusivePtr &other) noexcept
+    {
+        IntrusivePtr(other).Swap(*this);
+        return *this;
+    }
+
+    IntrusivePtr &operator=(IntrusivePtr &&other) noexcept
+    {
+        IntrusivePtr(std::move(other)).Swap(*this);
+        return *this;
+    }
+
+    //  ->  (Լ T -> const T) shared_ptr ʽתһ
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U *, T *>>>
+    IntrusivePtr(const IntrusivePtr<U> &other) noexcept : m_Ptr(other.m_Ptr ? intrusive_detail::Upcast<U, T>(other.m_Ptr) : nullptr)
+    {
+        if (m_Ptr)
+            Block::AddStrong(m_Ptr);
+    }
+
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U *, T *>>>
+    IntrusivePtr(IntrusivePtr<U> &&other) noexcept : m_Ptr(other.m_Ptr ? intrusive_detail::Upcast<U, T>(other.m_Ptr) : nullptr)
+    {
+        other.m_Ptr = nullptr;
+    }
+
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U *, T *>>>
+    IntrusivePtr &operator=(const IntrusivePtr<U> &other) noexcept
+    {
+        IntrusivePtr(other).Swap(*this);
+        return *this;
+    }
+
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U *, T *>>>
+    IntrusivePtr &operator=(IntrusivePtr<U> &&other) noexcept
+    {
+        IntrusivePtr(std::move(other)).Swap(*this);
+        return *this;
+    }
+
+    ~IntrusivePtr()
+    {
+        if (m_Ptr)
+            Block::ReleaseStrong(m_Ptr);
+    }
+
+    void Reset() noexcept { IntrusivePtr().Swap(*this); }
+    void Swap(IntrusivePtr &other) noexcept { std::swap(m_Ptr, other.m_Ptr); }
+
+    T *get() const noexcept { return m_Ptr; }
+    T &operator*() const noexcept { return *m_Ptr; }
+    T *operator->() const noexcept { return m_Ptr; }
+    explicit operator bool() const noexcept { return m_Ptr != nullptr; }
+
+    std::uint32_t use_count() const noexcept
+    {
+        return m_Ptr ? Block::Policy::Load(Block::HeaderOf(m_Ptr)->strong) : 0;
+    }
+
+    friend bool operator==(const IntrusivePtr &a, const IntrusivePtr &b) { return a.m_Ptr == b.m_Ptr; }
+    friend bool operator!=(const IntrusivePtr &a, const IntrusivePtr &b) { return a.m_Ptr != b.m_Ptr; }
+};
+
+// ==========================================
+// 3. WeakIntrusivePtr<T> (ѭ)
+// ==========================================
+// ڴԱͷļȻɶԲҪĿƿ
+// ͷͶַ dynamic_cast T ǲڶĻ֮࣬ľֻڹʱ
+template <typename T>
+class WeakIntrusivePtr
+{
+private:
+    using Block = intrusive_detail::Block<T>;
+
+    //  void* ͷַWeakIntrusivePtr<Node> Ϊ Node ԼĳԱʱ Node ǲ
+    void *m_Header = nullptr;
+    T *m_Object = nullptr;
+
+    auto *GetHeader() const { return static_cast<typename Block::Header *>(m_Header); }
+
+public:
+    WeakIntrusivePtr() noexcept = default;
+
+    WeakIntrusivePtr(const IntrusivePtr<T> &strong) noexcept
+    {
+        if (strong)
+        {
+            m_Header = Block::HeaderOf(strong.get());
+            m_Object = strong.get();
+            Block::Policy::Increment(GetHeader()->weak);
+        }
+    }
+
+    WeakIntrusivePtr(const WeakIntrusivePtr &other) noexcept : m_Header(other.m_Header), m_Object(other.m_Object)
+    {
+        if (m_Header)
+            Block::Policy::Increment(GetHeader()->weak);
+    }
+
+    WeakIntrusivePtr(WeakIntrusivePtr &&other) noexcept : m_Header(other.m_Header), m_Object(other.m_Object)
+    {
+        other.m_Header = nullptr;
+        other.m_Object = nullptr;
+    }
+
+    WeakIntrusivePtr &operator=(const WeakIntrusivePtr &other) noexcept
+    {
+        WeakIntrusivePtr(other).Swap(*this);
+        return *this;
+    }
+
+    WeakIntrusivePtr &operator=(WeakIntrusivePtr &&other) noexcept
+    {
+        WeakIntrusivePtr(std::move(other)).Swap(*this);
+        return *this;
+    }
+
+    ~WeakIntrusivePtr()
+    {
+        if (m_Header)
+            Block::ReleaseWeak(GetHeader());
+    }
+
+    void Reset() noexcept { WeakIntrusivePtr().Swap(*this); }
+    void Swap(WeakIntrusivePtr &other) noexcept
+    {
+        std::swap(m_Header, other.m_Header);
+        std::swap(m_Object, other.m_Object);
+    }
+
+    bool expired() const noexcept
+    {
+        return !m_Header || Block::Policy::Load(GetHeader()->strong) == 0;
+    }
+
+    //  weak_ptr::lock() ͬ󻹻žͷǿã򷵻ؿ
+    IntrusivePtr<T> lock() const noexcept
+    {
+        if (m_Header && Block::Policy::IncrementIfNonZero(GetHeader()->strong))
+            return IntrusivePtr<T>(m_Object, typename IntrusivePtr<T>::AdoptTag{});
+        return IntrusivePtr<T>();
+    }
+};
+
+// ==========================================
+// 4. MakeIntrusive<T>(args...)һηͷ + 
+// ==========================================
+template <typename T, typename... Args>
+IntrusivePtr<T> MakeIntrusive(Args &&...args)
+{
+    using Block = intrusive_detail::Block<T>;
+    using Header = typename Block::Header;
+
+    void *memory = ::operator new(Block::kObjectOffset + sizeof(T));
+    Header *header = ::new (memory) Header{{1}, {1}};
+    T *object = nullptr;
+    try
+    {
+        object = ::new (static_cast<unsigned char *>(memory) + Block::kObjectOffset) T(std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        header->~Header();
+        ::operator delete(memory);
+        throw;
+    }
+    return IntrusivePtr<T>(object, typename IntrusivePtr<T>::AdoptTag{});
+}
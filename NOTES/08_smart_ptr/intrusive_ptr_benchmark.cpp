@@ -0,0 +1,191 @@
+/**
+ * @file intrusive_ptr_benchmark.cpp
+ * @brief IntrusivePtr (ԭ / ԭ) vs std::shared_ptr/ÿڴռ
+ * @note : g++ -O3 -std=c++17 intrusive_ptr_benchmark.cpp -o intrusive_ptr_benchmark
+ *       д 23_Benchmarking  TestNewShared / TestMakeShared ĶԱȷʽ
+ */
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "IntrusivePtr.h"
+#include "../23_Benchmarking/CountingAllocator.h"
+#include "../23_Benchmarking/Timer.h"
+
+// ==========================================
+// 1. Զ
+// ==========================================
+struct Vector3
+{
+    float x, y, z;
+    Vector3() : x(0), y(0), z(0) {}
+};
+
+// ߳̽׶ʹõİ汾ԺIntrusivePtr ļΪͨ
+struct LocalVector3 : Vector3
+{
+    using RefCountPolicy = NonAtomicRefCount;
+};
+
+// weak ʾõĽڵ (Ӧ smart_ptr.md  Node)
+struct Node
+{
+    std::string value;
+    WeakIntrusivePtr<Node> next;
+
+    Node(std::string v) : value(std::move(v)) { std::cout << "  [Node Construct] " << value << std::endl; }
+    ~Node() { std::cout << "  [Node Destruct]  " << value << std::endl; }
+};
+
+//  -> תʾͨ IntrusivePtr<Shape> ͷ Circle Ҫ
+struct Shape
+{
+    virtual ~Shape() {}
+    virtual const char *Name() const { return "Shape"; }
+};
+
+struct Circle : Shape
+{
+    ~Circle() override { std::cout << "  [Circle Destruct]" << std::endl; }
+    const char *Name() const override { return "Circle"; }
+};
+
+// ڶ಻ڶ㣺IntrusivePtr<Labeled> ĵַͷ֮ Circle Ӷ
+struct Labeled
+{
+    virtual ~Labeled() {}
+    const char *label = "label";
+};
+
+struct LabeledCircle : Circle, Labeled
+{
+    ~LabeledCircle() override { std::cout << "  [LabeledCircle Destruct]" << std::endl; }
+};
+
+constexpr int kObjects = 1000000;
+constexpr int kCopies = 10000000;
+
+// ==========================================
+// 2.  / 
+// ==========================================
+void TestMakeShared()
+{
+    Timer timer("make_shared<Vector3>", kObjects);
+    for (int i = 0; i < kObjects; ++i)
+    {
+        std::shared_ptr<Vector3> ptr = std::make_shared<Vector3>();
+        DoNotOptimize(ptr);
+    }
+}
+
+void TestMakeIntrusive()
+{
+    Timer timer("MakeIntrusive<Vector3>", kObjects);
+    for (int i = 0; i < kObjects; ++i)
+    {
+        IntrusivePtr<Vector3> ptr = MakeIntrusive<Vector3>();
+        DoNotOptimize(ptr);
+    }
+}
+
+// ==========================================
+// 3.  /  (ÿѭ +1  -1)
+// ==========================================
+template <typename Ptr>
+void TestCopy(const char *name, const Ptr &source)
+{
+    Timer timer(name, kCopies);
+    for (int i = 0; i < kCopies; ++i)
+    {
+        Ptr copy = source; //  +1
+        DoNotOptimize(copy);
+    } //  -1
+}
+
+// ==========================================
+// 4. ÿڴ (Ķֽ + )
+// ==========================================
+template <typename Factory>
+void MeasureMemory(const char *name, std::size_t handleSize, Factory make)
+{
+    std::size_t countBefore = g_AllocCount, bytesBefore = g_AllocBytes;
+    {
+        auto ptr = make();
+        DoNotOptimize(ptr);
+    }
+    std::cout << "  " << name << ": " << (g_AllocCount - countBefore) << " allocation(s), "
+              << (g_AllocBytes - bytesBefore) << " heap bytes + " << handleSize << " bytes per handle" << std::endl;
+}
+
+int main()
+{
+    std::cout << "=== 1. Weak reference (cycle) demo ===" << std::endl;
+    {
+        IntrusivePtr<Node> nodeA = MakeIntrusive<Node>("A");
+        IntrusivePtr<Node> nodeB = MakeIntrusive<Node>("B");
+        nodeA->next = nodeB;
+        nodeB->next = nodeA;
+        if (auto b = nodeA->next.lock())
+            std::cout << "  Accessing B from A: " << b->value << " (use_count " << b.use_count() << ")" << std::endl;
+
+        WeakIntrusivePtr<Node> watcher = nodeA;
+        nodeA.Reset(); // A ڴ汣 watcher  B->next Ҳͷ
+        std::cout << "  A expired: " << std::boolalpha << watcher.expired() << std::endl;
+    }
+
+    {
+        IntrusivePtr<Circle> circle = MakeIntrusive<Circle>();
+        IntrusivePtr<Shape> shape = circle;                // ת +1
+        IntrusivePtr<const Shape> view = std::move(shape); // ƶת
+        std::cout << "  IntrusivePtr<const Shape> -> " << view->Name() << " (use_count " << view.use_count() << ")"
+                  << std::endl;
+        circle.Reset();
+        shape = MakeIntrusive<Circle>(); // תֵ
+        view = shape;
+        std::cout << "  after reassign: use_count " << view.use_count() << " (first Circle already destroyed)"
+                  << std::endl;
+    }
+
+    {
+        IntrusivePtr<LabeledCircle> full = MakeIntrusive<LabeledCircle>();
+        IntrusivePtr<Labeled> second = full; // ڶַࣺڶ
+        WeakIntrusivePtr<Labeled> weak = second;
+        const auto offset = reinterpret_cast<const char *>(second.get()) - reinterpret_cast<const char *>(full.get());
+        full.Reset();
+        std::cout << "  IntrusivePtr<Labeled> at offset " << offset << ": use_count " << second.use_count()
+                  << ", lock() -> " << weak.lock()->label << std::endl;
+        second.Reset(); // ͨڶͷ
+        std::cout << "  expired: " << weak.expired() << std::endl;
+    }
+
+    std::cout << "\n=== 2. Memory per object (sizeof(Vector3) = " << sizeof(Vector3) << ") ===" << std::endl;
+    MeasureMemory("shared_ptr(new T)", sizeof(std::shared_ptr<Vector3>),
+                  [] { return std::shared_ptr<Vector3>(new Vector3()); });
+    MeasureMemory("make_shared", sizeof(std::shared_ptr<Vector3>), [] { return std::make_shared<Vector3>(); });
+    MeasureMemory("MakeIntrusive", sizeof(IntrusivePtr<Vector3>), [] { return MakeIntrusive<Vector3>(); });
+
+    std::cout << "\n=== 3. Throughput (Run in Release Mode! -O3) ===" << std::endl;
+    auto shared = std::make_shared<Vector3>();
+    auto intrusive = MakeIntrusive<Vector3>();
+    auto local = MakeIntrusive<LocalVector3>();
+    for (int pass = 0; pass < 2; pass++)
+    {
+        // ע⣺GCC 12+  libstdc++ ڽ̴δ߳ʱ (__libc_single_threaded)
+        //  shared_ptr ԭָڶ֮ǰһ̣߳ܿ shared_ptr ʵ߳̿
+        if (pass == 1)
+        {
+            std::thread([] {}).join();
+            std::cout << "(a thread has been started: shared_ptr now uses atomic counting)" << std::endl;
+        }
+        TestMakeShared();
+        TestMakeIntrusive();
+        TestCopy("copy shared_ptr", shared);
+        TestCopy("copy IntrusivePtr (atomic)", intrusive);
+        TestCopy("copy IntrusivePtr (non-atomic)", local);
+        std::cout << "--------------------------------" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,311 @@
+/**
+ * @file Divider.h
+ * @brief Divider<T>ڲ֪ᱻʹõĳԤ"ħ + λ"ѳɳ˷ (libdivide ˼·)
+ * @note Ҫ C++20 (std::span / std::bit_width)֧ int32_t / uint32_t / int64_t / uint64_t
+ *       x86-64 Ĭϴ SSE232 λ͵ӿһδ 4 ˻Ϊ (ͬ)
+ *
+ * 09_Mutiple_return_values.md  divide(a, b, result, remainder) ÿεöִһӲָ
+ * (64 λ div Լ 25~40 ڣ˷ֻҪ 3 )ǱڳʱԼ a / 7 
+ * " 2^k / 7 "ڱʱΪDivider ͬ£
+ *   - ʱ (һ) magic = ceil(2^(N + s) / d) λ s
+ *   - ÿγq = mulhi(n, magic) >> sҪʱһμӷ (magic Ҫ N + 1 λ)
+ *   -  2 ݣֻλ (зȼƫã֤ 0 ȡ)
+ * һ DivResult أֱ auto [q, r] = divide(a, divider);
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define DIVIDER_HAS_SSE2 1
+#endif
+
+namespace fastdiv
+{
+    // ̺õ /  % һ ( 0 ȡ뱻ͬ)
+    template <typename T>
+    struct DivResult
+    {
+        T quotient;
+        T remainder;
+    };
+
+    namespace detail
+    {
+        // 2N λмͣ magic ͳ˷߰벿
+        template <typename T>
+        using Wide = std::conditional_t<sizeof(T) == 4,
+                                        std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>,
+                                        std::conditional_t<std::is_signed_v<T>, __int128, unsigned __int128>>;
+        // -std=c++20 ( gnu++20)  std::make_unsigned  __int128дһ
+        template <typename T>
+        using UnsignedWide = std::conditional_t<sizeof(T) == 4, std::uint64_t, unsigned __int128>;
+
+        // a * b ĸ N λ
+        template <typename T>
+        inline T MulHigh(T a, T b)
+        {
+            return static_cast<T>((Wide<T>(a) * Wide<T>(b)) >> (8 * sizeof(T)));
+        }
+
+#if DIVIDER_HAS_SSE2
+        // SSE2 ֻ 32x32->64  _mm_mul_epu32 ( 02 Ԫ)λõԪ 32 λٳһ
+        inline __m128i MulHighU32(__m128i a, __m128i magic)
+        {
+            const __m128i even = _mm_srli_epi64(_mm_mul_epu32(a, magic), 32);
+            const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), magic);
+            return _mm_or_si128(even, _mm_and_si128(odd, _mm_set_epi32(-1, 0, -1, 0)));
+        }
+
+        // зŸ߰벿 = ޷Ÿ߰벿 - (a < 0 ? m : 0) - (m < 0 ? a : 0)
+        inline __m128i MulHighS32(__m128i a, __m128i magic)
+        {
+            __m128i hi = MulHighU32(a, magic);
+            hi = _mm_sub_epi32(hi, _mm_and_si128(_mm_srai_epi32(a, 31), magic));
+            return _mm_sub_epi32(hi, _mm_and_si128(_mm_srai_epi32(magic, 31), a));
+        }
+
+        //  32 λ˻ (SSE4.1  _mm_mullo_epi32)з޷Žͬ
+        inline __m128i MulLow32(__m128i a, __m128i b)
+        {
+            const __m128i even = _mm_mul_epu32(a, b);
+            const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+            return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                      _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+        }
+#endif
+    } // namespace detail
+
+    template <typename T>
+    class Divider
+    {
+        static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool> && (sizeof(T) == 4 || sizeof(T) == 8),
+                      "Divider: T must be a 32-bit or 64-bit integer");
+
+    public:
+        using Unsigned = std::make_unsigned_t<T>;
+
+        // ÿγ·ɳڹʱ
+        enum class Algorithm : std::uint8_t
+        {
+            Shift,       // |d|  2 
+            Multiply,    // mulhi + λ
+            MultiplyAdd, // magic Ҫ N + 1 λmulhi ٰ֮ѱӻ
+        };
+
+        explicit Divider(T divisor) : m_Divisor(divisor)
+        {
+            if (divisor == 0)
+                throw std::invalid_argument("Divider: division by zero");
+            constexpr bool kSigned = std::is_signed_v<T>;
+            m_Negative = kSigned && divisor < 0;
+            const Unsigned absD = m_Negative ? Unsigned(0) - Unsigned(divisor) : Unsigned(divisor);
+            const unsigned log = static_cast<unsigned>(std::bit_width(absD)) - 1;
+            if ((absD & (absD - 1)) == 0)
+            {
+                m_Algorithm = Algorithm::Shift;
+                m_Shift = static_cast<std::uint8_t>(log);
+                return;
+            }
+
+            // ޷ţfloor(2^(N + log) / d)зţfloor(2^(N - 1 + log) / |d|)װ N λ
+            using UWide = detail::UnsignedWide<T>;
+            const UWide numerator = UWide(1) << (kSigned ? kBits - 1 + log : kBits + log);
+            Unsigned magic = static_cast<Unsigned>(numerator / absD);
+            const Unsigned rem = static_cast<Unsigned>(numerator % absD);
+            if (absD - rem < (Unsigned(1) << log))
+            {
+                // magic + 1 㹻Сָ͹
+                m_Algorithm = Algorithm::Multiply;
+                m_Shift = static_cast<std::uint8_t>(kSigned ? log - 1 : log);
+            }
+            else
+            {
+                // Ҫ 1 λȣmagic  (λ"ӻر")
+                magic += magic;
+                const Unsigned twiceRem = rem + rem;
+                if (twiceRem >= absD || twiceRem < rem)
+                    magic += 1;
+                m_Algorithm = Algorithm::MultiplyAdd;
+                m_Shift = static_cast<std::uint8_t>(log);
+            }
+            magic += 1;
+            m_Magic = m_Negative ? Unsigned(0) - magic : magic;
+        }
+
+        T Divisor() const { return m_Divisor; }
+        Algorithm GetAlgorithm() const { return m_Algorithm; }
+
+        T Quotient(T n) const
+        {
+            switch (m_Algorithm)
+            {
+            case Algorithm::Shift:
+                return QuotientAs<Algorithm::Shift>(n);
+            case Algorithm::Multiply:
+                return QuotientAs<Algorithm::Multiply>(n);
+            default:
+                return QuotientAs<Algorithm::MultiplyAdd>(n);
+            }
+        }
+
+        DivResult<T> DivMod(T n) const
+        {
+            const T q = Quotient(n);
+            return {q, Remainder(n, q)};
+        }
+
+        // 汾֧ѭѡãѭû switchremainders Ϊʱֻ
+        void DivModBatch(std::span<const T> in, std::span<T> quotients, std::span<T> remainders) const
+        {
+            if (quotients.size() < in.size() || (!remainders.empty() && remainders.size() < in.size()))
+                throw std::invalid_argument("Divider: output span is too small");
+            T *r = remainders.empty() ? nullptr : remainders.data();
+            switch (m_Algorithm)
+            {
+            case Algorithm::Shift:
+                BatchAs<Algorithm::Shift>(in.data(), quotients.data(), r, in.size());
+                break;
+            case Algorithm::Multiply:
+                BatchAs<Algorithm::Multiply>(in.data(), quotients.data(), r, in.size());
+                break;
+            default:
+                BatchAs<Algorithm::MultiplyAdd>(in.data(), quotients.data(), r, in.size());
+                break;
+            }
+        }
+
+        friend T operator/(T n, const Divider &d) { return d.Quotient(n); }
+        friend T operator%(T n, const Divider &d) { return d.DivMod(n).remainder; }
+
+    private:
+        static constexpr unsigned kBits = 8 * sizeof(T);
+
+        // һINT_MIN / -1 ޷ƣδΪ
+        T Remainder(T n, T q) const { return static_cast<T>(Unsigned(n) - Unsigned(q) * Unsigned(m_Divisor)); }
+
+        template <Algorithm A>
+        T QuotientAs(T n) const
+        {
+            if constexpr (std::is_unsigned_v<T>)
+            {
+                if constexpr (A == Algorithm::Shift)
+                    return n >> m_Shift;
+                const T q = detail::MulHigh(m_Magic, n);
+                if constexpr (A == Algorithm::Multiply)
+                    return q >> m_Shift;
+                else
+                    return (((n - q) >> 1) + q) >> m_Shift; // (n + q) >> 1 дɲʽ
+            }
+            else
+            {
+                const Unsigned sign = m_Negative ? ~Unsigned(0) : 0; //  (x ^ sign) - sign ʵ޷֧ȡ
+                if constexpr (A == Algorithm::Shift)
+                {
+                    // ȼ 2^s - 1Ʋ 0 ȡ
+                    const Unsigned bias = Unsigned(n >> (kBits - 1)) & ((Unsigned(1) << m_Shift) - 1);
+                    const T q = static_cast<T>(Unsigned(n) + bias) >> m_Shift;
+                    return static_cast<T>((Unsigned(q) ^ sign) - sign);
+                }
+                Unsigned uq = Unsigned(detail::MulHigh(static_cast<T>(m_Magic), n));
+                if constexpr (A == Algorithm::MultiplyAdd)
+                    uq += (Unsigned(n) ^ sign) - sign;
+                const T q = static_cast<T>(uq) >> m_Shift;
+                return q + T(q < 0); // ȡ ->  0 ȡ
+            }
+        }
+
+#if DIVIDER_HAS_SSE2
+        //  QuotientAs һһӦ 4 ·汾 (ֻ 32 λ)
+        template <Algorithm A>
+        __m128i QuotientSse2(__m128i n, __m128i magic, __m128i shift) const
+        {
+            if constexpr (std::is_unsigned_v<T>)
+            {
+                if constexpr (A == Algorithm::Shift)
+                    return _mm_srl_epi32(n, shift);
+                __m128i q = detail::MulHighU32(n, magic);
+                if constexpr (A == Algorithm::MultiplyAdd)
+                    q = _mm_add_epi32(_mm_srli_epi32(_mm_sub_epi32(n, q), 1), q);
+                return _mm_srl_epi32(q, shift);
+            }
+            else
+            {
+                const __m128i sign = _mm_set1_epi32(m_Negative ? -1 : 0);
+                if constexpr (A == Algorithm::Shift)
+                {
+                    const __m128i mask = _mm_set1_epi32(static_cast<int>((Unsigned(1) << m_Shift) - 1));
+                    const __m128i q = _mm_sra_epi32(_mm_add_epi32(n, _mm_and_si128(_mm_srai_epi32(n, 31), mask)), shift);
+                    return _mm_sub_epi32(_mm_xor_si128(q, sign), sign);
+                }
+                __m128i q = detail::MulHighS32(n, magic);
+                if constexpr (A == Algorithm::MultiplyAdd)
+                    q = _mm_add_epi32(q, _mm_sub_epi32(_mm_xor_si128(n, sign), sign));
+                q = _mm_sra_epi32(q, shift);
+                return _mm_sub_epi32(q, _mm_srai_epi32(q, 31));
+            }
+        }
+#endif
+
+        template <Algorithm A>
+        void BatchAs(const T *in, T *q, T *r, std::size_t n) const
+        {
+            std::size_t i = 0;
+#if DIVIDER_HAS_SSE2
+            if constexpr (sizeof(T) == 4)
+            {
+                const __m128i magic = _mm_set1_epi32(static_cast<int>(m_Magic));
+                const __m128i shift = _mm_cvtsi32_si128(m_Shift);
+                const __m128i divisor = _mm_set1_epi32(static_cast<int>(m_Divisor));
+                for (; i + 4 <= n; i += 4)
+                {
+                    const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+                    const __m128i quot = QuotientSse2<A>(x, magic, shift);
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(q + i), quot);
+                    if (r)
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(r + i), _mm_sub_epi32(x, detail::MulLow32(quot, divisor)));
+                }
+            }
+#endif
+            // 64 λͣSSE2/AVX2 û 64x64 ĸ߰˷ (Ȼû div ָ)
+            for (; i < n; i++)
+            {
+                q[i] = QuotientAs<A>(in[i]);
+                if (r)
+                    r[i] = Remainder(in[i], q[i]);
+            }
+        }
+
+        T m_Divisor;
+        Unsigned m_Magic = 0;
+        std::uint8_t m_Shift = 0;
+        Algorithm m_Algorithm = Algorithm::Shift;
+        bool m_Negative = false;
+    };
+
+    // ==========================================
+    //  09_Mutiple_return_values.md  divide(a, b, result, remainder) ӦĽӿ
+    // ==========================================
+    // auto [q, r] = fastdiv::divide(a, divider);
+    template <typename T>
+    DivResult<T> divide(T a, const Divider<T> &b)
+    {
+        return b.DivMod(a);
+    }
+
+    // һin[i] / b д quotients[i]д remainders[i] (remainders Ϊ)
+    // T ֻ Divider Ƶvector ֱӴ (ʽתΪ span)
+    template <typename T>
+    void divide(std::type_identity_t<std::span<const T>> in, const Divider<T> &b,
+                std::type_identity_t<std::span<T>> quotients, std::type_identity_t<std::span<T>> remainders)
+    {
+        b.DivModBatch(in, quotients, remainders);
+    }
+} // namespace fastdiv
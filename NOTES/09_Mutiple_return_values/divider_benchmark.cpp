@@ -0,0 +1,178 @@
+/**
+ * @file divider_benchmark.cpp
+ * @brief ڳʹãӲ /  % vs fastdiv::Divider ( / SSE2 )int32/uint32/int64/uint64 ȫóȶ
+ * @note : g++ -O3 -std=c++20 divider_benchmark.cpp -o divider_benchmark
+ *       : ./divider_benchmark [ԪظĬ 10000000]
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "Divider.h"
+#include "../23_Benchmarking/Timer.h"
+
+using fastdiv::Divider;
+
+// ==========================================
+// 1. ԭд09_Mutiple_return_values.md  4
+// ==========================================
+template <typename T>
+bool divide(T a, T b, T &result, T &remainder)
+{
+    if (b == 0)
+        return false; // 
+    result = a / b;
+    remainder = a % b;
+    return true;
+}
+
+// ==========================================
+// 2. ȷԣֳ (2 ݡֵ) x ֱ / % ȶ
+// ==========================================
+template <typename T>
+std::vector<T> InterestingValues(std::mt19937_64 &rng)
+{
+    constexpr T kMax = std::numeric_limits<T>::max();
+    constexpr T kMin = std::numeric_limits<T>::min();
+    std::vector<T> v = {0, 1, 2, 3, 7, 10, 641, 1000, kMax, kMax - 1, kMax / 2, kMax / 3 + 1};
+    if constexpr (std::is_signed_v<T>)
+        v.insert(v.end(), {-1, -2, -3, -7, -10, -1000, kMin, kMin + 1, kMin / 3});
+    for (unsigned s = 0; s < 8 * sizeof(T); s++)
+        v.push_back(static_cast<T>(std::make_unsigned_t<T>(1) << s)); // 2  (зʱλ kMin)
+    for (int i = 0; i < 200; i++)
+    {
+        v.push_back(static_cast<T>(rng()));
+        v.push_back(static_cast<T>(rng() % 100000));
+    }
+    return v;
+}
+
+template <typename T>
+bool SelfCheck(const char *name)
+{
+    std::mt19937_64 rng(sizeof(T) * 2 + std::is_signed_v<T>);
+    std::vector<T> values = InterestingValues<T>(rng);
+    std::vector<T> q(values.size()), r(values.size());
+    bool ok = true;
+    for (T d : values)
+    {
+        if (d == 0)
+            continue;
+        Divider<T> divider(d);
+        std::vector<T> numerators;
+        for (T n : values)
+            if (!(std::is_signed_v<T> && d == T(-1) && n == std::numeric_limits<T>::min())) // óҲ
+                numerators.push_back(n);
+        for (T n : numerators)
+        {
+            auto [quotient, remainder] = fastdiv::divide(n, divider);
+            ok = ok && quotient == n / d && remainder == n % d;
+        }
+        // ӿڣȲ 4 ı SIMD ѭβ
+        fastdiv::divide(std::span<const T>(numerators.data(), numerators.size() - 1), divider, q, r);
+        for (std::size_t i = 0; i + 1 < numerators.size(); i++)
+            ok = ok && q[i] == numerators[i] / d && r[i] == numerators[i] % d;
+    }
+    std::cout << "  " << name << ": " << (ok ? "OK" : "FAILED") << std::endl;
+    return ok;
+}
+
+// ==========================================
+// 3. ׼n ͬһڳ
+// ==========================================
+template <typename T>
+void Benchmark(const char *name, std::size_t n, T divisor)
+{
+    std::mt19937_64 rng(1);
+    std::vector<T> in(n), q(n), r(n);
+    for (T &x : in)
+        x = static_cast<T>(rng());
+
+    std::cout << "-- " << name << " / " << +divisor << " --" << std::endl;
+    std::uint64_t checksum[4] = {};
+    {
+        Timer timer("divide(a, b, result, remainder) (hardware div)", n);
+        for (std::size_t i = 0; i < n; i++)
+            divide(in[i], divisor, q[i], r[i]);
+    }
+    for (std::size_t i = 0; i < n; i++)
+        checksum[0] += std::uint64_t(q[i]) ^ std::uint64_t(r[i]);
+
+    Divider<T> divider(divisor);
+    {
+        Timer timer("auto [q, r] = divide(a, divider)", n);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            auto [quotient, remainder] = fastdiv::divide(in[i], divider);
+            q[i] = quotient;
+            r[i] = remainder;
+        }
+    }
+    for (std::size_t i = 0; i < n; i++)
+        checksum[1] += std::uint64_t(q[i]) ^ std::uint64_t(r[i]);
+    {
+        Timer timer("divide(span in, divider, span q, span r) (batch)", n);
+        fastdiv::divide(in, divider, q, r);
+    }
+    for (std::size_t i = 0; i < n; i++)
+        checksum[2] += std::uint64_t(q[i]) ^ std::uint64_t(r[i]);
+
+    // ֻҪ̣Ӳ vs 
+    {
+        Timer timer("quotient only: a / b (hardware div)", n);
+        for (std::size_t i = 0; i < n; i++)
+            q[i] = in[i] / divisor;
+    }
+    for (std::size_t i = 0; i < n; i++)
+        checksum[3] += std::uint64_t(q[i]);
+    std::uint64_t batchQuotients = 0;
+    {
+        Timer timer("quotient only: batch", n);
+        fastdiv::divide(in, divider, q, {});
+    }
+    for (std::size_t i = 0; i < n; i++)
+        batchQuotients += std::uint64_t(q[i]);
+    DoNotOptimize(checksum);
+    bool same = checksum[0] == checksum[1] && checksum[1] == checksum[2] && checksum[3] == batchQuotients;
+    std::cout << "  results " << (same ? "identical" : "DIFFER") << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+
+    std::cout << "=== 0. Structured binding demo ===" << std::endl;
+    Divider<int> three(3);
+    auto [res, rem] = fastdiv::divide(10, three);
+    std::cout << "  10 / 3 = " << res << " ... " << rem << std::endl;
+    try
+    {
+        Divider<int> zero(0);
+    }
+    catch (const std::invalid_argument &e)
+    {
+        std::cout << "  Error caught: " << e.what() << std::endl;
+    }
+
+    std::cout << "\n=== 1. Self-check vs built-in / and % ===" << std::endl;
+    bool ok = SelfCheck<std::int32_t>("int32_t") & SelfCheck<std::uint32_t>("uint32_t") &
+              SelfCheck<std::int64_t>("int64_t") & SelfCheck<std::uint64_t>("uint64_t");
+    if (!ok)
+        return 1;
+
+    // volatileڱڲɼֹ a / 7 ԼŻɳ˷
+    volatile int seven = 7, thousand = 1000, pow2 = 1024;
+    std::cout << "\n=== 2. " << n << " numbers / the same runtime divisor (Run in Release Mode! -O3) ===" << std::endl;
+    Benchmark<std::uint32_t>("uint32_t", n, static_cast<std::uint32_t>(seven));
+    Benchmark<std::int32_t>("int32_t", n, -thousand);
+    Benchmark<std::uint64_t>("uint64_t", n, static_cast<std::uint64_t>(seven));
+    Benchmark<std::int64_t>("int64_t", n, thousand);
+    Benchmark<std::uint32_t>("uint32_t", n, static_cast<std::uint32_t>(pow2));
+    return 0;
+}
@@ -0,0 +1,398 @@
+/**
+ * @file StackArray.h
+ * @brief Templates.md  StackArray ""ڶ StackArray<T, N>
+ *        붨ѷ InlineVector<T, N> SIMD ػ Fill/Sum/Min/Max
+ * @note : Ҫ C++17 (if constexpr)x86 Ͽ -mavx2  256 λ·
+ *
+ * ʼԭ
+ *   1. operator[] ߽ ( std::array һ)ѭԱԶ
+ *   2. at() 飬Խ std::out_of_rangeķ T()
+ *   3. ȫԱ constexprڱڹֵ
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#define STACK_ARRAY_HAS_SSE2 1
+#endif
+
+// ==========================================
+// 1. StackArray<T, N> (С ==  == N)
+// ==========================================
+template <typename T, std::size_t N>
+class StackArray
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T *;
+    using const_iterator = const T *;
+
+    T m_Data[N > 0 ? N : 1]; // ۺ֧ͣ StackArray<int, 3> a = {1, 2, 3};
+
+    static constexpr size_type size() { return N; }
+    static constexpr size_type GetSize() { return N; } // ݱʼԭӿ
+
+    // ·߽
+    constexpr T &operator[](size_type index) { return m_Data[index]; }
+    constexpr const T &operator[](size_type index) const { return m_Data[index]; }
+
+    // ȫ·Խ쳣
+    constexpr T &at(size_type index)
+    {
+        if (index >= N)
+            throw std::out_of_range("StackArray::at");
+        return m_Data[index];
+    }
+    constexpr const T &at(size_type index) const
+    {
+        if (index >= N)
+            throw std::out_of_range("StackArray::at");
+        return m_Data[index];
+    }
+
+    constexpr T *data() { return m_Data; }
+    constexpr const T *data() const { return m_Data; }
+
+    constexpr iterator begin() { return m_Data; }
+    constexpr iterator end() { return m_Data + N; }
+    constexpr const_iterator begin() const { return m_Data; }
+    constexpr const_iterator end() const { return m_Data + N; }
+
+    void PrintAll() const
+    {
+        std::cout << "[StackArray<" << N << ">] ";
+        for (size_type i = 0; i < N; i++)
+            std::cout << m_Data[i] << " ";
+        std::cout << std::endl;
+    }
+};
+
+// ==========================================
+// 2. InlineVector<T, N>̶Ϊ N  "vector"ȫǶڶ
+// ==========================================
+// Ҫ T ĬϹ죺δʹõĲλ T() ״̬ constexpr 
+template <typename T, std::size_t N>
+class InlineVector
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T *;
+    using const_iterator = const T *;
+
+    constexpr InlineVector() = default;
+
+    // ĬϳԱʼȰвλΪ T() (C++17  constexpr 캯ʼÿԱ)
+    // ֻǰ count ֵֻǶǰ count λһ㣬 N չκδ
+    constexpr InlineVector(size_type count, const T &value)
+    {
+        if (count > N)
+            throw std::length_error("InlineVector: count > capacity");
+        for (; m_Size < count; m_Size++)
+            m_Data[m_Size] = value;
+    }
+
+    constexpr InlineVector(std::initializer_list<T> init)
+    {
+        if (init.size() > N)
+            throw std::length_error("InlineVector: initializer_list > capacity");
+        for (const T &value : init)
+            m_Data[m_Size++] = value;
+    }
+
+    static constexpr size_type capacity() { return N; }
+    constexpr size_type size() const { return m_Size; }
+    constexpr bool empty() const { return m_Size == 0; }
+    constexpr bool full() const { return m_Size == N; }
+
+    constexpr T &operator[](size_type index) { return m_Data[index]; }
+    constexpr const T &operator[](size_type index) const { return m_Data[index]; }
+
+    constexpr T &at(size_type index)
+    {
+        if (index >= m_Size)
+            throw std::out_of_range("InlineVector::at");
+        return m_Data[index];
+    }
+    constexpr const T &at(size_type index) const
+    {
+        if (index >= m_Size)
+            throw std::out_of_range("InlineVector::at");
+        return m_Data[index];
+    }
+
+    // ʱ쳣 ( std::vector һȥ)
+    constexpr void push_back(const T &value)
+    {
+        if (m_Size == N)
+            throw std::length_error("InlineVector::push_back: full");
+        m_Data[m_Size++] = value;
+    }
+    constexpr void push_back(T &&value)
+    {
+        if (m_Size == N)
+            throw std::length_error("InlineVector::push_back: full");
+        m_Data[m_Size++] = static_cast<T &&>(value);
+    }
+
+    // ·汾֤߱ !full()
+    constexpr void push_back_unchecked(const T &value) { m_Data[m_Size++] = value; }
+
+    constexpr void pop_back() { m_Data[--m_Size] = T(); }
+
+    constexpr void clear()
+    {
+        for (size_type i = 0; i < m_Size; i++)
+            m_Data[i] = T();
+        m_Size = 0;
+    }
+
+    constexpr void resize(size_type count, const T &value = T())
+    {
+        if (count > N)
+            throw std::length_error("InlineVector::resize: count > capacity");
+        for (size_type i = m_Size; i < count; i++)
+            m_Data[i] = value;
+        for (size_type i = count; i < m_Size; i++)
+            m_Data[i] = T();
+        m_Size = count;
+    }
+
+    constexpr T &front() { return m_Data[0]; }
+    constexpr T &back() { return m_Data[m_Size - 1]; }
+    constexpr const T &front() const { return m_Data[0]; }
+    constexpr const T &back() const { return m_Data[m_Size - 1]; }
+
+    constexpr T *data() { return m_Data; }
+    constexpr const T *data() const { return m_Data; }
+
+    constexpr iterator begin() { return m_Data; }
+    constexpr iterator end() { return m_Data + m_Size; }
+    constexpr const_iterator begin() const { return m_Data; }
+    constexpr const_iterator end() const { return m_Data + m_Size; }
+
+private:
+    T m_Data[N > 0 ? N : 1]{};
+    size_type m_Size = 0;
+};
+
+// ==========================================
+// 3. SIMD 㷨Fill / Sum / Min / Max
+// ==========================================
+// ͨð汾 4 ۼ
+// float / double / int32  x86 д SSE2 / AVX2 ػ
+// ע⣺͵Ľ˳봮а汾ͬλĲ졣
+// ѭϽд n / 4 * 4  n - i >= 4 / i + 4 <= nn Ǳڳʱ
+// д GCC  -O2 ¶Ѿ߲ıβѭ -Waggressive-loop-optimizations
+namespace simd
+{
+    namespace detail
+    {
+        template <typename T>
+        constexpr T MinOf(T a, T b) { return b < a ? b : a; }
+        template <typename T>
+        constexpr T MaxOf(T a, T b) { return a < b ? b : a; }
+
+        template <typename T>
+        constexpr T SumScalar(const T *p, std::size_t n)
+        {
+            T acc0{}, acc1{}, acc2{}, acc3{};
+            std::size_t i = 0;
+            for (; i < n / 4 * 4; i += 4)
+            {
+                acc0 += p[i];
+                acc1 += p[i + 1];
+                acc2 += p[i + 2];
+                acc3 += p[i + 3];
+            }
+            for (; i < n; i++)
+                acc0 += p[i];
+            return (acc0 + acc1) + (acc2 + acc3);
+        }
+
+        // Min/Max ͨð汾Less Ϊ true ʱСֵ
+        template <bool Less, typename T>
+        constexpr T ReduceScalar(const T *p, std::size_t n)
+        {
+            T best = p[0];
+            for (std::size_t i = 1; i < n; i++)
+                best = Less ? MinOf(best, p[i]) : MaxOf(best, p[i]);
+            return best;
+        }
+
+#ifdef STACK_ARRAY_HAS_SSE2
+        inline float SumFloat(const float *p, std::size_t n)
+        {
+            std::size_t i = 0;
+#ifdef __AVX2__
+            __m256 acc8 = _mm256_setzero_ps();
+            for (; i < n / 8 * 8; i += 8)
+                acc8 = _mm256_add_ps(acc8, _mm256_loadu_ps(p + i));
+            __m128 acc = _mm_add_ps(_mm256_castps256_ps128(acc8), _mm256_extractf128_ps(acc8, 1));
+#else
+            __m128 acc = _mm_setzero_ps();
+#endif
+            for (; i < n / 4 * 4; i += 4)
+                acc = _mm_add_ps(acc, _mm_loadu_ps(p + i));
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, acc);
+            float sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+            for (; i < n; i++)
+                sum += p[i];
+            return sum;
+        }
+
+        inline double SumDouble(const double *p, std::size_t n)
+        {
+            std::size_t i = 0;
+            __m128d acc0 = _mm_setzero_pd(), acc1 = _mm_setzero_pd();
+            for (; i < n / 4 * 4; i += 4)
+            {
+                acc0 = _mm_add_pd(acc0, _mm_loadu_pd(p + i));
+                acc1 = _mm_add_pd(acc1, _mm_loadu_pd(p + i + 2));
+            }
+            alignas(16) double lanes[2];
+            _mm_store_pd(lanes, _mm_add_pd(acc0, acc1));
+            double sum = lanes[0] + lanes[1];
+            for (; i < n; i++)
+                sum += p[i];
+            return sum;
+        }
+
+        // int32 ͣһ 2^32 ȡģ
+        inline int SumInt32(const int *p, std::size_t n)
+        {
+            std::size_t i = 0;
+#ifdef __AVX2__
+            __m256i acc8 = _mm256_setzero_si256();
+            for (; i < n / 8 * 8; i += 8)
+                acc8 = _mm256_add_epi32(acc8, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i)));
+            __m128i acc = _mm_add_epi32(_mm256_castsi256_si128(acc8), _mm256_extracti128_si256(acc8, 1));
+#else
+            __m128i acc = _mm_setzero_si128();
+#endif
+            for (; i < n / 4 * 4; i += 4)
+                acc = _mm_add_epi32(acc, _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i)));
+            alignas(16) int lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i *>(lanes), acc);
+            unsigned sum = 0u + lanes[0] + lanes[1] + lanes[2] + lanes[3];
+            for (; i < n; i++)
+                sum += static_cast<unsigned>(p[i]);
+            return static_cast<int>(sum);
+        }
+
+        template <bool Less>
+        inline float ReduceFloat(const float *p, std::size_t n)
+        {
+            if (n < 4)
+                return ReduceScalar<Less>(p, n);
+            __m128 best = _mm_loadu_ps(p);
+            std::size_t i = 4;
+            for (; i < n / 4 * 4; i += 4)
+            {
+                __m128 v = _mm_loadu_ps(p + i);
+                best = Less ? _mm_min_ps(best, v) : _mm_max_ps(best, v);
+            }
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, best);
+            float result = ReduceScalar<Less>(lanes, 4);
+            for (; i < n; i++)
+                result = Less ? MinOf(result, p[i]) : MaxOf(result, p[i]);
+            return result;
+        }
+
+        inline void FillFloat(float *p, std::size_t n, float value)
+        {
+            std::size_t i = 0;
+            __m128 v = _mm_set1_ps(value);
+            for (; i < n / 4 * 4; i += 4)
+                _mm_storeu_ps(p + i, v);
+            for (; i < n; i++)
+                p[i] = value;
+        }
+
+        inline void FillInt32(int *p, std::size_t n, int value)
+        {
+            std::size_t i = 0;
+            __m128i v = _mm_set1_epi32(value);
+            for (; i < n / 4 * 4; i += 4)
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(p + i), v);
+            for (; i < n; i++)
+                p[i] = value;
+        }
+#endif
+    } // namespace detail
+
+    template <typename T>
+    inline void Fill(T *p, std::size_t n, const T &value)
+    {
+#ifdef STACK_ARRAY_HAS_SSE2
+        if constexpr (std::is_same_v<T, float>)
+            return detail::FillFloat(p, n, value);
+        else if constexpr (std::is_same_v<T, int>)
+            return detail::FillInt32(p, n, value);
+        else
+#endif
+            for (std::size_t i = 0; i < n; i++)
+                p[i] = value;
+    }
+
+    template <typename T>
+    inline T Sum(const T *p, std::size_t n)
+    {
+#ifdef STACK_ARRAY_HAS_SSE2
+        if constexpr (std::is_same_v<T, float>)
+            return detail::SumFloat(p, n);
+        else if constexpr (std::is_same_v<T, double>)
+            return detail::SumDouble(p, n);
+        else if constexpr (std::is_same_v<T, int>)
+            return detail::SumInt32(p, n);
+        else
+#endif
+            return detail::SumScalar(p, n);
+    }
+
+    // Min / Max Ҫ n > 0汾 NaN ( std::min һ£ NaN δ)
+    template <typename T>
+    inline T Min(const T *p, std::size_t n)
+    {
+#ifdef STACK_ARRAY_HAS_SSE2
+        if constexpr (std::is_same_v<T, float>)
+            return detail::ReduceFloat<true>(p, n);
+        else
+#endif
+            return detail::ReduceScalar<true>(p, n);
+    }
+
+    template <typename T>
+    inline T Max(const T *p, std::size_t n)
+    {
+#ifdef STACK_ARRAY_HAS_SSE2
+        if constexpr (std::is_same_v<T, float>)
+            return detail::ReduceFloat<false>(p, n);
+        else
+#endif
+            return detail::ReduceScalar<false>(p, n);
+    }
+
+    // أκ data()/size()  (StackArray, InlineVector, std::array, std::vector)
+    template <typename Container, typename T>
+    inline void Fill(Container &c, const T &value)
+    {
+        Fill(c.data(), c.size(), static_cast<typename Container::value_type>(value));
+    }
+    template <typename Container>
+    inline auto Sum(const Container &c) { return Sum(c.data(), c.size()); }
+    template <typename Container>
+    inline auto Min(const Container &c) { return Min(c.data(), c.size()); }
+    template <typename Container>
+    inline auto Max(const Container &c) { return Max(c.data(), c.size()); }
+} // namespace simd
@@ -0,0 +1,181 @@
+/**
+ * @file stack_array_benchmark.cpp
+ * @brief StackArray / InlineVector ÷ʾԼ std::arraystd::vector "С"ϵܶԱ
+ * @note : g++ -O3 -std=c++17 -march=native stack_array_benchmark.cpp -o stack_array_benchmark
+ */
+
+#include <array>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "StackArray.h"
+#include "../23_Benchmarking/Timer.h"
+
+// ==========================================
+// 1. ֵڱڹ첢
+// ==========================================
+constexpr int CompileTimeSum()
+{
+    InlineVector<int, 8> v = {1, 2, 3};
+    v.push_back(4);
+    int sum = 0;
+    for (int x : v)
+        sum += x;
+    return sum;
+}
+static_assert(CompileTimeSum() == 10, "InlineVector Ӧڱֵ");
+
+constexpr StackArray<int, 3> kPrimes = {2, 3, 5};
+static_assert(kPrimes[2] == 5 && kPrimes.size() == 3, "StackArray Ǿۺͣ constexpr ʼ");
+
+constexpr InlineVector<int, 4096> kSevens(3, 7);
+static_assert(kSevens.size() == 3 && kSevens[2] == 7 && kSevens[3] == 0, "(count, value) ڱҲãδʹõĲλ T()");
+
+// ==========================================
+// 2. ׼ԣÿؽһС -> Fill -> ޸ -> Sum/Min/Max
+// ==========================================
+// ģ"֡ʱС"ÿεҪ½std::vector ÿζҪһζѷ
+constexpr std::size_t kSmall = 64;
+constexpr int kRounds = 2000000;
+
+template <typename Container>
+float HotLoop(Container &c, int round)
+{
+    simd::Fill(c, 1.0f);
+    for (std::size_t i = 0; i < c.size(); i++)
+        c[i] += static_cast<float>((i + round) & 7); // ޱ߽ operator[]
+    return simd::Sum(c) + simd::Min(c) - simd::Max(c);
+}
+
+// 飺ԭ StackArray ÿ Set/Get ߽粢ֵ
+template <typename T, int N>
+class CheckedStackArray
+{
+private:
+    T m_Data[N];
+
+public:
+    void Set(int index, T value)
+    {
+        if (index >= 0 && index < N)
+            m_Data[index] = value;
+    }
+    T Get(int index) const
+    {
+        if (index >= 0 && index < N)
+            return m_Data[index];
+        return T();
+    }
+};
+
+void BenchCheckedStackArray()
+{
+    Timer timer("Checked StackArray (Set/Get)", kRounds);
+    float total = 0.0f;
+    for (int r = 0; r < kRounds; r++)
+    {
+        CheckedStackArray<float, kSmall> a;
+        for (int i = 0; i < static_cast<int>(kSmall); i++)
+            a.Set(i, 1.0f);
+        for (int i = 0; i < static_cast<int>(kSmall); i++)
+            a.Set(i, a.Get(i) + static_cast<float>((i + r) & 7));
+        float sum = 0.0f, mn = a.Get(0), mx = a.Get(0);
+        for (int i = 0; i < static_cast<int>(kSmall); i++)
+        {
+            float v = a.Get(i);
+            sum += v;
+            mn = v < mn ? v : mn;
+            mx = v > mx ? v : mx;
+        }
+        total += sum + mn - mx;
+    }
+    DoNotOptimize(total);
+}
+
+void BenchStackArray()
+{
+    Timer timer("StackArray<float, 64>", kRounds);
+    float total = 0.0f;
+    for (int r = 0; r < kRounds; r++)
+    {
+        StackArray<float, kSmall> a;
+        total += HotLoop(a, r);
+    }
+    DoNotOptimize(total);
+}
+
+void BenchInlineVector()
+{
+    Timer timer("InlineVector<float, 64>", kRounds);
+    float total = 0.0f;
+    for (int r = 0; r < kRounds; r++)
+    {
+        InlineVector<float, kSmall> v(kSmall, 0.0f);
+        total += HotLoop(v, r);
+    }
+    DoNotOptimize(total);
+}
+
+void BenchStdArray()
+{
+    Timer timer("std::array<float, 64>", kRounds);
+    float total = 0.0f;
+    for (int r = 0; r < kRounds; r++)
+    {
+        std::array<float, kSmall> a;
+        total += HotLoop(a, r);
+    }
+    DoNotOptimize(total);
+}
+
+void BenchStdVector()
+{
+    Timer timer("std::vector<float>(64)", kRounds);
+    float total = 0.0f;
+    for (int r = 0; r < kRounds; r++)
+    {
+        std::vector<float> v(kSmall); // ÿһ new/delete
+        total += HotLoop(v, r);
+    }
+    DoNotOptimize(total);
+}
+
+int main()
+{
+    std::cout << "=== 1. Basic Usage ===" << std::endl;
+    StackArray<int, 5> intArray = {};
+    for (std::size_t i = 0; i < intArray.size(); i++)
+        intArray[i] = static_cast<int>(i * 10);
+    intArray.PrintAll();
+    std::cout << "Sum = " << simd::Sum(intArray) << ", Max = " << simd::Max(intArray) << std::endl;
+
+    InlineVector<std::string, 3> names;
+    names.push_back("C++");
+    names.push_back("Templates");
+    for (const auto &name : names)
+        std::cout << name << " ";
+    std::cout << "(size " << names.size() << " / capacity " << names.capacity() << ")" << std::endl;
+
+    try
+    {
+        names.at(2); //  3 λڣδ pushat() Ȼ
+    }
+    catch (const std::out_of_range &e)
+    {
+        std::cout << "at() caught: " << e.what() << std::endl;
+    }
+
+    std::cout << "\n=== 2. Benchmark (" << kRounds << " rounds x " << kSmall << " floats) ===" << std::endl;
+    for (int pass = 0; pass < 2; pass++)
+    {
+        BenchCheckedStackArray();
+        BenchStackArray();
+        BenchInlineVector();
+        BenchStdArray();
+        BenchStdVector();
+        std::cout << "--------------------------------" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,213 @@
+/**
+ * @file Function.h
+ * @brief  std::function "ɵöװ"
+ *        1. InplaceFunction<Sig, Capacity>ӵȨհڶڲĹ̶ѷ
+ *        2. FunctionRef<Sig>ӵȨָֻСʺΪص
+ * @note Ҫ C++17
+ *
+ * std::function ĿͲ (ӵ)հʱĶѷ䡢Լ const& εµĶá
+ * InplaceFunction ȥ˶ѷ (հŲֱӱ뱨)FunctionRef հʡˡ
+ * صҪ棬Ȼģ ( function_benchmark.cpp еģ ForEach)ܱȫ
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template <typename Signature, std::size_t Capacity = 32>
+class InplaceFunction;
+
+template <typename Signature>
+class FunctionRef;
+
+// ==========================================
+// 1. InplaceFunctionС (Small Buffer)  std::function
+// ==========================================
+template <typename R, typename... Args, std::size_t Capacity>
+class InplaceFunction<R(Args...), Capacity>
+{
+private:
+    // д"麯"ÿֱհͶӦһ龲̬
+    using InvokeFn = R (*)(void *, Args &&...);
+    using ManageFn = void (*)(void *dst, void *src, int op);
+
+    enum Op
+    {
+        kCopy = 0,
+        kMove = 1,
+        kDestroy = 2
+    };
+
+    template <typename F>
+    static R InvokeImpl(void *obj, Args &&...args)
+    {
+        // R Ϊ void ʱֵvoid(int) Ҳܰ󶨷 int  Lambda
+        if constexpr (std::is_void_v<R>)
+            (*static_cast<F *>(obj))(std::forward<Args>(args)...);
+        else
+            return (*static_cast<F *>(obj))(std::forward<Args>(args)...);
+    }
+
+    template <typename F>
+    static void ManageImpl(void *dst, void *src, int op)
+    {
+        switch (op)
+        {
+        case kCopy:
+            ::new (dst) F(*static_cast<const F *>(src));
+            break;
+        case kMove:
+            ::new (dst) F(std::move(*static_cast<F *>(src)));
+            static_cast<F *>(src)->~F();
+            break;
+        case kDestroy:
+            static_cast<F *>(dst)->~F();
+            break;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char m_Storage[Capacity];
+    InvokeFn m_Invoke = nullptr;
+    ManageFn m_Manage = nullptr;
+
+public:
+    InplaceFunction() noexcept = default;
+    InplaceFunction(std::nullptr_t) noexcept {}
+
+    template <typename F,
+              typename D = std::decay_t<F>,
+              typename = std::enable_if_t<!std::is_same_v<D, InplaceFunction> &&
+                                          std::is_invocable_r_v<R, D &, Args...>>>
+    InplaceFunction(F &&f)
+    {
+        // Ų¾ڱڱ std::function һȥϷ
+        static_assert(sizeof(D) <= Capacity, "InplaceFunction: հ̫ Capacity");
+        static_assert(alignof(D) <= alignof(std::max_align_t), "InplaceFunction: հҪ");
+        static_assert(std::is_copy_constructible_v<D>, "InplaceFunction: հɿ");
+        ::new (static_cast<void *>(m_Storage)) D(std::forward<F>(f));
+        m_Invoke = &InvokeImpl<D>;
+        m_Manage = &ManageImpl<D>;
+    }
+
+    InplaceFunction(const InplaceFunction &other)
+    {
+        if (other.m_Manage)
+        {
+            other.m_Manage(m_Storage, const_cast<unsigned char *>(other.m_Storage), kCopy);
+            m_Invoke = other.m_Invoke;
+            m_Manage = other.m_Manage;
+        }
+    }
+
+    InplaceFunction(InplaceFunction &&other) noexcept
+    {
+        if (other.m_Manage)
+        {
+            other.m_Manage(m_Storage, other.m_Storage, kMove);
+            m_Invoke = other.m_Invoke;
+            m_Manage = other.m_Manage;
+            other.m_Invoke = nullptr;
+            other.m_Manage = nullptr;
+        }
+    }
+
+    InplaceFunction &operator=(const InplaceFunction &other)
+    {
+        if (this != &other)
+        {
+            InplaceFunction tmp(other);
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+
+    InplaceFunction &operator=(InplaceFunction &&other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            if (other.m_Manage)
+            {
+                other.m_Manage(m_Storage, other.m_Storage, kMove);
+                m_Invoke = other.m_Invoke;
+                m_Manage = other.m_Manage;
+                other.m_Invoke = nullptr;
+                other.m_Manage = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    ~InplaceFunction() { Reset(); }
+
+    void Reset() noexcept
+    {
+        if (m_Manage)
+        {
+            m_Manage(m_Storage, nullptr, kDestroy);
+            m_Invoke = nullptr;
+            m_Manage = nullptr;
+        }
+    }
+
+    explicit operator bool() const noexcept { return m_Invoke != nullptr; }
+
+    //  std::function һ£operator()  const ģÿɱհ
+    R operator()(Args... args) const
+    {
+        return m_Invoke(const_cast<unsigned char *>(m_Storage), std::forward<Args>(args)...);
+    }
+};
+
+// ==========================================
+// 2. FunctionRefӵеĿɵö (ָС)
+// ==========================================
+// ע⣺FunctionRef ӳöڣҪʱ Lambda 󶨺󱣴
+template <typename R, typename... Args>
+class FunctionRef<R(Args...)>
+{
+private:
+    using InvokeFn = R (*)(void *, Args &&...);
+
+    void *m_Object = nullptr;
+    InvokeFn m_Invoke = nullptr;
+
+    template <typename F>
+    static R InvokeObject(void *obj, Args &&...args)
+    {
+        // R Ϊ void ʱֵvoid(int) Ҳܰ󶨷 int  Lambda
+        if constexpr (std::is_void_v<R>)
+            (*static_cast<F *>(obj))(std::forward<Args>(args)...);
+        else
+            return (*static_cast<F *>(obj))(std::forward<Args>(args)...);
+    }
+
+    template <typename FnPtr>
+    static R InvokeFunctionPointer(void *obj, Args &&...args)
+    {
+        return reinterpret_cast<FnPtr>(obj)(std::forward<Args>(args)...);
+    }
+
+public:
+    // ֱͨӱ溯ַ (ָ -> void* תƽ̨϶֧)
+    FunctionRef(R (*fn)(Args...)) noexcept
+        : m_Object(reinterpret_cast<void *>(fn)), m_Invoke(&InvokeFunctionPointer<R (*)(Args...)>) {}
+
+    template <typename F,
+              typename D = std::remove_reference_t<F>,
+              typename = std::enable_if_t<!std::is_same_v<std::remove_cv_t<D>, FunctionRef> &&
+                                          !std::is_function_v<D> &&
+                                          std::is_invocable_r_v<R, D &, Args...>>>
+    FunctionRef(F &&f) noexcept
+        : m_Object(const_cast<void *>(static_cast<const void *>(std::addressof(f)))),
+          m_Invoke(&InvokeObject<D>) {}
+
+    R operator()(Args... args) const
+    {
+        return m_Invoke(m_Object, std::forward<Args>(args)...);
+    }
+};
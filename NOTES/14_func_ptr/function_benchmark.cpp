@@ -0,0 +1,163 @@
+/**
+ * @file function_benchmark.cpp
+ * @brief Ա 5 ֻصʽ 1 ڸԪصĺʱ
+ *        ָ ForEach / std::function ForEachModern / InplaceFunction / FunctionRef / ģ ForEach
+ * @note : g++ -O3 -std=c++17 function_benchmark.cpp -o function_benchmark
+ *       : ./function_benchmark [ԪظĬ 100000000]
+ */
+
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+#include "Function.h"
+#include "../23_Benchmarking/Timer.h"
+
+using namespace std;
+
+// ֹÿ ForEach "Ŀ⺯"ݲԱȣ
+// ܰѺָ볣ȥľͲǻصʵ
+#if defined(__GNUC__) || defined(__clang__)
+#define NOINLINE __attribute__((noinline))
+#else
+#define NOINLINE __declspec(noinline)
+#endif
+
+// ==========================================
+// 1.  ForEach
+// ==========================================
+// (1) ԭʼָ (ʼԭ)
+NOINLINE void ForEach(const vector<int> &values, void (*func)(int))
+{
+    for (int value : values)
+        func(value);
+}
+
+// (2) std::function (ʼԭ)
+NOINLINE void ForEachModern(const vector<int> &values, const std::function<void(int)> &func)
+{
+    for (int value : values)
+        func(value);
+}
+
+// (3) InplaceFunction std::function һӵбհӲѷ
+NOINLINE void ForEachInplace(const vector<int> &values, const InplaceFunction<void(int), 48> &func)
+{
+    for (int value : values)
+        func(value);
+}
+
+// (4) FunctionRefֻñհֵ (ָڼĴ)
+NOINLINE void ForEachRef(const vector<int> &values, FunctionRef<void(int)> func)
+{
+    for (int value : values)
+        func(value);
+}
+
+// (5) ģ壺ÿ Lambda һרŵѭñȫԱ
+template <typename Func>
+void ForEach(const vector<int> &values, Func &&func)
+{
+    for (int value : values)
+        func(value);
+}
+
+// ==========================================
+// 2. صݣ״̬ۼ (ָֻܽȫֱ)
+// ==========================================
+static long long g_Sum = 0;
+static int g_Multiplier = 3;
+
+void Accumulate(int value)
+{
+    g_Sum += static_cast<long long>(value) * g_Multiplier;
+}
+
+// һ 40 ֽڵ״ֵ̬հ libstdc++ std::function  16 ֽСstd::function ʱ new
+struct BigState
+{
+    long long sum = 0;
+    long long multiplier = 3;
+    long long padding[3] = {};
+};
+
+int main(int argc, char **argv)
+{
+    size_t count = argc > 1 ? strtoull(argv[1], nullptr, 10) : 100000000ull;
+
+    cout << "=== 1. Usage ===" << endl;
+    int multiplier = 100;
+    InplaceFunction<void(int)> printer = [multiplier](int val)
+    {
+        cout << "  Captured Multiply: " << val * multiplier << endl;
+    };
+    InplaceFunction<void(int)> copy = printer; // ͬڴ
+    copy(7);
+
+    auto lambda = [](int val) { cout << "  FunctionRef -> Lambda: " << val << endl; };
+    FunctionRef<void(int)> ref = lambda;
+    ref(8);
+
+    // void ǩ԰зֵĿɵö󣬷ֵ ( std::function һ)
+    int calls = 0;
+    auto twice = [&calls](int val)
+    {
+        calls++;
+        return val * 2;
+    };
+    InplaceFunction<void(int)> discard = twice;
+    FunctionRef<void(int)> discardRef = twice;
+    discard(1);
+    discardRef(2);
+    cout << "  void(int) <- int(int): " << calls << " calls" << (calls == 2 ? " (ok)" : " (DIFFER)") << endl;
+
+    cout << "\n=== 2. Benchmark (" << count << " elements) ===" << endl;
+    vector<int> values(count);
+    for (size_t i = 0; i < count; i++)
+        values[i] = static_cast<int>(i & 1023);
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        {
+            g_Sum = 0;
+            Timer timer("Function Pointer", count);
+            ForEach(values, &Accumulate);
+            timer.Stop();
+            DoNotOptimize(g_Sum);
+        }
+        {
+            BigState state;
+            Timer timer("std::function", count);
+            ForEachModern(values, [local = state, &sum = state.sum](int v)
+                          { sum += v * local.multiplier; });
+            timer.Stop();
+            DoNotOptimize(state.sum);
+        }
+        {
+            BigState state;
+            Timer timer("InplaceFunction", count);
+            ForEachInplace(values, [local = state, &sum = state.sum](int v)
+                           { sum += v * local.multiplier; });
+            timer.Stop();
+            DoNotOptimize(state.sum);
+        }
+        {
+            BigState state;
+            Timer timer("FunctionRef", count);
+            auto body = [&state](int v) { state.sum += v * state.multiplier; };
+            ForEachRef(values, body);
+            timer.Stop();
+            DoNotOptimize(state.sum);
+        }
+        {
+            BigState state;
+            Timer timer("Template ForEach", count);
+            ForEach(values, [&state](int v) { state.sum += v * state.multiplier; });
+            timer.Stop();
+            DoNotOptimize(state.sum);
+        }
+        cout << "--------------------------------" << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,242 @@
+/**
+ * @file ParallelAlgorithms.h
+ * @brief par:: 㷨for_each / transform / reduce / find_if (ǰȡ) / count_if / inclusive_scan
+ * @note Ҫ C++20 ( 17_thread/ThreadPool.h) -pthreadڲѭǼ򵥵ָ/±ѭ-O3 ¿ɱԶ
+ *
+ * lambda.md  AlgorithmDemo  Lambda  std::find_if / std::for_eachЩ㷨ǵ̵߳ġ
+ * par:: 汾÷ std:: ͬ (ͬ Lambda)ڲгɹ̶СĿ飬ִ̳߳У
+ *   - Ԫ serialThreshold ʱֱӵöӦ std:: 㷨 (̵߳ȵĿȼ㱾)
+ *   - С̶ (߳޹)ͬһκ߳½ͬ
+ *   - find_if ҵƥ鷢Լƥλ֮󣬻 (ǰȡ)
+ *
+ *  std:: ĽԱȣ
+ *   - for_each / transform / find_if / count_if  std:: ȫһ
+ *   - reduce / inclusive_scan Ҫ op ɣ std:: ȫһ£
+ *     Ϊӷ˳ͬ std::accumulate  ( std::reduce ͬ)
+ *  std::execution::par һLambda ᱻ߳ͬʱãҪ޸İòĹ
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../17_thread/ThreadPool.h"
+
+namespace par
+{
+    struct Options
+    {
+        ThreadPool *pool = nullptr;          // nullptr ʾ DefaultPool()
+        std::size_t serialThreshold = 32768; // ôԪʱִ
+        std::size_t grain = 65536;           // ÿԪظ
+    };
+
+    // Ĭ̳߳أһʹʱ߳ = Ӳ߳
+    inline ThreadPool &DefaultPool()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    namespace detail
+    {
+        inline ThreadPool &PoolOf(const Options &opt) { return opt.pool ? *opt.pool : DefaultPool(); }
+
+        inline bool RunSerial(std::size_t n, const Options &opt)
+        {
+            return n < opt.serialThreshold || PoolOf(opt).size() <= 1;
+        }
+
+        inline std::size_t ChunkCount(std::size_t n, const Options &opt)
+        {
+            std::size_t grain = std::max<std::size_t>(1, opt.grain);
+            return (n + grain - 1) / grain;
+        }
+
+        // ÿһ body(chunkBegin, chunkEnd, chunkIndex)
+        template <typename Body>
+        void ForEachChunk(std::size_t n, const Options &opt, Body &&body)
+        {
+            const std::size_t grain = std::max<std::size_t>(1, opt.grain);
+            PoolOf(opt).parallel_for(
+                0, ChunkCount(n, opt), [&](std::size_t c)
+                { body(c * grain, std::min(n, (c + 1) * grain), c); },
+                1);
+        }
+
+        // ڹԼӷΪʱ 4 ۼѭˮ/
+        template <typename It, typename T, typename Op>
+        T ReduceRange(It first, std::size_t b, std::size_t e, T init, Op op)
+        {
+            using V = typename std::iterator_traits<It>::value_type;
+            if constexpr (std::is_arithmetic_v<T> && std::is_arithmetic_v<V> &&
+                          (std::is_same_v<Op, std::plus<>> || std::is_same_v<Op, std::plus<T>>))
+            {
+                T acc[4] = {T{}, T{}, T{}, T{}};
+                std::size_t i = b;
+                for (; i + 4 <= e; i += 4)
+                {
+                    acc[0] += first[i];
+                    acc[1] += first[i + 1];
+                    acc[2] += first[i + 2];
+                    acc[3] += first[i + 3];
+                }
+                for (; i < e; i++)
+                    acc[0] += first[i];
+                return init + ((acc[0] + acc[1]) + (acc[2] + acc[3]));
+            }
+            else
+            {
+                for (std::size_t i = b; i < e; i++)
+                    init = op(std::move(init), first[i]);
+                return init;
+            }
+        }
+    } // namespace detail
+
+    // ==========================================
+    // 1. for_each / transform
+    // ==========================================
+    template <typename It, typename F>
+    void for_each(It first, It last, F f, const Options &opt = {})
+    {
+        const std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+        if (detail::RunSerial(n, opt))
+        {
+            std::for_each(first, last, f);
+            return;
+        }
+        detail::ForEachChunk(n, opt, [&](std::size_t b, std::size_t e, std::size_t)
+                             {
+            for (std::size_t i = b; i < e; i++)
+                f(first[i]); });
+    }
+
+    template <typename It, typename Out, typename F>
+    Out transform(It first, It last, Out out, F f, const Options &opt = {})
+    {
+        const std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+        if (detail::RunSerial(n, opt))
+            return std::transform(first, last, out, f);
+        detail::ForEachChunk(n, opt, [&](std::size_t b, std::size_t e, std::size_t)
+                             {
+            for (std::size_t i = b; i < e; i++)
+                out[i] = f(first[i]); });
+        return out + static_cast<std::ptrdiff_t>(n);
+    }
+
+    // ==========================================
+    // 2. reduce / count_if
+    // ==========================================
+    // op ɣĲֽ˳ϲ (߳޹)
+    template <typename It, typename T, typename Op = std::plus<>>
+    T reduce(It first, It last, T init, Op op = {}, const Options &opt = {})
+    {
+        const std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+        if (detail::RunSerial(n, opt))
+            return detail::ReduceRange(first, 0, n, std::move(init), op);
+
+        std::vector<T> partial(detail::ChunkCount(n, opt));
+        detail::ForEachChunk(n, opt, [&](std::size_t b, std::size_t e, std::size_t c)
+                             { partial[c] = detail::ReduceRange(first, b + 1, e, T(first[b]), op); });
+        for (T &value : partial)
+            init = op(std::move(init), std::move(value));
+        return init;
+    }
+
+    template <typename It, typename Pred>
+    typename std::iterator_traits<It>::difference_type count_if(It first, It last, Pred pred, const Options &opt = {})
+    {
+        using Diff = typename std::iterator_traits<It>::difference_type;
+        const std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+        auto countRange = [&](std::size_t b, std::size_t e)
+        {
+            Diff count = 0;
+            for (std::size_t i = b; i < e; i++)
+                count += pred(first[i]) ? 1 : 0; // ޷֧ۼӣ
+            return count;
+        };
+        if (detail::RunSerial(n, opt))
+            return countRange(0, n);
+
+        std::vector<Diff> partial(detail::ChunkCount(n, opt));
+        detail::ForEachChunk(n, opt, [&](std::size_t b, std::size_t e, std::size_t c)
+                             { partial[c] = countRange(b, e); });
+        return std::accumulate(partial.begin(), partial.end(), Diff{0});
+    }
+
+    // ==========================================
+    // 3. find_ifصһƥ ( std::find_if ͬ)ҵǰ˳
+    // ==========================================
+    template <typename It, typename Pred>
+    It find_if(It first, It last, Pred pred, const Options &opt = {})
+    {
+        const std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+        if (detail::RunSerial(n, opt))
+            return std::find_if(first, last, pred);
+
+        constexpr std::size_t kCheckEvery = 4096; // ÿɨôԪؼһǷиǰƥ
+        std::atomic<std::size_t> found{n};
+        detail::ForEachChunk(n, opt, [&](std::size_t b, std::size_t e, std::size_t)
+                             {
+            for (std::size_t blockBegin = b; blockBegin < e; blockBegin += kCheckEvery)
+            {
+                if (blockBegin >= found.load(std::memory_order_relaxed))
+                    return; // Ѿиǰƥ䣺ʣಿ
+                std::size_t blockEnd = std::min(e, blockBegin + kCheckEvery);
+                It hit = std::find_if(first + blockBegin, first + blockEnd, pred);
+                if (hit != first + blockEnd)
+                {
+                    std::size_t index = static_cast<std::size_t>(hit - first);
+                    std::size_t current = found.load(std::memory_order_relaxed);
+                    while (index < current && !found.compare_exchange_weak(current, index, std::memory_order_relaxed))
+                    {
+                    }
+                    return;
+                }
+            } });
+        return first + static_cast<std::ptrdiff_t>(found.load());
+    }
+
+    // ==========================================
+    // 4. inclusive_scan˲ ( -> ǰ׺ -> ڴλɨ)
+    // ==========================================
+    template <typename It, typename Out, typename Op = std::plus<>>
+    Out inclusive_scan(It first, It last, Out out, Op op = {}, const Options &opt = {})
+    {
+        using T = typename std::iterator_traits<It>::value_type;
+        const std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+        if (detail::RunSerial(n, opt))
+            return std::inclusive_scan(first, last, out, op);
+
+        //  1 ˣÿܺ
+        std::vector<T> chunkSum(detail::ChunkCount(n, opt));
+        detail::ForEachChunk(n, opt, [&](std::size_t b, std::size_t e, std::size_t c)
+                             { chunkSum[c] = detail::ReduceRange(first, b + 1, e, T(first[b]), op); });
+
+        // Ľλ (ǰп֮)٣м
+        std::vector<T> carry(chunkSum.size());
+        for (std::size_t c = 1; c < chunkSum.size(); c++)
+            carry[c] = c == 1 ? chunkSum[0] : op(carry[c - 1], chunkSum[c - 1]);
+
+        //  2 ˣɨ裬ӽλʼ
+        detail::ForEachChunk(n, opt, [&](std::size_t b, std::size_t e, std::size_t c)
+                             {
+            T running = c == 0 ? T(first[b]) : op(carry[c], first[b]);
+            out[b] = running;
+            for (std::size_t i = b + 1; i < e; i++)
+            {
+                running = op(std::move(running), first[i]);
+                out[i] = running;
+            } });
+        return out + static_cast<std::ptrdiff_t>(n);
+    }
+} // namespace par
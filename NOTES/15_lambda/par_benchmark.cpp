@@ -0,0 +1,156 @@
+/**
+ * @file par_benchmark.cpp
+ * @brief lambda.md  AlgorithmDemo  par:: 汾Ա std::  par:: ڲͬͬ߳µĺʱٱ
+ * @note : g++ -O3 -std=c++20 -pthread par_benchmark.cpp -o par_benchmark
+ *       : ./par_benchmark [ԪظĬ 10000000]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "ParallelAlgorithms.h"
+
+// ==========================================
+// 1. AlgorithmDemo  par:: 汾
+// ==========================================
+void AlgorithmDemo()
+{
+    std::cout << "=== 1. AlgorithmDemo with par:: ===" << std::endl;
+    std::vector<int> numbers = {1, 5, 8, 9, 12, 4, 7};
+    int threshold = 6;
+
+    // ÷ std::find_if ͬԪغʱԶ
+    auto it = par::find_if(numbers.begin(), numbers.end(), [threshold](int val) { return val > threshold; });
+    if (it != numbers.end())
+        std::cout << "  First number > " << threshold << " is: " << *it << std::endl;
+
+    // for_each  Lambda ᱻ߳ͬʱãﲻֱ coutԭ޸Ԫ
+    par::for_each(numbers.begin(), numbers.end(), [](int &val) { val *= 2; });
+    std::cout << "  Doubled:";
+    for (int v : numbers)
+        std::cout << " " << v;
+    std::cout << std::endl;
+}
+
+// ==========================================
+// 2. ʱߣȡ 3 һ (΢)
+// ==========================================
+template <typename F>
+double BestOf3(F &&f)
+{
+    double best = 1e300;
+    for (int r = 0; r < 3; r++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        best = std::min(best, std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+bool g_AllMatch = true;
+
+void Report(const char *op, std::size_t n, unsigned threads, double stdUs, double parUs, bool match)
+{
+    g_AllMatch = g_AllMatch && match;
+    std::cout << "  " << std::left << std::setw(15) << op << std::right << std::setw(10) << n << std::setw(4) << threads
+              << std::fixed << std::setprecision(1) << std::setw(12) << stdUs << std::setw(12) << parUs
+              << std::setprecision(2) << std::setw(9) << stdUs / parUs << "x" << (match ? "" : "  MISMATCH")
+              << std::defaultfloat << std::setprecision(6) << std::endl;
+}
+
+// ==========================================
+// 3. 㷨 std:: vs par::
+// ==========================================
+void RunAll(const std::vector<std::int32_t> &data, std::size_t n, ThreadPool &pool)
+{
+    par::Options opt;
+    opt.pool = &pool;
+    const unsigned threads = static_cast<unsigned>(pool.size());
+    auto first = data.begin(), last = data.begin() + static_cast<std::ptrdiff_t>(n);
+
+    std::vector<std::int32_t> a(first, last), b(first, last);
+    // з UB uint32_t ת (C++20 תȷ)
+    auto bump = [](std::int32_t &x) { x = static_cast<std::int32_t>(static_cast<std::uint32_t>(x) * 3u + 1u); };
+    double s = BestOf3([&] { std::for_each(a.begin(), a.end(), bump); });
+    double p = BestOf3([&] { par::for_each(b.begin(), b.end(), bump, opt); });
+    Report("for_each", n, threads, s, p, a == b);
+
+    std::vector<double> outStd(n), outPar(n);
+    auto heavy = [](std::int32_t x) { return std::sqrt(static_cast<double>(x & 0xFFFF)) * 1.5 + 2.0; };
+    s = BestOf3([&] { std::transform(first, last, outStd.begin(), heavy); });
+    p = BestOf3([&] { par::transform(first, last, outPar.begin(), heavy, opt); });
+    Report("transform", n, threads, s, p, outStd == outPar);
+
+    long long sumStd = 0, sumPar = 0;
+    s = BestOf3([&] { sumStd = std::accumulate(first, last, 0LL); });
+    p = BestOf3([&] { sumPar = par::reduce(first, last, 0LL, std::plus<>{}, opt); });
+    Report("reduce", n, threads, s, p, sumStd == sumPar);
+
+    auto isNegativeOdd = [](std::int32_t x) { return x < 0 && (x & 1); };
+    std::ptrdiff_t cntStd = 0, cntPar = 0;
+    s = BestOf3([&] { cntStd = std::count_if(first, last, isNegativeOdd); });
+    p = BestOf3([&] { cntPar = par::count_if(first, last, isNegativeOdd, opt); });
+    Report("count_if", n, threads, s, p, cntStd == cntPar);
+
+    // Ŀ 3/4 ǰ 3/4 ĿҲ֮Ŀҵȡ
+    std::vector<std::int32_t> haystack(first, last);
+    std::replace(haystack.begin(), haystack.end(), std::int32_t{123456789}, std::int32_t{0});
+    haystack[n * 3 / 4] = 123456789;
+    auto isTarget = [](std::int32_t x) { return x == 123456789; };
+    std::vector<std::int32_t>::iterator hitStd, hitPar;
+    s = BestOf3([&] { hitStd = std::find_if(haystack.begin(), haystack.end(), isTarget); });
+    p = BestOf3([&] { hitPar = par::find_if(haystack.begin(), haystack.end(), isTarget, opt); });
+    Report("find_if (3/4)", n, threads, s, p, hitStd == hitPar);
+
+    std::vector<long long> wide(first, last), scanStd(n), scanPar(n);
+    s = BestOf3([&] { std::inclusive_scan(wide.begin(), wide.end(), scanStd.begin()); });
+    p = BestOf3([&] { par::inclusive_scan(wide.begin(), wide.end(), scanPar.begin(), std::plus<>{}, opt); });
+    Report("inclusive_scan", n, threads, s, p, scanStd == scanPar);
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t maxN = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+
+    AlgorithmDemo();
+
+    std::vector<std::int32_t> data(maxN);
+    std::mt19937 rng(2024);
+    for (std::int32_t &x : data)
+        x = static_cast<std::int32_t>(rng());
+
+    //  reduceӷ˳ͬ std::accumulate ֻ
+    {
+        std::vector<double> values(data.size());
+        std::transform(data.begin(), data.end(), values.begin(), [](std::int32_t x) { return x * 1e-3; });
+        ThreadPool pool(4);
+        par::Options opt;
+        opt.pool = &pool;
+        double serial = std::accumulate(values.begin(), values.end(), 0.0);
+        double parallel = par::reduce(values.begin(), values.end(), 0.0, std::plus<>{}, opt);
+        std::cout << "  double reduce: relative difference vs std::accumulate = "
+                  << std::abs(parallel - serial) / std::abs(serial) << std::endl;
+    }
+
+    std::cout << "\n=== 2. std:: vs par:: (best of 3, us; hardware threads " << std::thread::hardware_concurrency()
+              << ", Run in Release Mode! -O3) ===" << std::endl;
+    std::cout << "  algorithm               n thr       std::       par::  speedup" << std::endl;
+    for (unsigned threads : {1u, 2u, 4u, 8u})
+    {
+        ThreadPool pool(threads);
+        for (std::size_t n = 1000; n <= maxN; n *= 10)
+            RunAll(data, n, pool);
+    }
+    std::cout << "\nAll results identical to std:: : " << std::boolalpha << g_AllMatch << std::endl;
+    return 0;
+}
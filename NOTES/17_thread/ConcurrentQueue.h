@@ -0,0 +1,350 @@
+/**
+ * @file ConcurrentQueue.h
+ * @brief ̼߳䴫/УMpmcQueue (Vyukov н߶)SpscChannel (ߵ߻λ)
+ *        Լߵ汾 Blocking<Queue>
+ * @note Ҫ C++20 (std::atomic::wait / notify)Linux ± -pthread
+ *
+ * ѡָϣ
+ *   - ֻһ߳дһ̶߳ ( UI ߳ -> ߳)SpscChannelÿβû CAS
+ *   -  / ߣMpmcQueueÿλһţ֮䡢ֻ֮һ CAS
+ *   - Ҫ"ûݾ˯"Blocking<...>ʮΣȻò futex ϵȴ
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace concurrent
+{
+    // дСдԭӱڲͬУα (False Sharing)
+    inline constexpr std::size_t kCacheLine = 64;
+
+    inline std::size_t RoundUpPow2(std::size_t n)
+    {
+        std::size_t cap = 2;
+        while (cap < n)
+            cap <<= 1;
+        return cap;
+    }
+
+    // ==========================================
+    // 1. MpmcQueue<T>Dmitry Vyukov н MPMC 
+    // ==========================================
+    // ÿλһ sequence
+    //   sequence == pos       -> λУд pos Ԫ
+    //   sequence == pos + 1   -> λд룬Զ pos Ԫ
+    // /߸ֻ m_EnqueuePos / m_DequeuePos  CAS һΣȻռòλ
+    template <typename T>
+    class MpmcQueue
+    {
+    public:
+        using value_type = T;
+
+    private:
+        struct alignas(kCacheLine) Slot
+        {
+            std::atomic<std::size_t> sequence;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            T *Get() { return std::launder(reinterpret_cast<T *>(storage)); }
+        };
+
+        std::size_t m_Mask;
+        std::unique_ptr<Slot[]> m_Slots;
+        alignas(kCacheLine) std::atomic<std::size_t> m_EnqueuePos{0};
+        alignas(kCacheLine) std::atomic<std::size_t> m_DequeuePos{0};
+
+    public:
+        // capacity ȡ 2 
+        explicit MpmcQueue(std::size_t capacity) : m_Mask(RoundUpPow2(capacity) - 1), m_Slots(new Slot[m_Mask + 1])
+        {
+            for (std::size_t i = 0; i <= m_Mask; i++)
+                m_Slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        // ʱӦ̷߳ʣδȡԪ
+        ~MpmcQueue()
+        {
+            std::size_t end = m_EnqueuePos.load(std::memory_order_relaxed);
+            for (std::size_t pos = m_DequeuePos.load(std::memory_order_relaxed); pos != end; pos++)
+                m_Slots[pos & m_Mask].Get()->~T();
+        }
+
+        MpmcQueue(const MpmcQueue &) = delete;
+        MpmcQueue &operator=(const MpmcQueue &) = delete;
+
+        std::size_t capacity() const { return m_Mask + 1; }
+
+        // ʱ falsevalue ᱻ
+        template <typename U>
+        bool TryPush(U &&value)
+        {
+            std::size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+            Slot *slot;
+            while (true)
+            {
+                slot = &m_Slots[pos & m_Mask];
+                std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+                if (diff == 0)
+                {
+                    if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                {
+                    return false; // λһֵԪػûߣ
+                }
+                else
+                {
+                    pos = m_EnqueuePos.load(std::memory_order_relaxed); // 
+                }
+            }
+            ::new (static_cast<void *>(slot->storage)) T(std::forward<U>(value));
+            slot->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // пʱ false
+        bool TryPop(T &out)
+        {
+            std::size_t pos = m_DequeuePos.load(std::memory_order_relaxed);
+            Slot *slot;
+            while (true)
+            {
+                slot = &m_Slots[pos & m_Mask];
+                std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+                if (diff == 0)
+                {
+                    if (m_DequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                {
+                    return false; // ûд룺п
+                }
+                else
+                {
+                    pos = m_DequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+            T *item = slot->Get();
+            out = std::move(*item);
+            item->~T();
+            slot->sequence.store(pos + m_Mask + 1, std::memory_order_release); // һֵ
+            return true;
+        }
+    };
+
+    // ==========================================
+    // 2. SpscChannel<T>ߵ߻λ
+    // ==========================================
+    // head ֻдtail ֻд˫ԻһݶԷ
+    // ֻ"/"ʱȥԷĻУ̬ļ
+    template <typename T>
+    class SpscChannel
+    {
+    public:
+        using value_type = T;
+
+    private:
+        struct Cell
+        {
+            alignas(T) unsigned char storage[sizeof(T)];
+            T *Get() { return std::launder(reinterpret_cast<T *>(storage)); }
+        };
+
+        std::size_t m_Mask;
+        std::unique_ptr<Cell[]> m_Cells;
+
+        alignas(kCacheLine) std::atomic<std::size_t> m_Head{0}; // 
+        std::size_t m_CachedTail = 0;                           // е tail
+        alignas(kCacheLine) std::atomic<std::size_t> m_Tail{0}; // 
+        std::size_t m_CachedHead = 0;                           // е head
+
+    public:
+        explicit SpscChannel(std::size_t capacity) : m_Mask(RoundUpPow2(capacity) - 1), m_Cells(new Cell[m_Mask + 1]) {}
+
+        ~SpscChannel()
+        {
+            std::size_t tail = m_Tail.load(std::memory_order_relaxed);
+            for (std::size_t i = m_Head.load(std::memory_order_relaxed); i != tail; i++)
+                m_Cells[i & m_Mask].Get()->~T();
+        }
+
+        SpscChannel(const SpscChannel &) = delete;
+        SpscChannel &operator=(const SpscChannel &) = delete;
+
+        std::size_t capacity() const { return m_Mask + 1; }
+
+        // ̵ֻ߳
+        template <typename U>
+        bool TryPush(U &&value)
+        {
+            std::size_t tail = m_Tail.load(std::memory_order_relaxed);
+            if (tail - m_CachedHead > m_Mask)
+            {
+                m_CachedHead = m_Head.load(std::memory_order_acquire);
+                if (tail - m_CachedHead > m_Mask)
+                    return false;
+            }
+            ::new (static_cast<void *>(m_Cells[tail & m_Mask].storage)) T(std::forward<U>(value));
+            m_Tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        // ̵ֻ߳
+        bool TryPop(T &out)
+        {
+            std::size_t head = m_Head.load(std::memory_order_relaxed);
+            if (head == m_CachedTail)
+            {
+                m_CachedTail = m_Tail.load(std::memory_order_acquire);
+                if (head == m_CachedTail)
+                    return false;
+            }
+            T *item = m_Cells[head & m_Mask].Get();
+            out = std::move(*item);
+            item->~T();
+            m_Head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+    };
+
+    // ==========================================
+    // 3. Blocking<Queue> futex ϵȴ
+    // ==========================================
+    // κṩ TryPush / TryPop Ķһ㣺
+    //   - ʱвղTryPush/TryPop һγɹ汾һ
+    //   - ʧ kSpinCount κ߳ epoch  wait (Linux  futex)ռ CPU
+    //   - Close() ֮ Push ʧܣPop ʣԪȡ󷵻 false֪ͨ˳
+    template <typename Queue>
+    class Blocking
+    {
+    public:
+        using value_type = typename Queue::value_type;
+
+    private:
+        static constexpr int kSpinCount = 64;
+
+        Queue m_Queue;
+        alignas(kCacheLine) std::atomic<std::uint32_t> m_ItemEpoch{0};  // ÿ push  +1ѵݵ
+        std::atomic<std::uint32_t> m_ItemWaiters{0};
+        alignas(kCacheLine) std::atomic<std::uint32_t> m_SpaceEpoch{0}; // ÿ pop  +1ѵȿλ
+        std::atomic<std::uint32_t> m_SpaceWaiters{0};
+        std::atomic<bool> m_Closed{false};
+
+        // ֻ֪ͨȷʵڵʱ epoch () ϵͳã˵ȴʱֻһդ
+        //  SpinThenWait " waiters + 1" (Dekker ʽ)Ҫô֪ͨȴߣҪôȴʱ״̬
+        static void Signal(std::atomic<std::uint32_t> &epoch, std::atomic<std::uint32_t> &waiters, bool all = false)
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiters.load(std::memory_order_relaxed) == 0)
+                return;
+            epoch.fetch_add(1, std::memory_order_seq_cst);
+            if (all)
+                epoch.notify_all(); // Close ʱȫ
+            else
+                epoch.notify_one(); // ÿ/ȡһԪֻ軽һȴ
+        }
+
+        // ظ attempt() ֱɹ stop() Ϊ棺
+        template <typename Attempt, typename Stop>
+        static bool SpinThenWait(std::atomic<std::uint32_t> &epoch, std::atomic<std::uint32_t> &waiters,
+                                 Attempt &&attempt, Stop &&stop)
+        {
+            for (int i = 0; i < kSpinCount; i++)
+            {
+                if (attempt())
+                    return true;
+                if (i >= kSpinCount / 2)
+                    std::this_thread::yield();
+            }
+            while (true)
+            {
+                std::uint32_t seen = epoch.load(std::memory_order_seq_cst);
+                waiters.fetch_add(1, std::memory_order_seq_cst);
+                bool done = attempt();
+                if (done || stop())
+                {
+                    waiters.fetch_sub(1, std::memory_order_relaxed);
+                    return done;
+                }
+                epoch.wait(seen, std::memory_order_seq_cst);
+                waiters.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+    public:
+        explicit Blocking(std::size_t capacity) : m_Queue(capacity) {}
+
+        // ֱ룻ѹرʱ false
+        template <typename U>
+        bool Push(U &&value)
+        {
+            bool pushed = SpinThenWait(
+                m_SpaceEpoch, m_SpaceWaiters,
+                [&] { return !m_Closed.load(std::memory_order_relaxed) && m_Queue.TryPush(std::forward<U>(value)); },
+                [&] { return m_Closed.load(std::memory_order_acquire); });
+            if (pushed)
+                Signal(m_ItemEpoch, m_ItemWaiters);
+            return pushed;
+        }
+
+        // ֱȡԪأѹرΪʱ false
+        bool Pop(value_type &out)
+        {
+            bool popped = SpinThenWait(
+                m_ItemEpoch, m_ItemWaiters, [&] { return m_Queue.TryPop(out); },
+                [&] { return m_Closed.load(std::memory_order_acquire); });
+            if (!popped)
+                popped = m_Queue.TryPop(out); // رǰһ̷Ԫ
+            if (popped)
+                Signal(m_SpaceEpoch, m_SpaceWaiters);
+            return popped;
+        }
+
+        template <typename U>
+        bool TryPush(U &&value)
+        {
+            if (m_Closed.load(std::memory_order_relaxed) || !m_Queue.TryPush(std::forward<U>(value)))
+                return false;
+            Signal(m_ItemEpoch, m_ItemWaiters);
+            return true;
+        }
+
+        bool TryPop(value_type &out)
+        {
+            if (!m_Queue.TryPop(out))
+                return false;
+            Signal(m_SpaceEpoch, m_SpaceWaiters);
+            return true;
+        }
+
+        // еȴߣ߲ܷ룬ȡʣԪغ˳
+        // Ӧ߶ Push ֮ٵã Close ɵǴ Push ȡ
+        void Close()
+        {
+            m_Closed.store(true, std::memory_order_release);
+            Signal(m_ItemEpoch, m_ItemWaiters, true);
+            Signal(m_SpaceEpoch, m_SpaceWaiters, true);
+        }
+
+        bool IsClosed() const { return m_Closed.load(std::memory_order_acquire); }
+        std::size_t capacity() const { return m_Queue.capacity(); }
+    };
+
+    template <typename T>
+    using BlockingMpmcQueue = Blocking<MpmcQueue<T>>;
+
+    template <typename T>
+    using BlockingSpscChannel = Blocking<SpscChannel<T>>;
+} // namespace concurrent
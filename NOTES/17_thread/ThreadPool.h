@@ -0,0 +1,342 @@
+/**
+ * @file ThreadPool.h
+ * @brief ȡ̳߳أÿ߳һ Chase-Lev ˫˶У߳ futex 
+ * @note Ҫ C++20 (std::jthread / std::stop_token / std::atomic::wait)Linux ± -pthread
+ *
+ *  thread.md "һһ std::thread + bool ־ + sleep_for ѯ"ȣ
+ *   1. ֻ߳һΣͨ submit() Ͷݣ std::future ȡ
+ *   2. ֹͣź std::stop_token bool& ݾ߳ std::atomic::wait 
+ *      (Linux Ͼ futex)ʱѣ 1 
+ *   3. ߳ԼѹԼĶ (LIFO)̴߳ӱ˵Ķжȡ
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "WorkStealingDeque.h"
+
+class ThreadPool
+{
+private:
+    // ==========================================
+    // 1. Ͳ
+    // ==========================================
+    struct TaskBase
+    {
+        virtual ~TaskBase() = default;
+        virtual void Run() = 0;
+    };
+
+    template <typename F>
+    struct Task final : TaskBase
+    {
+        F func;
+        explicit Task(F &&f) : func(std::move(f)) {}
+        void Run() override { func(); }
+    };
+
+    struct Worker
+    {
+        WorkStealingDeque<TaskBase *> deque;
+        std::jthread thread;
+    };
+
+    std::vector<std::unique_ptr<Worker>> m_Workers;
+
+    // ⲿ߳ (Ǳع߳) ύȽע
+    std::mutex m_InjectMutex;
+    std::deque<TaskBase *> m_Injected;
+    std::atomic<std::size_t> m_InjectedCount{0};
+
+    // /ѣ߳ m_Epoch  waitÿͶʱ m_Epoch + 1
+    alignas(64) std::atomic<std::uint32_t> m_Epoch{0};
+    alignas(64) std::atomic<std::uint32_t> m_Sleepers{0};
+
+    std::stop_source m_Stop;
+
+    // ǰ߳ĸءǵڼŹ߳
+    static inline thread_local ThreadPool *t_Pool = nullptr;
+    static inline thread_local std::size_t t_Index = 0;
+
+public:
+    explicit ThreadPool(unsigned threadCount = std::thread::hardware_concurrency())
+    {
+        threadCount = std::max(1u, threadCount);
+        m_Workers.reserve(threadCount);
+        for (unsigned i = 0; i < threadCount; i++)
+            m_Workers.push_back(std::make_unique<Worker>());
+        // жж̣֮߳ȡʱʵδ Worker
+        for (unsigned i = 0; i < threadCount; i++)
+            m_Workers[i]->thread = std::jthread([this, i] { WorkerLoop(i); });
+    }
+
+    // ֹ̰ͣ߳ѾŶӵִ˳
+    // (submit() һִУsubmit_cancellable() ԼƱֹͣʱŻᱻ)
+    ~ThreadPool()
+    {
+        request_stop();
+        for (auto &worker : m_Workers)
+            worker->thread.join();
+        // ߳˳֮ŴⲿͶݽ񲻻ٱִУͷǣӦ future õ broken_promise
+        for (TaskBase *task : m_Injected)
+            delete task;
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    std::size_t size() const { return m_Workers.size(); }
+
+    // Эʽȡͨ stop_token ֪ڹر
+    std::stop_token get_stop_token() const { return m_Stop.get_token(); }
+
+    void request_stop()
+    {
+        m_Stop.request_stop();
+        m_Epoch.fetch_add(1, std::memory_order_seq_cst);
+        m_Epoch.notify_all();
+    }
+
+    // ==========================================
+    // 2. submitͶ񣬷 std::future
+    // ==========================================
+    // һᱻִ (ʱŶӵ)
+    //  f ĵһ std::stop_tokenػԼֹͣƴȥԽǰβ
+    template <typename F, typename... Args>
+    auto submit(F &&f, Args &&...args)
+    {
+        return Submit<false>(m_Stop.get_token(), std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    // ʹõṩ stop_tokenʼִǰֱֹͣӶ
+    // Ӧ future.get() ׳ std::future_error (broken_promise)
+    template <typename F, typename... Args>
+    auto submit_cancellable(std::stop_token token, F &&f, Args &&...args)
+    {
+        return Submit<true>(std::move(token), std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    // ִһŶе ()ȴɵ߳Ӧ"æ"ǿת
+    bool try_run_one()
+    {
+        TaskBase *task = nullptr;
+        std::size_t self = (t_Pool == this) ? t_Index : m_Workers.size();
+        if (!FindTask(self, task))
+            return false;
+        task->Run();
+        delete task;
+        return true;
+    }
+
+    // ==========================================
+    // 3. parallel_for / parallel_reduce
+    // ==========================================
+    //  [begin, end) гɿ鲢ִ body(i)߳ҲִУڲǶ׵Ҳ
+    // grain ΪÿԪظ0 ʾԶ (ԼΪ ߳ x 8 )
+    template <typename Body>
+    void parallel_for(std::size_t begin, std::size_t end, Body &&body, std::size_t grain = 0)
+    {
+        ParallelChunks(begin, end, grain, [&](std::size_t b, std::size_t e, std::size_t)
+                       {
+            for (std::size_t i = b; i < e; i++)
+                body(i); });
+    }
+
+    // ÿ mapRange(b, e) õһֽٰ˳ combine ϲ (ȷԵ)
+    template <typename T, typename MapRange, typename Combine>
+    T parallel_reduce(std::size_t begin, std::size_t end, T identity, MapRange &&mapRange, Combine &&combine,
+                      std::size_t grain = 0)
+    {
+        if (begin >= end)
+            return identity;
+        grain = ResolveGrain(end - begin, grain);
+        std::size_t chunks = (end - begin + grain - 1) / grain;
+        std::vector<T> partial(chunks, identity);
+        ParallelChunks(begin, end, grain, [&](std::size_t b, std::size_t e, std::size_t chunk)
+                       { partial[chunk] = mapRange(b, e); });
+        T result = identity;
+        for (T &value : partial)
+            result = combine(std::move(result), std::move(value));
+        return result;
+    }
+
+private:
+    template <bool kDropIfStopped, typename F, typename... Args>
+    auto Submit(std::stop_token token, F &&f, Args &&...args)
+    {
+        using R = decltype(InvokeWithToken(token, f, args...));
+        std::packaged_task<R()> job(
+            [token, f = std::forward<F>(f), ... args = std::forward<Args>(args)]() mutable -> R
+            { return InvokeWithToken(token, f, args...); });
+        std::future<R> result = job.get_future();
+
+        auto wrapper = [token, job = std::move(job)]() mutable
+        {
+            if (!kDropIfStopped || !token.stop_requested())
+                job();
+            // δִе packaged_task ʱ future  broken_promise
+        };
+        Enqueue(new Task<decltype(wrapper)>(std::move(wrapper)));
+        return result;
+    }
+
+    template <typename F, typename... Args>
+    static decltype(auto) InvokeWithToken(const std::stop_token &token, F &f, Args &...args)
+    {
+        if constexpr (std::is_invocable_v<F &, std::stop_token, Args &...>)
+            return std::invoke(f, token, args...);
+        else
+            return std::invoke(f, args...);
+    }
+
+    std::size_t ResolveGrain(std::size_t count, std::size_t grain) const
+    {
+        if (grain != 0)
+            return grain;
+        return std::max<std::size_t>(1, count / (m_Workers.size() * 8));
+    }
+
+    // chunkBody(b, e, chunkIndex) 0 ɵ߳Լִ
+    template <typename ChunkBody>
+    void ParallelChunks(std::size_t begin, std::size_t end, std::size_t grain, ChunkBody &&chunkBody)
+    {
+        if (begin >= end)
+            return;
+        grain = ResolveGrain(end - begin, grain);
+        std::size_t chunks = (end - begin + grain - 1) / grain;
+
+        std::atomic<std::size_t> remaining{chunks};
+        std::exception_ptr error;
+        std::mutex errorMutex;
+
+        auto runChunk = [&](std::size_t c)
+        {
+            std::size_t b = begin + c * grain;
+            std::size_t e = std::min(end, b + grain);
+            try
+            {
+                chunkBody(b, e, c);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+            remaining.fetch_sub(1, std::memory_order_release);
+        };
+
+        for (std::size_t c = 1; c < chunks; c++)
+        {
+            auto task = [&runChunk, c] { runChunk(c); };
+            Enqueue(new Task<decltype(task)>(std::move(task)));
+        }
+        runChunk(0);
+
+        // ȴڼæִ (ԼĿ飬ҲǱ˵)
+        while (remaining.load(std::memory_order_acquire) != 0)
+        {
+            if (!try_run_one())
+                std::this_thread::yield();
+        }
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    void Enqueue(TaskBase *task)
+    {
+        if (t_Pool == this)
+        {
+            m_Workers[t_Index]->deque.Push(task); // ̣߳ѹԼĶУ
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(m_InjectMutex);
+            m_Injected.push_back(task);
+            m_InjectedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        m_Epoch.fetch_add(1, std::memory_order_seq_cst);
+        if (m_Sleepers.load(std::memory_order_seq_cst) != 0)
+            m_Epoch.notify_one();
+    }
+
+    bool PopInjected(TaskBase *&task)
+    {
+        if (m_InjectedCount.load(std::memory_order_relaxed) == 0)
+            return false;
+        std::lock_guard<std::mutex> lock(m_InjectMutex);
+        if (m_Injected.empty())
+            return false;
+        task = m_Injected.front();
+        m_Injected.pop_front();
+        m_InjectedCount.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // ˳ԼĶ -> ע -> λÿʼȡ߳
+    bool FindTask(std::size_t self, TaskBase *&task)
+    {
+        if (self < m_Workers.size() && m_Workers[self]->deque.Pop(task))
+            return true;
+        if (PopInjected(task))
+            return true;
+
+        static thread_local std::uint32_t seed = static_cast<std::uint32_t>(
+            std::hash<std::thread::id>{}(std::this_thread::get_id()) | 1u);
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+
+        std::size_t n = m_Workers.size();
+        std::size_t start = seed % n;
+        for (std::size_t k = 0; k < n; k++)
+        {
+            std::size_t victim = (start + k) % n;
+            if (victim != self && m_Workers[victim]->deque.Steal(task))
+                return true;
+        }
+        return false;
+    }
+
+    void WorkerLoop(std::size_t index)
+    {
+        t_Pool = this;
+        t_Index = index;
+        std::stop_token stop = m_Stop.get_token();
+
+        while (true)
+        {
+            std::uint32_t epoch = m_Epoch.load(std::memory_order_seq_cst);
+
+            // ֣ͶݵϾõʡһ/ѵϵͳ
+            bool ranTask = false;
+            for (int spin = 0; spin < 64 && !ranTask; spin++)
+                ranTask = try_run_one();
+            if (ranTask)
+                continue;
+
+            if (stop.stop_requested())
+                break;
+
+            // ߣֻҪ epoch Ƕȡ֮ (ֹͣ)wait 
+            m_Sleepers.fetch_add(1, std::memory_order_seq_cst);
+            m_Epoch.wait(epoch, std::memory_order_seq_cst);
+            m_Sleepers.fetch_sub(1, std::memory_order_seq_cst);
+        }
+    }
+};
@@ -0,0 +1,137 @@
+/**
+ * @file WorkStealingDeque.h
+ * @brief Chase-Lev ȡ˫˶ (Work-Stealing Deque)
+ * @note Ҫ C++17㷨 L, Pop, Cohen, Zappa Nardelli,
+ *       "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013)
+ *
+ * ʹù
+ *   - ֻ"߳"Ե Push / Pop (ڵײ bottom ȳ)
+ *   - κ̶߳Ե Steal (Ӷ top ͵Ƚȳ͵ߵǸĹ)
+ * ʱ߻ѻһʱͷ (ȡ߿ܻڶ)
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+template <typename T>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque ֻſƽֵ (ָͨ)");
+
+private:
+    // 飺 2 ݣλȡģ
+    struct Ring
+    {
+        std::int64_t capacity;
+        std::int64_t mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+
+        explicit Ring(std::int64_t cap) : capacity(cap), mask(cap - 1), slots(new std::atomic<T>[cap]) {}
+
+        T Load(std::int64_t i) const { return slots[i & mask].load(std::memory_order_relaxed); }
+        void Store(std::int64_t i, T value) { slots[i & mask].store(value, std::memory_order_relaxed); }
+
+        Ring *Grow(std::int64_t bottom, std::int64_t top) const
+        {
+            Ring *bigger = new Ring(capacity * 2);
+            for (std::int64_t i = top; i < bottom; i++)
+                bigger->Store(i, Load(i));
+            return bigger;
+        }
+    };
+
+    // top ȡbottom ֻдֿڲͬУα (False Sharing)
+    alignas(64) std::atomic<std::int64_t> m_Top{0};
+    alignas(64) std::atomic<std::int64_t> m_Bottom{0};
+    alignas(64) std::atomic<Ring *> m_Ring;
+    std::vector<std::unique_ptr<Ring>> m_Retired; // ֻ߷
+
+public:
+    explicit WorkStealingDeque(std::size_t initialCapacity = 256)
+    {
+        std::int64_t cap = 1;
+        while (cap < static_cast<std::int64_t>(initialCapacity))
+            cap <<= 1;
+        m_Ring.store(new Ring(cap), std::memory_order_relaxed);
+    }
+
+    ~WorkStealingDeque() { delete m_Ring.load(std::memory_order_relaxed); }
+
+    WorkStealingDeque(const WorkStealingDeque &) = delete;
+    WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+
+    // ߣѹײ
+    void Push(T value)
+    {
+        std::int64_t b = m_Bottom.load(std::memory_order_relaxed);
+        std::int64_t t = m_Top.load(std::memory_order_acquire);
+        Ring *ring = m_Ring.load(std::memory_order_relaxed);
+        if (b - t > ring->capacity - 1)
+        {
+            Ring *bigger = ring->Grow(b, t);
+            m_Retired.emplace_back(ring);
+            m_Ring.store(bigger, std::memory_order_release);
+            ring = bigger;
+        }
+        ring->Store(b, value);
+        m_Bottom.store(b + 1, std::memory_order_release); // ȡ acquire  bottom һܿԪ
+    }
+
+    // ߣӵײɹ true
+    bool Pop(T &out)
+    {
+        std::int64_t b = m_Bottom.load(std::memory_order_relaxed) - 1;
+        Ring *ring = m_Ring.load(std::memory_order_relaxed);
+        m_Bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t t = m_Top.load(std::memory_order_relaxed);
+
+        if (t > b)
+        {
+            // Ϊգָ bottom
+            m_Bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        out = ring->Load(b);
+        if (t == b)
+        {
+            // ֻʣһԪأȡͨ CAS top 
+            bool won = m_Top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            m_Bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // ̣߳Ӷȡɹ true (ʧܿǶпգҲ˾ʧ)
+    bool Steal(T &out)
+    {
+        std::int64_t t = m_Top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t b = m_Bottom.load(std::memory_order_acquire);
+        if (t >= b)
+            return false;
+
+        Ring *ring = m_Ring.load(std::memory_order_acquire);
+        T value = ring->Load(t);
+        if (!m_Top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return false;
+        out = value;
+        return true;
+    }
+
+    // ֵʽж (ҪҪȥ͵)
+    bool Empty() const
+    {
+        std::int64_t b = m_Bottom.load(std::memory_order_relaxed);
+        std::int64_t t = m_Top.load(std::memory_order_relaxed);
+        return b <= t;
+    }
+};
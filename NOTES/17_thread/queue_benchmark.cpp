@@ -0,0 +1,186 @@
+/**
+ * @file queue_benchmark.cpp
+ * @brief std::mutex + std::queue vs MpmcQueue / SpscChannel (汾)1~16 /µ (ops/sec)
+ * @note : g++ -O3 -std=c++20 -pthread queue_benchmark.cpp -o queue_benchmark
+ *       ѹ (ThreadSanitizer): g++ -O1 -g -std=c++20 -pthread -fsanitize=thread queue_benchmark.cpp -o queue_tsan
+ *                                   ./queue_tsan 20000
+ *       ÿһֶУ"ȡԪظУ == "κζʧ/ظӡ MISMATCH ط 0
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ConcurrentQueue.h"
+#include "../23_Benchmarking/Timer.h"
+
+using namespace concurrent;
+
+constexpr std::size_t kCapacity = 1024;
+
+// ==========================================
+// 1. 飺std::mutex + std::queue + 
+// ==========================================
+template <typename T>
+class MutexQueue
+{
+private:
+    std::mutex m_Mutex;
+    std::condition_variable m_NotEmpty;
+    std::queue<T> m_Queue;
+    bool m_Closed = false;
+
+public:
+    explicit MutexQueue(std::size_t) {}
+
+    bool Push(T value)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Queue.push(std::move(value));
+        }
+        m_NotEmpty.notify_one();
+        return true;
+    }
+
+    bool Pop(T &out)
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_NotEmpty.wait(lock, [this] { return !m_Queue.empty() || m_Closed; });
+        if (m_Queue.empty())
+            return false;
+        out = std::move(m_Queue.front());
+        m_Queue.pop();
+        return true;
+    }
+
+    void Close()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Closed = true;
+        }
+        m_NotEmpty.notify_all();
+    }
+};
+
+// ÷TryPush / TryPop ʧܾ yield ԣ
+template <typename Queue>
+class Spinning
+{
+private:
+    Queue m_Queue;
+    std::atomic<bool> m_Closed{false};
+
+public:
+    explicit Spinning(std::size_t capacity) : m_Queue(capacity) {}
+
+    template <typename U>
+    bool Push(U &&value)
+    {
+        while (!m_Queue.TryPush(std::forward<U>(value)))
+            std::this_thread::yield();
+        return true;
+    }
+
+    bool Pop(typename Queue::value_type &out)
+    {
+        while (!m_Queue.TryPop(out))
+        {
+            if (m_Closed.load(std::memory_order_acquire))
+                return m_Queue.TryPop(out);
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    void Close() { m_Closed.store(true, std::memory_order_release); }
+};
+
+// ==========================================
+// 2. ԿܣP ߡC ߣУԪظУ
+// ==========================================
+static int g_Failures = 0;
+
+template <typename Queue>
+void RunCase(const std::string &name, int producers, int consumers, std::size_t totalItems)
+{
+    Queue queue(kCapacity);
+    std::size_t perProducer = totalItems / producers;
+    std::size_t pushed = perProducer * producers;
+
+    std::atomic<std::uint64_t> popCount{0};
+    std::atomic<std::uint64_t> popSum{0};
+
+    Timer timer(name.c_str(), pushed);
+    std::vector<std::thread> consumerThreads;
+    for (int c = 0; c < consumers; c++)
+        consumerThreads.emplace_back([&]
+                                     {
+            std::uint64_t count = 0, sum = 0, value = 0;
+            while (queue.Pop(value))
+            {
+                count++;
+                sum += value;
+            }
+            popCount.fetch_add(count);
+            popSum.fetch_add(sum); });
+
+    std::vector<std::thread> producerThreads;
+    for (int p = 0; p < producers; p++)
+        producerThreads.emplace_back([&, p]
+                                     {
+            std::uint64_t base = static_cast<std::uint64_t>(p) * perProducer;
+            for (std::size_t i = 0; i < perProducer; i++)
+                queue.Push(base + i + 1); });
+
+    for (auto &t : producerThreads)
+        t.join();
+    queue.Close(); // ߽ٹر
+    for (auto &t : consumerThreads)
+        t.join();
+    double us = timer.Stop();
+
+    std::uint64_t expectedSum = static_cast<std::uint64_t>(pushed) * (pushed + 1) / 2;
+    bool ok = popCount.load() == pushed && popSum.load() == expectedSum;
+    if (!ok)
+        g_Failures++;
+    std::cout << "    -> " << std::fixed << std::setprecision(2) << pushed / us << " Mops/s"
+              << std::defaultfloat << std::setprecision(6) << (ok ? "" : "  MISMATCH") << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    std::size_t items = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    std::cout << "Items per case: " << items << ", capacity " << kCapacity << ", hardware threads "
+              << std::thread::hardware_concurrency() << " (Run in Release Mode! -O3)" << std::endl;
+
+    std::cout << "\n=== 1. SPSC (1 producer / 1 consumer) ===" << std::endl;
+    RunCase<MutexQueue<std::uint64_t>>("mutex + std::queue", 1, 1, items);
+    RunCase<Spinning<MpmcQueue<std::uint64_t>>>("MpmcQueue (spin)", 1, 1, items);
+    RunCase<Spinning<SpscChannel<std::uint64_t>>>("SpscChannel (spin)", 1, 1, items);
+    RunCase<BlockingSpscChannel<std::uint64_t>>("BlockingSpscChannel", 1, 1, items);
+
+    for (int n : {2, 4, 8, 16})
+    {
+        std::cout << "\n=== 2. MPMC (" << n << " producers / " << n << " consumers) ===" << std::endl;
+        RunCase<MutexQueue<std::uint64_t>>("mutex + std::queue", n, n, items);
+        RunCase<Spinning<MpmcQueue<std::uint64_t>>>("MpmcQueue (spin)", n, n, items);
+        RunCase<BlockingMpmcQueue<std::uint64_t>>("BlockingMpmcQueue", n, n, items);
+    }
+
+    // ǶԳƣһ߻ܽ (͵"߳ -> ߳")
+    std::cout << "\n=== 3. Fan-in (8 producers / 1 consumer) ===" << std::endl;
+    RunCase<MutexQueue<std::uint64_t>>("mutex + std::queue", 8, 1, items);
+    RunCase<BlockingMpmcQueue<std::uint64_t>>("BlockingMpmcQueue", 8, 1, items);
+
+    std::cout << "\n" << (g_Failures == 0 ? "All cases verified." : "FAILURES DETECTED!") << std::endl;
+    return g_Failures == 0 ? 0 : 1;
+}
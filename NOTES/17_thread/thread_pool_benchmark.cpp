@@ -0,0 +1,229 @@
+/**
+ * @file thread_pool_benchmark.cpp
+ * @brief ÿһ std::thread vs ThreadPool::submitӳ١parallel_for / parallel_reduce
+ * @note : g++ -O3 -std=c++20 -pthread thread_pool_benchmark.cpp -o thread_pool_benchmark
+ *       ݾ: g++ -O1 -g -std=c++20 -pthread -fsanitize=thread thread_pool_benchmark.cpp
+ *       (TSan ʾ֧ atomic_thread_fencePop/Steal  seq_cst դ㷨ģɺԸþ)
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <numeric>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+#include "ThreadPool.h"
+#include "../23_Benchmarking/Timer.h"
+
+using namespace std::chrono_literals;
+
+constexpr int kTasks = 20000;
+constexpr int kRoundTrips = 20000;
+constexpr std::size_t kElements = 50000000;
+
+// һСʵﳣ"һ㶫ͽ"
+static long long SmallWork(int i)
+{
+    long long x = i;
+    for (int k = 0; k < 100; k++)
+        x = x * 31 + k;
+    return x;
+}
+
+// ==========================================
+// 1. д (thread.md)worker ѯ stop ־ stop_token ֮ĶԱ
+// ==========================================
+void DemoStopToken()
+{
+    std::cout << "=== 1. Stop a background worker ===" << std::endl;
+    ThreadPool pool(2);
+    std::stop_source stop;
+
+    auto start = std::chrono::steady_clock::now();
+    std::future<int> worker = pool.submit_cancellable(stop.get_token(), [](std::stop_token token)
+                                                      {
+        int rounds = 0;
+        while (!token.stop_requested())
+        {
+            rounds++;
+            std::this_thread::sleep_for(1ms); // ģһСι sleep 1 
+        }
+        return rounds; });
+
+    std::this_thread::sleep_for(50ms);
+    stop.request_stop();
+    int rounds = worker.get();
+    auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "  worker ran " << rounds << " rounds, stopped " << (elapsed - 50.0) << " ms after request"
+              << std::endl;
+
+    // Ѿȡƣִ
+    std::future<int> skipped = pool.submit_cancellable(stop.get_token(), [] { return 42; });
+    try
+    {
+        skipped.get();
+    }
+    catch (const std::future_error &e)
+    {
+        std::cout << "  cancelled task: " << e.what() << std::endl;
+    }
+}
+
+// ==========================================
+// 2. /߳ vs Ͷݵ
+// ==========================================
+void TestThreadPerTask()
+{
+    std::vector<long long> results(kTasks);
+    Timer timer("std::thread per task (spawn + join)", kTasks);
+    for (int i = 0; i < kTasks; i += 8) // ÿ 8 ̣߳һԴ߳
+    {
+        std::thread batch[8];
+        for (int k = 0; k < 8; k++)
+            batch[k] = std::thread([&results, i, k] { results[i + k] = SmallWork(i + k); });
+        for (auto &t : batch)
+            t.join();
+    }
+    timer.Stop();
+    DoNotOptimize(results);
+}
+
+void TestPoolSubmit(ThreadPool &pool)
+{
+    std::vector<std::future<long long>> futures;
+    futures.reserve(kTasks);
+    Timer timer("ThreadPool::submit + future.get", kTasks);
+    for (int i = 0; i < kTasks; i++)
+        futures.push_back(pool.submit(SmallWork, i));
+    long long sum = 0;
+    for (auto &f : futures)
+        sum += f.get();
+    timer.Stop();
+    DoNotOptimize(sum);
+}
+
+// һύһύһ" + ִ + ֪ͨ"ӳ
+void TestRoundTrip(ThreadPool &pool)
+{
+    long long sum = 0;
+    Timer timer("ThreadPool round trip (submit -> get)", kRoundTrips);
+    for (int i = 0; i < kRoundTrips; i++)
+        sum += pool.submit([i] { return i; }).get();
+    timer.Stop();
+    DoNotOptimize(sum);
+}
+
+// ==========================================
+// 3. ݲУparallel_for / parallel_reduce
+// ==========================================
+void TestParallel(ThreadPool &pool, const std::vector<double> &data)
+{
+    double serial = 0;
+    {
+        Timer timer("serial std::accumulate", kElements);
+        serial = std::accumulate(data.begin(), data.end(), 0.0);
+        timer.Stop();
+        DoNotOptimize(serial);
+    }
+
+    double reduced = 0;
+    {
+        Timer timer("pool.parallel_reduce", kElements);
+        reduced = pool.parallel_reduce(
+            0, data.size(), 0.0,
+            [&](std::size_t b, std::size_t e) { return std::accumulate(data.begin() + b, data.begin() + e, 0.0); },
+            [](double a, double b) { return a + b; });
+        timer.Stop();
+        DoNotOptimize(reduced);
+    }
+
+    std::vector<double> out(data.size());
+    {
+        Timer timer("pool.parallel_for (out[i] = data[i] * 2)", kElements);
+        pool.parallel_for(0, data.size(), [&](std::size_t i) { out[i] = data[i] * 2.0; });
+        timer.Stop();
+        DoNotOptimize(out);
+    }
+    std::cout << "  serial sum " << serial << ", parallel sum " << reduced << std::endl;
+}
+
+// ڲٵ parallel_forȴʱ̻߳æִԲ
+void DemoNested(ThreadPool &pool)
+{
+    std::atomic<long long> total{0};
+    std::vector<std::future<void>> outer;
+    for (int t = 0; t < 16; t++)
+        outer.push_back(pool.submit([&pool, &total]
+                                    { pool.parallel_for(0, 1000, [&](std::size_t i)
+                                                        { total.fetch_add(static_cast<long long>(i), std::memory_order_relaxed); }); }));
+    for (auto &f : outer)
+        f.get();
+    std::cout << "  nested parallel_for total = " << total.load() << " (expected " << 16LL * 999 * 1000 / 2 << ")"
+              << std::endl;
+}
+
+// ==========================================
+// 4. ѾŶӵ submit() ȫִ꣬future ܵõ broken_promise
+// ==========================================
+void DemoShutdown()
+{
+    std::vector<std::future<long long>> results;
+    {
+        ThreadPool single(1);
+        results.push_back(single.submit([] { std::this_thread::sleep_for(10ms); return 0LL; })); // úŶ
+        for (int i = 1; i < 20; i++)
+            results.push_back(single.submit(SmallWork, i));
+    } // ʱ󲿷ڶ
+
+    int ok = 0, broken = 0;
+    for (auto &f : results)
+    {
+        try
+        {
+            f.get();
+            ok++;
+        }
+        catch (const std::future_error &)
+        {
+            broken++;
+        }
+    }
+    std::cout << "  ThreadPool(1) destroyed with " << results.size() << " queued tasks: ok=" << ok
+              << ", broken=" << broken << (broken == 0 ? " (all ran)" : " (DROPPED)") << std::endl;
+}
+
+int main()
+{
+    DemoStopToken();
+
+    ThreadPool pool;
+    std::cout << "\n=== 2. Task throughput (" << pool.size() << " workers, Run in Release Mode! -O3) ===" << std::endl;
+    for (int pass = 0; pass < 2; pass++)
+    {
+        TestThreadPerTask();
+        TestPoolSubmit(pool);
+        TestRoundTrip(pool);
+        std::cout << "--------------------------------" << std::endl;
+    }
+
+    std::cout << "\n=== 3. Data parallel (" << kElements << " doubles) ===" << std::endl;
+    std::vector<double> data(kElements);
+    for (std::size_t i = 0; i < kElements; i++)
+        data[i] = static_cast<double>(i % 1000) * 0.5;
+    for (int pass = 0; pass < 2; pass++)
+    {
+        TestParallel(pool, data);
+        std::cout << "--------------------------------" << std::endl;
+    }
+
+    std::cout << "\n=== 4. Nested parallelism ===" << std::endl;
+    DemoNested(pool);
+
+    std::cout << "\n=== 5. Shutdown drains the queue ===" << std::endl;
+    DemoShutdown();
+    return 0;
+}
@@ -0,0 +1,355 @@
+/**
+ * @file RecordFile.h
+ * @brief 汾ĶƼ¼ļļͷ (schema ϣ) + Ķ¼ + ѡĴУ͵β
+ *        ȡ mmap ļֱӷ std::span<const T>
+ * @note Ҫ C++20 (std::span / std::bit_cast)ȡʹ POSIX mmap (Linux / macOS)
+ *
+ * type_punning.md  StructToArrayDemo  Entity*  int* ˵"ṹڴһֽ"
+ * ֻҪ̶ֹ (ƽɸơָ)⴮ֽԭдļ mmap ֱӵ Entity ã
+ *   - ļͷ 64 ֽڣħʽ汾ֽǡschema ϣ¼С/롢¼ƫ
+ *   - ¼ 64 ֽڶƫƿʼmmap صĵַҳ룬ÿ¼ alignof(T)
+ *   - β (ѡ)ÿ kBlockRecords ¼һ 64 λУͣҲУ
+ * ϸļͷ std::bit_cast ֽȡ (һ 64 ֽڿ)¼֧
+ * std::start_lifetime_as_array (C++23) ʱʼڣ˻ std::launder(reinterpret_cast)
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace records
+{
+    // ==========================================
+    // 1. Schemaÿּ¼ػ RecordSchema<T>дֶͰ汾
+    // ==========================================
+    // template <> struct RecordSchema<Entity> { static constexpr std::string_view kLayout = "Entity{i32 x;i32 y;}"; static constexpr std::uint32_t kVersion = 1; };
+    // ֶɾʱ޸ kLayout  kVersionļ schema ϣͶԲϣȡʱֱӱǶ
+    template <typename T>
+    struct RecordSchema;
+
+    // 64 λ FNV-1aֻ schema  (ܶ)
+    constexpr std::uint64_t Fnv1a(std::string_view text, std::uint64_t h = 0xcbf29ce484222325ULL)
+    {
+        for (char c : text)
+        {
+            h ^= static_cast<unsigned char>(c);
+            h *= 0x100000001b3ULL;
+        }
+        return h;
+    }
+
+    template <typename T>
+    constexpr std::uint64_t SchemaHash()
+    {
+        std::uint64_t h = Fnv1a(RecordSchema<T>::kLayout);
+        for (std::uint64_t v : {std::uint64_t{RecordSchema<T>::kVersion}, std::uint64_t{sizeof(T)}, std::uint64_t{alignof(T)}})
+            h = (h ^ v) * 0x100000001b3ULL;
+        return h;
+    }
+
+    // ݿУͣÿδ 8 ֽ (FNV ֽ̫ MB ļ¼Ҫٺ)
+    inline std::uint64_t Checksum64(const std::byte *data, std::size_t size)
+    {
+        std::uint64_t h = 0x9E3779B97F4A7C15ULL ^ size;
+        std::size_t i = 0;
+        for (; i + 8 <= size; i += 8)
+        {
+            std::uint64_t word;
+            std::memcpy(&word, data + i, 8);
+            h = (h ^ word) * 0xff51afd7ed558ccdULL;
+            h ^= h >> 32;
+        }
+        for (; i < size; i++)
+            h = (h ^ static_cast<std::uint8_t>(data[i])) * 0x100000001b3ULL;
+        return h ^ (h >> 29);
+    }
+
+    // ==========================================
+    // 2. ļ
+    // ==========================================
+    inline constexpr std::array<char, 8> kFileMagic = {'N', 'O', 'T', 'E', 'S', 'R', 'E', 'C'};
+    inline constexpr std::array<char, 8> kIndexMagic = {'R', 'E', 'C', 'I', 'N', 'D', 'E', 'X'};
+    inline constexpr std::uint32_t kFormatVersion = 1;
+    inline constexpr std::uint32_t kEndianTag = 0x01020304; // ˻϶ 0x04030201
+    inline constexpr std::uint64_t kBlockRecords = 1 << 16;  // ÿǵļ¼
+    inline constexpr std::size_t kRecordsOffset = 64;
+
+    struct FileHeader
+    {
+        std::array<char, 8> magic;
+        std::uint32_t formatVersion;
+        std::uint32_t endianTag;
+        std::uint64_t schemaHash;
+        std::uint32_t recordSize;
+        std::uint32_t recordAlign;
+        std::uint64_t recordCount;
+        std::uint64_t recordsOffset;
+        std::uint64_t indexOffset; // 0 ʾûβ
+        std::uint64_t reserved;
+    };
+    static_assert(sizeof(FileHeader) == kRecordsOffset && std::is_trivially_copyable_v<FileHeader>);
+
+    // βIndexHeader ֮ blockCount  uint64_t У
+    struct IndexHeader
+    {
+        std::array<char, 8> magic;
+        std::uint64_t blockRecords;
+        std::uint64_t blockCount;
+        std::uint64_t checksum; // пУ͵У
+    };
+    static_assert(std::is_trivially_copyable_v<IndexHeader>);
+
+    template <typename T>
+    constexpr void CheckRecordType()
+    {
+        static_assert(std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>,
+                      "records: T must be trivially copyable and standard-layout (no pointers, no virtuals)");
+        static_assert(kRecordsOffset % alignof(T) == 0, "records: alignof(T) must divide 64");
+    }
+
+    // ==========================================
+    // 3. дˣռλдļͷ׷Ӽ¼Finish ʱдļͷ
+    // ==========================================
+    template <typename T>
+    class RecordWriter
+    {
+    public:
+        explicit RecordWriter(const std::string &path, bool withIndex = true)
+            : m_Out(path, std::ios::binary | std::ios::trunc), m_WithIndex(withIndex)
+        {
+            CheckRecordType<T>();
+            if (!m_Out)
+                throw std::runtime_error("RecordWriter: cannot open " + path);
+            const FileHeader placeholder{};
+            m_Out.write(reinterpret_cast<const char *>(&placeholder), sizeof(placeholder));
+        }
+
+        RecordWriter(const RecordWriter &) = delete;
+        RecordWriter &operator=(const RecordWriter &) = delete;
+        ~RecordWriter()
+        {
+            if (!m_Finished)
+            {
+                try
+                {
+                    Finish();
+                }
+                catch (...) // ׳Ҫ֪Ƿдɹʽ Finish()
+                {
+                }
+            }
+        }
+
+        void Append(std::span<const T> items)
+        {
+            const auto *bytes = reinterpret_cast<const std::byte *>(items.data());
+            std::size_t remaining = items.size();
+            while (remaining > 0)
+            {
+                // з֣ʹÿУֻǱļ¼
+                const std::size_t take = std::min<std::size_t>(remaining, kBlockRecords - m_InBlock);
+                if (m_WithIndex)
+                    m_BlockBytes.insert(m_BlockBytes.end(), bytes, bytes + take * sizeof(T));
+                m_Out.write(reinterpret_cast<const char *>(bytes), static_cast<std::streamsize>(take * sizeof(T)));
+                bytes += take * sizeof(T);
+                remaining -= take;
+                m_Count += take;
+                m_InBlock += take;
+                if (m_InBlock == kBlockRecords)
+                    CloseBlock();
+            }
+        }
+        void Append(const T &item) { Append(std::span<const T>(&item, 1)); }
+
+        void Finish()
+        {
+            if (m_Finished)
+                return;
+            m_Finished = true;
+            FileHeader header{kFileMagic, kFormatVersion, kEndianTag, SchemaHash<T>(), sizeof(T), alignof(T), m_Count, kRecordsOffset, 0, 0};
+            if (m_WithIndex)
+            {
+                if (m_InBlock > 0)
+                    CloseBlock();
+                header.indexOffset = kRecordsOffset + m_Count * sizeof(T);
+                const IndexHeader index{kIndexMagic, kBlockRecords, m_BlockSums.size(),
+                                        Checksum64(reinterpret_cast<const std::byte *>(m_BlockSums.data()), m_BlockSums.size() * 8)};
+                m_Out.write(reinterpret_cast<const char *>(&index), sizeof(index));
+                m_Out.write(reinterpret_cast<const char *>(m_BlockSums.data()), static_cast<std::streamsize>(m_BlockSums.size() * 8));
+            }
+            m_Out.seekp(0);
+            m_Out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            m_Out.close();
+            if (!m_Out)
+                throw std::runtime_error("RecordWriter: write failed");
+        }
+
+    private:
+        void CloseBlock()
+        {
+            if (m_WithIndex)
+                m_BlockSums.push_back(Checksum64(m_BlockBytes.data(), m_BlockBytes.size()));
+            m_BlockBytes.clear();
+            m_InBlock = 0;
+        }
+
+        std::ofstream m_Out;
+        bool m_WithIndex;
+        bool m_Finished = false;
+        std::uint64_t m_Count = 0;
+        std::uint64_t m_InBlock = 0;
+        std::vector<std::byte> m_BlockBytes; // ǰֽڣһһУ
+        std::vector<std::uint64_t> m_BlockSums;
+    };
+
+    template <typename T>
+    void WriteRecords(const std::string &path, std::span<const T> items, bool withIndex = true)
+    {
+        RecordWriter<T> writer(path, withIndex);
+        writer.Append(items);
+        writer.Finish();
+    }
+
+    // ==========================================
+    // 4. ȡˣmmap + Уļͷ¼ֱΪ span ȥ
+    // ==========================================
+    template <typename T>
+    class MappedRecords
+    {
+    public:
+        explicit MappedRecords(const std::string &path)
+        {
+            CheckRecordType<T>();
+            const int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0)
+                throw std::runtime_error("MappedRecords: cannot open " + path);
+            struct stat st{};
+            if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(FileHeader))
+            {
+                ::close(fd);
+                throw std::runtime_error("MappedRecords: file too small: " + path);
+            }
+            m_Size = static_cast<std::size_t>(st.st_size);
+            void *p = ::mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd); // ӳ佨 fd ͿԹص
+            if (p == MAP_FAILED)
+                throw std::runtime_error("MappedRecords: mmap failed: " + path);
+            m_Base = static_cast<const std::byte *>(p);
+            try
+            {
+                Validate();
+            }
+            catch (...)
+            {
+                ::munmap(const_cast<std::byte *>(m_Base), m_Size);
+                throw;
+            }
+        }
+
+        MappedRecords(const MappedRecords &) = delete;
+        MappedRecords &operator=(const MappedRecords &) = delete;
+        ~MappedRecords() { ::munmap(const_cast<std::byte *>(m_Base), m_Size); }
+
+        const FileHeader &Header() const { return m_Header; }
+        std::span<const T> Records() const { return m_Records; }
+        bool HasIndex() const { return m_Header.indexOffset != 0; }
+
+        // У飺ֻһּ¼ʱֻУӦĿ飬ûʱ true
+        bool VerifyBlock(std::uint64_t block) const
+        {
+            if (!HasIndex())
+                return true;
+            const std::uint64_t first = block * kBlockRecords;
+            if (first >= m_Records.size())
+                return false;
+            const std::size_t count = static_cast<std::size_t>(std::min<std::uint64_t>(kBlockRecords, m_Records.size() - first));
+            const auto *bytes = reinterpret_cast<const std::byte *>(m_Records.data() + first);
+            return Checksum64(bytes, count * sizeof(T)) == BlockSum(block);
+        }
+
+        bool VerifyAll() const
+        {
+            for (std::uint64_t b = 0; b < m_BlockCount; b++)
+                if (!VerifyBlock(b))
+                    return false;
+            return true;
+        }
+
+    private:
+        template <typename U>
+        U Load(std::size_t offset) const
+        {
+            std::array<std::byte, sizeof(U)> raw;
+            std::memcpy(raw.data(), m_Base + offset, sizeof(U));
+            return std::bit_cast<U>(raw);
+        }
+
+        std::uint64_t BlockSum(std::uint64_t block) const
+        {
+            return Load<std::uint64_t>(m_Header.indexOffset + sizeof(IndexHeader) + block * 8);
+        }
+
+        void Validate()
+        {
+            m_Header = Load<FileHeader>(0);
+            if (m_Header.magic != kFileMagic)
+                throw std::runtime_error("MappedRecords: not a record file");
+            if (m_Header.endianTag != kEndianTag)
+                throw std::runtime_error("MappedRecords: file was written with a different byte order");
+            if (m_Header.formatVersion != kFormatVersion)
+                throw std::runtime_error("MappedRecords: unsupported format version " + std::to_string(m_Header.formatVersion));
+            if (m_Header.schemaHash != SchemaHash<T>() || m_Header.recordSize != sizeof(T) || m_Header.recordAlign != alignof(T))
+                throw std::runtime_error("MappedRecords: schema mismatch (file was written for a different record layout)");
+            if (m_Header.recordsOffset % alignof(T) != 0 || m_Header.recordsOffset > m_Size ||
+                m_Header.recordCount > (m_Size - m_Header.recordsOffset) / sizeof(T))
+                throw std::runtime_error("MappedRecords: truncated record section");
+
+            const std::byte *first = m_Base + m_Header.recordsOffset;
+            const std::size_t count = static_cast<std::size_t>(m_Header.recordCount);
+#if defined(__cpp_lib_start_lifetime_as)
+            m_Records = std::span<const T>(std::start_lifetime_as_array<const T>(first, count), count);
+#else
+            m_Records = std::span<const T>(std::launder(reinterpret_cast<const T *>(first)), count);
+#endif
+
+            if (!HasIndex())
+                return;
+            const std::uint64_t recordsEnd = m_Header.recordsOffset + m_Header.recordCount * sizeof(T);
+            if (m_Header.indexOffset < recordsEnd || m_Header.indexOffset > m_Size - sizeof(IndexHeader))
+                throw std::runtime_error("MappedRecords: bad index offset");
+            const IndexHeader index = Load<IndexHeader>(m_Header.indexOffset);
+            const std::uint64_t expectedBlocks = (m_Header.recordCount + kBlockRecords - 1) / kBlockRecords;
+            if (index.magic != kIndexMagic || index.blockRecords != kBlockRecords || index.blockCount != expectedBlocks ||
+                index.blockCount > (m_Size - m_Header.indexOffset - sizeof(IndexHeader)) / 8)
+                throw std::runtime_error("MappedRecords: corrupt index");
+            if (Checksum64(m_Base + m_Header.indexOffset + sizeof(IndexHeader), index.blockCount * 8) != index.checksum)
+                throw std::runtime_error("MappedRecords: index checksum mismatch");
+            m_BlockCount = index.blockCount;
+        }
+
+        const std::byte *m_Base = nullptr;
+        std::size_t m_Size = 0;
+        FileHeader m_Header{};
+        std::span<const T> m_Records;
+        std::uint64_t m_BlockCount = 0;
+    };
+} // namespace records
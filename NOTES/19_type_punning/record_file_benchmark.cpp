@@ -0,0 +1,173 @@
+/**
+ * @file record_file_benchmark.cpp
+ * @brief ־û Entityiostream ı vs  read  vector vs mmap 㿽 (records::MappedRecords)Լ schema / Уͼ
+ * @note : g++ -O3 -std=c++20 record_file_benchmark.cpp -o record_file_benchmark
+ *       : ./record_file_benchmark [¼Ĭ 100000000] [ʱĿ¼Ĭ /tmp]
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "RecordFile.h"
+#include "../23_Benchmarking/Timer.h"
+
+// type_punning.md  POD ṹ
+struct Entity
+{
+    int x, y;
+
+    void Print() const { std::cout << "  [Entity] x: " << x << ", y: " << y << std::endl; }
+};
+
+// ֶд schemaĶʱͬ޸ģļͻᱻܾ
+template <>
+struct records::RecordSchema<Entity>
+{
+    static constexpr std::string_view kLayout = "Entity{i32 x;i32 y;}";
+    static constexpr std::uint32_t kVersion = 1;
+};
+
+// °汾һֶ
+struct Entity3D
+{
+    int x, y, z;
+};
+template <>
+struct records::RecordSchema<Entity3D>
+{
+    static constexpr std::string_view kLayout = "Entity{i32 x;i32 y;i32 z;}";
+    static constexpr std::uint32_t kVersion = 2;
+};
+
+// ==========================================
+// 1. ʾд 3 ¼mmap ֱӵ Entity ãschema ļʱı
+// ==========================================
+void Demo(const std::string &dir)
+{
+    std::cout << "=== 1. Demo ===" << std::endl;
+    const std::string path = dir + "/entities_demo.rec";
+    const std::vector<Entity> entities = {{5, 8}, {100, 200}, {-1, 42}};
+    records::WriteRecords<Entity>(path, entities);
+    {
+        records::MappedRecords<Entity> file(path);
+        std::cout << "  " << file.Records().size() << " records, index " << (file.HasIndex() ? "present" : "absent")
+                  << ", checksums " << (file.VerifyAll() ? "OK" : "BAD") << std::endl;
+        for (const Entity &e : file.Records())
+            e.Print();
+    }
+
+    try
+    {
+        records::MappedRecords<Entity3D> wrong(path);
+    }
+    catch (const std::runtime_error &e)
+    {
+        std::cout << "  Error caught: " << e.what() << std::endl;
+    }
+
+    // ĵһֽڣļͷϷУͶԲ
+    {
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(records::kRecordsOffset + 4);
+        f.put('\x7f');
+    }
+    {
+        records::MappedRecords<Entity> file(path);
+        std::cout << "  after flipping one byte: checksums " << (file.VerifyAll() ? "OK" : "BAD (detected)") << std::endl;
+    }
+    std::remove(path.c_str());
+}
+
+// ==========================================
+// 2. ׼n ¼ֶ sum(x + y) ȶ
+// ==========================================
+std::int64_t Sum(const Entity *first, std::size_t n)
+{
+    std::int64_t sum = 0;
+    for (std::size_t i = 0; i < n; i++)
+        sum += first[i].x + first[i].y;
+    return sum;
+}
+
+void Benchmark(std::size_t n, const std::string &dir)
+{
+    std::cout << "\n=== 2. Load " << n << " entities (Run in Release Mode! -O3) ===" << std::endl;
+    std::vector<Entity> entities(n);
+    std::mt19937 rng(42);
+    for (Entity &e : entities)
+        e = {static_cast<int>(rng() % 2000001) - 1000000, static_cast<int>(rng() % 2000001) - 1000000};
+    const std::int64_t expected = Sum(entities.data(), n);
+
+    const std::string textPath = dir + "/entities.txt";
+    const std::string binPath = dir + "/entities.rec";
+    {
+        Timer timer("write text (ofstream << x << ' ' << y)", n);
+        std::ofstream out(textPath);
+        for (const Entity &e : entities)
+            out << e.x << ' ' << e.y << '\n';
+    }
+    {
+        Timer timer("write binary (RecordWriter, with index)", n);
+        records::WriteRecords<Entity>(binPath, entities);
+    }
+    entities.clear();
+    entities.shrink_to_fit();
+
+    std::int64_t sums[4] = {};
+    {
+        Timer timer("text: ifstream >> x >> y into vector", n);
+        std::ifstream in(textPath);
+        std::vector<Entity> loaded;
+        loaded.reserve(n);
+        Entity e;
+        while (in >> e.x >> e.y)
+            loaded.push_back(e);
+        sums[0] = Sum(loaded.data(), loaded.size());
+    }
+    {
+        Timer timer("binary: ifstream.read into vector (one copy)", n);
+        std::ifstream in(binPath, std::ios::binary);
+        records::FileHeader header;
+        in.read(reinterpret_cast<char *>(&header), sizeof(header));
+        std::vector<Entity> loaded(header.recordCount);
+        in.read(reinterpret_cast<char *>(loaded.data()), static_cast<std::streamsize>(loaded.size() * sizeof(Entity)));
+        sums[1] = Sum(loaded.data(), loaded.size());
+    }
+    {
+        Timer timer("mmap: open + validate header (no pass over data)");
+        records::MappedRecords<Entity> file(binPath);
+        DoNotOptimize(file.Records().data());
+    }
+    {
+        Timer timer("mmap: open + one pass over span<const Entity>", n);
+        records::MappedRecords<Entity> file(binPath);
+        sums[2] = Sum(file.Records().data(), file.Records().size());
+    }
+    {
+        Timer timer("mmap: open + VerifyAll (checksum every block)", n);
+        records::MappedRecords<Entity> file(binPath);
+        sums[3] = file.VerifyAll() ? expected : 0;
+    }
+    bool same = sums[0] == expected && sums[1] == expected && sums[2] == expected && sums[3] == expected;
+    std::cout << "  results " << (same ? "identical" : "DIFFER") << std::endl;
+
+    std::ifstream text(textPath, std::ios::ate), bin(binPath, std::ios::ate | std::ios::binary);
+    std::cout << "  file size: text " << text.tellg() / 1000000 << " MB, binary " << bin.tellg() / 1000000 << " MB" << std::endl;
+    std::remove(textPath.c_str());
+    std::remove(binPath.c_str());
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000000;
+    const std::string dir = argc > 2 ? argv[2] : "/tmp";
+    Demo(dir);
+    Benchmark(n, dir);
+    return 0;
+}
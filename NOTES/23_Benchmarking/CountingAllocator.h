@@ -0,0 +1,79 @@
+/**
+ * @file CountingAllocator.h
+ * @brief ʼи׼ԹõĶѷͳƣ滻ȫ operator new/deleteÿڴǰ¼С
+ * @note ÷: ڻ׼Ե .cpp  #include һΣ֮ g_AllocCount / g_LiveBytes ȼ
+ *       滻 operator new/delete  inlineһֻһ .cpp ļ (ʼĻ׼Զǵļ)
+ *
+ *  relaxed ԭӱ̵߳Ļ׼ (Э̳߳) Ҳֱã
+ *   - g_AllocCount / g_AllocBytesۼƷֽ
+ *   - g_LiveBytesǰֽ (delete ʱͷشСټ)
+ *   - g_PeakBytesg_LiveBytes ķֵResetPeakBytes() ӵǰ¿ʼ¼
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// ==========================================
+// 1. 
+// ==========================================
+inline std::atomic<std::size_t> g_AllocCount{0};
+inline std::atomic<std::size_t> g_AllocBytes{0};
+inline std::atomic<std::size_t> g_LiveBytes{0};
+inline std::atomic<std::size_t> g_PeakBytes{0};
+
+// ѷֵΪǰصǰ (ΪһβĻ׼)
+inline std::size_t ResetPeakBytes()
+{
+    const std::size_t live = g_LiveBytes.load(std::memory_order_relaxed);
+    g_PeakBytes.store(live, std::memory_order_relaxed);
+    return live;
+}
+
+// ==========================================
+// 2. 滻ȫ operator new/delete
+// ==========================================
+// ͷռһ max_align_tظ÷ָ operator new ĶҪ
+inline constexpr std::size_t kCountingAllocHeader = alignof(std::max_align_t);
+
+// Сڷָ֮ǰͷGCC  malloc  delete ԡͷдԽ磬
+// ֻ漸󱨣ֻص
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+void *operator new(std::size_t size)
+{
+    void *raw = std::malloc(size + kCountingAllocHeader);
+    if (!raw)
+        throw std::bad_alloc();
+    *static_cast<std::size_t *>(raw) = size;
+    g_AllocCount.fetch_add(1, std::memory_order_relaxed);
+    g_AllocBytes.fetch_add(size, std::memory_order_relaxed);
+    const std::size_t live = g_LiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    std::size_t peak = g_PeakBytes.load(std::memory_order_relaxed);
+    while (live > peak && !g_PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+    {
+    }
+    return static_cast<char *>(raw) + kCountingAllocHeader;
+}
+
+void operator delete(void *p) noexcept
+{
+    if (!p)
+        return;
+    void *raw = static_cast<char *>(p) - kCountingAllocHeader;
+    g_LiveBytes.fetch_sub(*static_cast<std::size_t *>(raw), std::memory_order_relaxed);
+    std::free(raw);
+}
+
+void operator delete(void *p, std::size_t) noexcept { operator delete(p); }
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
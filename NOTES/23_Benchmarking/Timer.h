@@ -0,0 +1,69 @@
+/**
+ * @file Timer.h
+ * @brief ʼи׼Թõ RAII ʱ ( Benchmarking.md  Timer )
+ * @note ÷: { Timer timer("Name"); ...... } 뿪Զӡʱ
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+
+// ==========================================
+// 1. RAII ʱ (Scope-based Timer)
+// ==========================================
+class Timer
+{
+public:
+    // ops: μʱִеĲ 0 ʱӡ ns/op
+    explicit Timer(const char *name, std::size_t ops = 0)
+        : m_Name(name), m_Ops(ops), m_Stopped(false)
+    {
+        m_StartTime = std::chrono::steady_clock::now();
+    }
+
+    ~Timer()
+    {
+        Stop();
+    }
+
+    // غʱ (΢)ظֻӡһ
+    double Stop()
+    {
+        if (m_Stopped)
+            return m_ElapsedUs;
+
+        auto endTime = std::chrono::steady_clock::now();
+        m_ElapsedUs = std::chrono::duration<double, std::micro>(endTime - m_StartTime).count();
+        m_Stopped = true;
+
+        std::cout << "[" << m_Name << "] Duration: " << m_ElapsedUs << "us (" << m_ElapsedUs * 0.001 << "ms)";
+        if (m_Ops != 0)
+            std::cout << "  " << m_ElapsedUs * 1000.0 / m_Ops << " ns/op";
+        std::cout << std::endl;
+        return m_ElapsedUs;
+    }
+
+private:
+    const char *m_Name;
+    std::size_t m_Ops;
+    bool m_Stopped;
+    double m_ElapsedUs = 0.0;
+    std::chrono::time_point<std::chrono::steady_clock> m_StartTime;
+};
+
+// ==========================================
+// 2. ֹ (Dead Code Elimination)
+// ==========================================
+// ñΪ value "ȡ"ˣѭᱻɾ (GCC/Clang)
+template <typename T>
+inline void DoNotOptimize(const T &value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T *sink;
+    sink = &value;
+#endif
+}
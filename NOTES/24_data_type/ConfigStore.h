@@ -0,0 +1,348 @@
+/**
+ * @file ConfigStore.h
+ * @brief ϵͳļɲɱıƽ ConfigSnapshot ( + Ѱַ)
+ *        ConfigStore ԭָ + ָ (Hazard Pointer) գ޷䣬ȸ²
+ * @note Ҫ C++17Linux ± -pthread
+ *
+ * data_type.md  getConfigValue(key) ÿβҶһµ std::optional<std::string> (һַ)
+ * ÿ󶼶áżȸʱ "std::shared_mutex + std::unordered_map" д⣺
+ * ֮ҲҪͬһļ¼ʱджߵס
+ *   - ConfigSnapshot ֮޸ģмֵһַҷָ string_view
+ *   - ConfigStore ֻһ std::atomic<const ConfigSnapshot*>¼ = ¿գԭӽָ
+ *   - ɿղ delete (ܻж)ȰָǼǵԼ߳רķָۣ
+ *     дָ߽ɨвֻۣͷû˵Ǽǵľɿգ´¼ʱټ
+ * ·ֻһ seq_cst 洢 + μأȫڱ̶߳ռĻϣûҲûü
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace config
+{
+    // ==========================================
+    // 1. ConfigSnapshotɱıƽ
+    // ==========================================
+    // ļʽÿ "key = value"βհ׺ԣк #  ; ͷעͣͬһ key ֶʱЧ
+    class ConfigSnapshot
+    {
+    public:
+        ConfigSnapshot() = default;
+
+        static ConfigSnapshot Parse(std::string_view text)
+        {
+            struct Pair
+            {
+                std::string_view key, value;
+            };
+            std::vector<Pair> pairs;
+            std::size_t lineNumber = 0;
+            for (std::size_t pos = 0; pos < text.size();)
+            {
+                std::size_t end = text.find('\n', pos);
+                if (end == std::string_view::npos)
+                    end = text.size();
+                const std::string_view line = Trim(text.substr(pos, end - pos));
+                pos = end + 1;
+                lineNumber++;
+                if (line.empty() || line.front() == '#' || line.front() == ';')
+                    continue;
+                const std::size_t eq = line.find('=');
+                if (eq == std::string_view::npos || Trim(line.substr(0, eq)).empty())
+                    throw std::invalid_argument("config: line " + std::to_string(lineNumber) + ": expected 'key = value'");
+                pairs.push_back({Trim(line.substr(0, eq)), Trim(line.substr(eq + 1))});
+            }
+
+            // ȶÿͬ key ȡһ
+            std::stable_sort(pairs.begin(), pairs.end(), [](const Pair &a, const Pair &b) { return a.key < b.key; });
+            ConfigSnapshot snapshot;
+            std::size_t arenaSize = 0;
+            for (const Pair &p : pairs)
+                arenaSize += p.key.size() + p.value.size();
+            snapshot.m_Arena.reserve(arenaSize);
+            for (std::size_t i = 0; i < pairs.size(); i++)
+            {
+                if (i + 1 < pairs.size() && pairs[i + 1].key == pairs[i].key)
+                    continue;
+                Entry e;
+                e.hash = std::hash<std::string_view>{}(pairs[i].key);
+                e.keyOffset = static_cast<std::uint32_t>(snapshot.m_Arena.size());
+                e.keyLength = static_cast<std::uint32_t>(pairs[i].key.size());
+                snapshot.m_Arena += pairs[i].key;
+                e.valueOffset = static_cast<std::uint32_t>(snapshot.m_Arena.size());
+                e.valueLength = static_cast<std::uint32_t>(pairs[i].value.size());
+                snapshot.m_Arena += pairs[i].value;
+                snapshot.m_Entries.push_back(e);
+            }
+            snapshot.BuildIndex();
+            return snapshot;
+        }
+
+        static ConfigSnapshot LoadFile(const std::string &path)
+        {
+            std::ifstream in(path, std::ios::binary);
+            if (!in)
+                throw std::runtime_error("config: cannot open " + path);
+            std::ostringstream text;
+            text << in.rdbuf();
+            return Parse(text.str());
+        }
+
+        // ص string_view ָڲմڼЧ
+        std::optional<std::string_view> Get(std::string_view key) const noexcept
+        {
+            if (m_Entries.empty())
+                return std::nullopt;
+            const std::size_t h = std::hash<std::string_view>{}(key);
+            for (std::size_t i = h & m_Mask;; i = (i + 1) & m_Mask)
+            {
+                const std::uint32_t slot = m_Slots[i];
+                if (slot == 0)
+                    return std::nullopt;
+                const Entry &e = m_Entries[slot - 1];
+                if (e.hash == h && KeyOf(e) == key)
+                    return ValueOf(e);
+            }
+        }
+
+        std::size_t Size() const { return m_Entries.size(); }
+
+        //  key ֵ
+        template <typename F>
+        void ForEach(F &&f) const
+        {
+            for (const Entry &e : m_Entries)
+                f(KeyOf(e), ValueOf(e));
+        }
+
+    private:
+        struct Entry
+        {
+            std::size_t hash;
+            std::uint32_t keyOffset, keyLength;
+            std::uint32_t valueOffset, valueLength;
+        };
+
+        static std::string_view Trim(std::string_view s)
+        {
+            const auto isSpace = [](char c) { return c == ' ' || c == '\t' || c == '\r'; };
+            while (!s.empty() && isSpace(s.front()))
+                s.remove_prefix(1);
+            while (!s.empty() && isSpace(s.back()))
+                s.remove_suffix(1);
+            return s;
+        }
+
+        std::string_view KeyOf(const Entry &e) const { return std::string_view(m_Arena).substr(e.keyOffset, e.keyLength); }
+        std::string_view ValueOf(const Entry &e) const { return std::string_view(m_Arena).substr(e.valueOffset, e.valueLength); }
+
+        // Ӳ 1/2 ̽ "Ŀ± + 1"0 ʾ
+        void BuildIndex()
+        {
+            std::size_t capacity = 8;
+            while (capacity < 2 * m_Entries.size())
+                capacity <<= 1;
+            m_Mask = capacity - 1;
+            m_Slots.assign(capacity, 0);
+            for (std::size_t n = 0; n < m_Entries.size(); n++)
+            {
+                std::size_t i = m_Entries[n].hash & m_Mask;
+                while (m_Slots[i] != 0)
+                    i = (i + 1) & m_Mask;
+                m_Slots[i] = static_cast<std::uint32_t>(n + 1);
+            }
+        }
+
+        std::string m_Arena;          //  key  value β
+        std::vector<Entry> m_Entries; //  key 
+        std::vector<std::uint32_t> m_Slots;
+        std::size_t m_Mask = 0;
+    };
+
+    // ==========================================
+    // 2. ̱߳ţÿ̵߳һζʱȡһ [0, kMaxThreads) ıţ߳˳ʱ黹
+    // ==========================================
+    inline constexpr std::size_t kMaxThreads = 256;
+
+    namespace detail
+    {
+        class ThreadIndex
+        {
+        public:
+            ThreadIndex()
+            {
+                std::lock_guard<std::mutex> lock(Mutex()); // ÿֻ߳ڵһʹʱһ
+                std::vector<bool> &used = Used();
+                for (std::size_t i = 0; i < kMaxThreads; i++)
+                    if (!used[i])
+                    {
+                        used[i] = true;
+                        m_Value = i;
+                        return;
+                    }
+            }
+            ~ThreadIndex()
+            {
+                if (m_Value == kMaxThreads)
+                    return;
+                std::lock_guard<std::mutex> lock(Mutex());
+                Used()[m_Value] = false;
+            }
+            std::size_t Value() const { return m_Value; }
+
+        private:
+            static std::mutex &Mutex()
+            {
+                static std::mutex mutex;
+                return mutex;
+            }
+            static std::vector<bool> &Used()
+            {
+                static std::vector<bool> used(kMaxThreads, false);
+                return used;
+            }
+            std::size_t m_Value = kMaxThreads; // kMaxThreads ʾû쵽
+        };
+
+        inline std::size_t CurrentThreadIndex()
+        {
+            thread_local ThreadIndex index;
+            return index.Value();
+        }
+    } // namespace detail
+
+    // ==========================================
+    // 3. ConfigStoreԭӿָ + ָ
+    // ==========================================
+    class ConfigStore
+    {
+        struct alignas(64) HazardSlot // ÿ߳һУ֮䲻α
+        {
+            std::atomic<const ConfigSnapshot *> pointer{nullptr};
+        };
+
+    public:
+        // ߾ڼղᱻͷţGet ص string_view һֱЧ
+        // ÿ߳ͬһʱֻܳһ Reader (ÿֻ߳һָ)
+        class Reader
+        {
+        public:
+            Reader(Reader &&other) noexcept : m_Slot(std::exchange(other.m_Slot, nullptr)), m_Snapshot(other.m_Snapshot) {}
+            Reader(const Reader &) = delete;
+            Reader &operator=(const Reader &) = delete;
+            Reader &operator=(Reader &&) = delete;
+            ~Reader()
+            {
+                if (m_Slot)
+                    m_Slot->pointer.store(nullptr, std::memory_order_release);
+            }
+
+            std::optional<std::string_view> Get(std::string_view key) const noexcept { return m_Snapshot->Get(key); }
+            const ConfigSnapshot &Snapshot() const { return *m_Snapshot; }
+            const ConfigSnapshot *operator->() const { return m_Snapshot; }
+
+        private:
+            friend class ConfigStore;
+            Reader(HazardSlot *slot, const ConfigSnapshot *snapshot) : m_Slot(slot), m_Snapshot(snapshot) {}
+
+            HazardSlot *m_Slot;
+            const ConfigSnapshot *m_Snapshot;
+        };
+
+        explicit ConfigStore(ConfigSnapshot initial = {}) : m_Current(new ConfigSnapshot(std::move(initial))) {}
+
+        ConfigStore(const ConfigStore &) = delete;
+        ConfigStore &operator=(const ConfigStore &) = delete;
+
+        // ʱκ Reader 
+        ~ConfigStore()
+        {
+            delete m_Current.load(std::memory_order_relaxed);
+            for (const ConfigSnapshot *old : m_Retired)
+                delete old;
+        }
+
+        Reader Acquire() const
+        {
+            const std::size_t index = detail::CurrentThreadIndex();
+            if (index >= kMaxThreads)
+                throw std::runtime_error("ConfigStore: too many reader threads");
+            HazardSlot &slot = m_Hazards[index];
+            if (slot.pointer.load(std::memory_order_relaxed) != nullptr)
+                throw std::logic_error("ConfigStore: this thread already holds a Reader");
+
+            // Ǽ -> ٶһΣζͬһָ룬˵Ǽʱû£дɨʱһܿεǼ
+            const ConfigSnapshot *snapshot = m_Current.load(std::memory_order_acquire);
+            while (true)
+            {
+                slot.pointer.store(snapshot, std::memory_order_seq_cst);
+                const ConfigSnapshot *again = m_Current.load(std::memory_order_seq_cst);
+                if (again == snapshot)
+                    return Reader(&slot, snapshot);
+                snapshot = again;
+            }
+        }
+
+        // ݽӿڣؿ ( getConfigValue ǩһ)Ҫ Reader 
+        std::optional<std::string> GetCopy(std::string_view key) const
+        {
+            Reader reader = Acquire();
+            if (std::optional<std::string_view> value = reader.Get(key))
+                return std::string(*value);
+            return std::nullopt;
+        }
+
+        // ¿գ߲ᱻд֮û
+        void Publish(ConfigSnapshot snapshot)
+        {
+            auto fresh = std::make_unique<const ConfigSnapshot>(std::move(snapshot));
+            std::lock_guard<std::mutex> lock(m_WriterMutex);
+            m_Retired.push_back(m_Current.exchange(fresh.release(), std::memory_order_seq_cst));
+            Reclaim();
+        }
+
+        // ʧʱ׳쳣ɿձֲ
+        void ReloadFromFile(const std::string &path) { Publish(ConfigSnapshot::LoadFile(path)); }
+
+        std::size_t RetiredCount() const
+        {
+            std::lock_guard<std::mutex> lock(m_WriterMutex);
+            return m_Retired.size();
+        }
+
+    private:
+        // ͷûбκζߵǼǵľɿ
+        void Reclaim()
+        {
+            std::vector<const ConfigSnapshot *> inUse;
+            for (const HazardSlot &slot : m_Hazards)
+                if (const ConfigSnapshot *p = slot.pointer.load(std::memory_order_seq_cst))
+                    inUse.push_back(p);
+            std::sort(inUse.begin(), inUse.end());
+            auto stillUsed = [&](const ConfigSnapshot *p) { return std::binary_search(inUse.begin(), inUse.end(), p); };
+            auto keep = std::partition(m_Retired.begin(), m_Retired.end(), stillUsed);
+            for (auto it = keep; it != m_Retired.end(); ++it)
+                delete *it;
+            m_Retired.erase(keep, m_Retired.end());
+        }
+
+        std::atomic<const ConfigSnapshot *> m_Current;
+        mutable HazardSlot m_Hazards[kMaxThreads];
+        mutable std::mutex m_WriterMutex;
+        std::vector<const ConfigSnapshot *> m_Retired; // ѻ¡ܻж
+    };
+} // namespace config
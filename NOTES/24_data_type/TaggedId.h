@@ -0,0 +1,313 @@
+/**
+ * @file TaggedId.h
+ * @brief յ UserID16 ֽڵдǩ TaggedId ( / ַ / ϳַ)
+ *        Լ switch ַ FastVisit ( std::visit)
+ * @note Ҫ C++17
+ *
+ * data_type.md  UserID = std::variant<int, std::string>  libstdc++ ռ 40 ֽ
+ * (std::string 32 ֽ +  + )ʹ ID ֻһ int
+ * TaggedId ֻռ 16 ֽڣһֽǱǩ (Tag)
+ *
+ *   ֽ 0..14                          ֽ 15 (Tag)
+ *   [ int64 ֵ | 7 ֽ 0 ]              0xFF          -> 
+ *   [  15 ַ | ʣಹ 0 ]          0..15 ()  -> ַ (UUID Ƭ "a1b2-c3d4" ֻ 9 ַ)
+ *   [ char* ָ | uint32  | 0 ]      0xFE          -> ϳַ ( 15 ַŷ)
+ *
+ * ַıʾΨһ (ʣֽ 0ַһ)
+ * ȱȽϡϣֱӴ 64 λ֣Ҫж͡ҲҪַȽϡ
+ * ֽڶ memcpy д union ˫ ( 19_type_punning)
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace ids
+{
+    namespace detail
+    {
+        inline std::uint64_t Mix64(std::uint64_t x)
+        {
+            x ^= x >> 33;
+            x *= 0xff51afd7ed558ccdULL;
+            x ^= x >> 33;
+            x *= 0xc4ceb9fe1a85ec53ULL;
+            x ^= x >> 33;
+            return x;
+        }
+    } // namespace detail
+
+    // ==========================================
+    // 1. TaggedId
+    // ==========================================
+    class TaggedId
+    {
+    public:
+        enum class Kind : std::uint8_t
+        {
+            Int,
+            InlineString,
+            HeapString
+        };
+
+        static constexpr std::size_t kInlineCapacity = 15;
+
+        TaggedId() noexcept : TaggedId(std::int64_t{0}) {} //  std::variant<int, ...> һĬ 0
+
+        TaggedId(std::int64_t value) noexcept
+        {
+            ClearBytes();
+            std::memcpy(m_Bytes, &value, sizeof(value));
+            m_Bytes[kTagByte] = kIntTag;
+        }
+        TaggedId(int value) noexcept : TaggedId(static_cast<std::int64_t>(value)) {}
+
+        TaggedId(std::string_view text) { AssignString(text); }
+        TaggedId(const char *text) : TaggedId(std::string_view(text)) {}
+        TaggedId(const std::string &text) : TaggedId(std::string_view(text)) {}
+
+        TaggedId(const TaggedId &other)
+        {
+            if (other.IsHeap())
+                AssignString(other.HeapView());
+            else
+                std::memcpy(m_Bytes, other.m_Bytes, sizeof(m_Bytes));
+        }
+
+        // ƶֻ 16 ֽڣԴ 0 (ӵжڴ)
+        TaggedId(TaggedId &&other) noexcept
+        {
+            std::memcpy(m_Bytes, other.m_Bytes, sizeof(m_Bytes));
+            other.ResetToZero();
+        }
+
+        TaggedId &operator=(const TaggedId &other)
+        {
+            if (this != &other)
+            {
+                TaggedId copy(other);
+                Swap(copy);
+            }
+            return *this;
+        }
+
+        TaggedId &operator=(TaggedId &&other) noexcept
+        {
+            if (this != &other)
+            {
+                Release();
+                std::memcpy(m_Bytes, other.m_Bytes, sizeof(m_Bytes));
+                other.ResetToZero();
+            }
+            return *this;
+        }
+
+        ~TaggedId() { Release(); }
+
+        void Swap(TaggedId &other) noexcept
+        {
+            unsigned char tmp[sizeof(m_Bytes)];
+            std::memcpy(tmp, m_Bytes, sizeof(m_Bytes));
+            std::memcpy(m_Bytes, other.m_Bytes, sizeof(m_Bytes));
+            std::memcpy(other.m_Bytes, tmp, sizeof(m_Bytes));
+        }
+
+        // --- ѯ ---
+        Kind GetKind() const noexcept
+        {
+            const unsigned char tag = m_Bytes[kTagByte];
+            return tag == kIntTag ? Kind::Int : tag == kHeapTag ? Kind::HeapString
+                                                                : Kind::InlineString;
+        }
+        bool IsInt() const noexcept { return m_Bytes[kTagByte] == kIntTag; }
+        bool IsString() const noexcept { return !IsInt(); }
+
+        // Ͳʱ׳ std::bad_variant_access std::get Ϊһ
+        std::int64_t AsInt() const
+        {
+            if (!IsInt())
+                throw std::bad_variant_access();
+            return static_cast<std::int64_t>(LoadWord(0));
+        }
+
+        // ص string_view ڱ޸ĻǰЧ
+        std::string_view AsString() const
+        {
+            if (IsInt())
+                throw std::bad_variant_access();
+            return IsHeap() ? HeapView() : std::string_view(reinterpret_cast<const char *>(m_Bytes), m_Bytes[kTagByte]);
+        }
+
+        // --- ʣһ switchvisitor յ std::int64_t  std::string_view ---
+        template <typename F>
+        decltype(auto) Visit(F &&f) const
+        {
+            switch (m_Bytes[kTagByte])
+            {
+            case kIntTag:
+                return std::forward<F>(f)(static_cast<std::int64_t>(LoadWord(0)));
+            case kHeapTag:
+                return std::forward<F>(f)(HeapView());
+            default:
+                return std::forward<F>(f)(std::string_view(reinterpret_cast<const char *>(m_Bytes), m_Bytes[kTagByte]));
+            }
+        }
+
+        // --- ϣǶַֻȽ/ 64 λ ---
+        friend bool operator==(const TaggedId &a, const TaggedId &b) noexcept
+        {
+            if (a.IsHeap() || b.IsHeap())
+                return a.IsHeap() && b.IsHeap() && a.HeapView() == b.HeapView();
+            return a.LoadWord(0) == b.LoadWord(0) && a.LoadWord(1) == b.LoadWord(1);
+        }
+        friend bool operator!=(const TaggedId &a, const TaggedId &b) noexcept { return !(a == b); }
+
+        std::size_t Hash() const noexcept
+        {
+            if (IsHeap())
+                return static_cast<std::size_t>(detail::Mix64(std::hash<std::string_view>{}(HeapView()) ^ kHeapTag));
+            return static_cast<std::size_t>(detail::Mix64(LoadWord(0) ^ detail::Mix64(LoadWord(1))));
+        }
+
+        friend std::ostream &operator<<(std::ostream &os, const TaggedId &id)
+        {
+            id.Visit([&os](auto value) { os << value; });
+            return os;
+        }
+
+    private:
+        static constexpr std::size_t kTagByte = 15;
+        static constexpr unsigned char kIntTag = 0xFF;
+        static constexpr unsigned char kHeapTag = 0xFE;
+
+        bool IsHeap() const noexcept { return m_Bytes[kTagByte] == kHeapTag; }
+
+        std::uint64_t LoadWord(std::size_t index) const noexcept
+        {
+            std::uint64_t word;
+            std::memcpy(&word, m_Bytes + index * 8, sizeof(word));
+            return word;
+        }
+
+        std::string_view HeapView() const noexcept
+        {
+            char *data;
+            std::uint32_t size;
+            std::memcpy(&data, m_Bytes, sizeof(data));
+            std::memcpy(&size, m_Bytes + 8, sizeof(size));
+            return std::string_view(data, size);
+        }
+
+        void ClearBytes() noexcept { std::memset(m_Bytes, 0, sizeof(m_Bytes)); }
+
+        void ResetToZero() noexcept
+        {
+            ClearBytes();
+            m_Bytes[kTagByte] = kIntTag;
+        }
+
+        void AssignString(std::string_view text)
+        {
+            ClearBytes();
+            if (text.size() <= kInlineCapacity)
+            {
+                std::memcpy(m_Bytes, text.data(), text.size());
+                m_Bytes[kTagByte] = static_cast<unsigned char>(text.size());
+                return;
+            }
+            if (text.size() > std::numeric_limits<std::uint32_t>::max())
+                throw std::length_error("TaggedId: string too long");
+            char *data = new char[text.size()];
+            std::memcpy(data, text.data(), text.size());
+            std::uint32_t size = static_cast<std::uint32_t>(text.size());
+            std::memcpy(m_Bytes, &data, sizeof(data));
+            std::memcpy(m_Bytes + 8, &size, sizeof(size));
+            m_Bytes[kTagByte] = kHeapTag;
+        }
+
+        void Release() noexcept
+        {
+            if (IsHeap())
+            {
+                char *data;
+                std::memcpy(&data, m_Bytes, sizeof(data));
+                delete[] data;
+            }
+        }
+
+        alignas(8) unsigned char m_Bytes[16];
+    };
+
+    static_assert(sizeof(TaggedId) == 16, "TaggedId must stay 16 bytes");
+
+    struct TaggedIdHash
+    {
+        std::size_t operator()(const TaggedId &id) const noexcept { return id.Hash(); }
+    };
+
+    // ==========================================
+    // 2. FastVisit switch (index())  std::variant
+    // ==========================================
+    // ÿ case ֱӵ f(*std::get_if<I>(&v))ת f
+    // ֧ 8 ѡͣvisitor ÿѡ͵ķͱͬ ( std::visit ͬ)
+    namespace detail
+    {
+        template <std::size_t I, typename Variant, typename F>
+        decltype(auto) VisitCase(Variant &&v, F &&f)
+        {
+            constexpr std::size_t N = std::variant_size_v<std::remove_cv_t<std::remove_reference_t<Variant>>>;
+            if constexpr (I < N)
+                return std::forward<F>(f)(*std::get_if<I>(&v));
+            else
+                return VisitCase<0>(std::forward<Variant>(v), std::forward<F>(f)); // ɴֻΪͳһ
+        }
+    } // namespace detail
+
+    template <typename F, typename Variant>
+    decltype(auto) FastVisit(F &&f, Variant &&v)
+    {
+        static_assert(std::variant_size_v<std::remove_cv_t<std::remove_reference_t<Variant>>> <= 8,
+                      "FastVisit supports at most 8 alternatives");
+        switch (v.index())
+        {
+        case 0:
+            return detail::VisitCase<0>(std::forward<Variant>(v), std::forward<F>(f));
+        case 1:
+            return detail::VisitCase<1>(std::forward<Variant>(v), std::forward<F>(f));
+        case 2:
+            return detail::VisitCase<2>(std::forward<Variant>(v), std::forward<F>(f));
+        case 3:
+            return detail::VisitCase<3>(std::forward<Variant>(v), std::forward<F>(f));
+        case 4:
+            return detail::VisitCase<4>(std::forward<Variant>(v), std::forward<F>(f));
+        case 5:
+            return detail::VisitCase<5>(std::forward<Variant>(v), std::forward<F>(f));
+        case 6:
+            return detail::VisitCase<6>(std::forward<Variant>(v), std::forward<F>(f));
+        case 7:
+            return detail::VisitCase<7>(std::forward<Variant>(v), std::forward<F>(f));
+        default:
+            throw std::bad_variant_access(); // valueless_by_exception
+        }
+    }
+} // namespace ids
+
+namespace std
+{
+    template <>
+    struct hash<ids::TaggedId>
+    {
+        std::size_t operator()(const ids::TaggedId &id) const noexcept { return id.Hash(); }
+    };
+} // namespace std
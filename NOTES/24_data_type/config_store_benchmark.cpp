@@ -0,0 +1,246 @@
+/**
+ * @file config_store_benchmark.cpp
+ * @brief getConfigValue ȸ³shared_mutex + unordered_map vs shared_ptr + atomic_load vs config::ConfigStore (ָ)
+ *        ̲߳ҵͬʱһ̲߳¼
+ * @note : g++ -O3 -std=c++17 -pthread config_store_benchmark.cpp -o config_store_benchmark
+ *       : ./config_store_benchmark [ÿߵĲҴĬ 2000000]
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "ConfigStore.h"
+#include "../23_Benchmarking/Timer.h"
+
+// ==========================================
+// 1. ı version ÿֵ "@version" β߿ǲͬһ
+// ==========================================
+constexpr int kKeys = 200;
+
+std::string KeyName(int i) { return "service.option_" + std::to_string(i); }
+
+std::string MakeConfigText(int version)
+{
+    std::string text = "# generated config\nversion = " + std::to_string(version) + "\n";
+    for (int i = 0; i < kKeys; i++)
+        text += KeyName(i) + " = value_" + std::to_string(i) + "@" + std::to_string(version) + "\n";
+    return text;
+}
+
+// ѯУ90% У10% ڵ keyָֻ key صָ룬ѯĻδûҿ
+std::vector<const std::string *> MakeQueries(const std::vector<std::string> &pool, std::size_t n, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::vector<const std::string *> queries(n);
+    for (const std::string *&q : queries)
+        q = &pool[rng() % 10 == 0 ? kKeys + rng() % 20 : rng() % kKeys];
+    return queries;
+}
+
+// ==========================================
+// 2. 
+// ==========================================
+// (a) д + unordered_map߹¼ʱֻ map
+class LockedConfig
+{
+public:
+    void Load(const config::ConfigSnapshot &snapshot)
+    {
+        std::unordered_map<std::string, std::string> fresh;
+        snapshot.ForEach([&](std::string_view k, std::string_view v) { fresh.emplace(k, v); });
+        std::unique_lock<std::shared_mutex> lock(m_Mutex);
+        m_Values.swap(fresh);
+    }
+    std::optional<std::string> Get(const std::string &key) const
+    {
+        std::shared_lock<std::shared_mutex> lock(m_Mutex);
+        auto it = m_Values.find(key);
+        if (it == m_Values.end())
+            return std::nullopt;
+        return it->second;
+    }
+
+private:
+    mutable std::shared_mutex m_Mutex;
+    std::unordered_map<std::string, std::string> m_Values;
+};
+
+// (b) shared_ptr  + std::atomic_loadlibstdc++ ڲһ߻Ҫü
+class SharedPtrConfig
+{
+public:
+    void Load(config::ConfigSnapshot snapshot)
+    {
+        std::atomic_store(&m_Current, std::make_shared<const config::ConfigSnapshot>(std::move(snapshot)));
+    }
+    std::shared_ptr<const config::ConfigSnapshot> Acquire() const { return std::atomic_load(&m_Current); }
+
+private:
+    std::shared_ptr<const config::ConfigSnapshot> m_Current;
+};
+
+// ==========================================
+// 3. data_type.md  getConfigValueΪ ConfigStore ȡ (ǩ)
+// ==========================================
+config::ConfigStore g_Config(config::ConfigSnapshot::Parse("username = PlayerOne\n"));
+
+std::optional<std::string> getConfigValue(const std::string &key)
+{
+    return g_Config.GetCopy(key);
+}
+
+void Demo()
+{
+    std::cout << "=== 1. getConfigValue on ConfigStore ===" << std::endl;
+    std::cout << "  difficulty: " << getConfigValue("difficulty").value_or("Normal") << std::endl;
+    if (auto user = getConfigValue("username"))
+        std::cout << "  User found: " << *user << std::endl;
+
+    {
+        config::ConfigStore::Reader reader = g_Config.Acquire(); // оɿ
+        g_Config.Publish(config::ConfigSnapshot::Parse("username = PlayerTwo\ndifficulty = Hard\n"));
+        std::cout << "  reader still sees: " << reader.Get("username").value_or("?")
+                  << ", retired snapshots kept alive: " << g_Config.RetiredCount() << std::endl;
+    }
+    g_Config.Publish(config::ConfigSnapshot::Parse("username = PlayerTwo\ndifficulty = Hard\n")); // ٷһΣɿûˣ
+    std::cout << "  after reload: " << *getConfigValue("username") << " / " << *getConfigValue("difficulty")
+              << ", retired snapshots: " << g_Config.RetiredCount() << std::endl;
+    try
+    {
+        g_Config.Publish(config::ConfigSnapshot::Parse("username PlayerThree\n"));
+    }
+    catch (const std::invalid_argument &e)
+    {
+        std::cout << "  Error caught: " << e.what() << " (old snapshot kept: " << *getConfigValue("username") << ")" << std::endl;
+    }
+}
+
+// ==========================================
+// 4. ׼readers ̸߳ lookups Σͬʱѡһ¼߳ (ÿ 1ms һ°汾)
+// ==========================================
+template <typename LookupFn, typename ReloadFn>
+void Run(const char *name, int readers, std::size_t lookups, bool reload, LookupFn lookup, ReloadFn reloadFn)
+{
+    std::vector<std::string> pool;
+    for (int i = 0; i < kKeys; i++)
+        pool.push_back(KeyName(i));
+    for (int i = 0; i < 20; i++)
+        pool.push_back("missing.option_" + std::to_string(i));
+    std::vector<std::vector<const std::string *>> queries;
+    for (int r = 0; r < readers; r++)
+        queries.push_back(MakeQueries(pool, lookups, 100 + r));
+
+    std::atomic<bool> done{false};
+    std::atomic<std::uint64_t> found{0}, inconsistent{0};
+    int reloads = 0;
+    std::thread reloader;
+    {
+        Timer timer(name, lookups * readers);
+        if (reload)
+            reloader = std::thread([&]
+                                   {
+                for (int version = 2; !done.load(std::memory_order_relaxed); version++)
+                {
+                    reloadFn(version);
+                    reloads++;
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                } });
+        std::vector<std::thread> threads;
+        for (int r = 0; r < readers; r++)
+            threads.emplace_back([&, r]
+                                 {
+                std::uint64_t hits = 0, bad = 0;
+                for (const std::string *key : queries[r])
+                    lookup(*key, hits, bad);
+                found += hits;
+                inconsistent += bad; });
+        for (std::thread &t : threads)
+            t.join();
+        done = true;
+        if (reloader.joinable())
+            reloader.join();
+    }
+    std::cout << "  hits " << found << ", reloads " << reloads << ", inconsistent reads " << inconsistent << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t lookups = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+    Demo();
+
+    // Ԥɸ汾Ŀı¼ֻ߳ + 
+    std::vector<std::string> texts;
+    for (int v = 0; v < 4; v++)
+        texts.push_back(MakeConfigText(v));
+    auto textFor = [&](int version) -> const std::string & { return texts[version % texts.size()]; };
+
+    LockedConfig locked;
+    SharedPtrConfig shared;
+    config::ConfigStore store;
+    locked.Load(config::ConfigSnapshot::Parse(textFor(1)));
+    shared.Load(config::ConfigSnapshot::Parse(textFor(1)));
+    store.Publish(config::ConfigSnapshot::Parse(textFor(1)));
+
+    // ͬһ "version" ֵĺ׺һ
+    auto consistent = [](std::string_view value, std::string_view version)
+    {
+        return value.size() > version.size() && value.substr(value.size() - version.size()) == version &&
+               value[value.size() - version.size() - 1] == '@';
+    };
+
+    std::cout << "\n=== 2. " << kKeys << " keys, " << lookups << " lookups per reader, 90% hits (Run in Release Mode! -O3) ===" << std::endl;
+    for (int readers : {1, 4})
+    {
+        for (bool reload : {false, true})
+        {
+            std::cout << "-- " << readers << " reader thread(s), " << (reload ? "reload every 1 ms" : "no reload") << " --" << std::endl;
+            Run("shared_mutex + unordered_map, optional<string> copy", readers, lookups, reload,
+                [&](const std::string &key, std::uint64_t &hits, std::uint64_t &)
+                { hits += locked.Get(key).has_value(); },
+                [&](int version)
+                { locked.Load(config::ConfigSnapshot::Parse(textFor(version))); });
+            Run("shared_ptr snapshot + std::atomic_load", readers, lookups, reload,
+                [&](const std::string &key, std::uint64_t &hits, std::uint64_t &bad)
+                {
+                    auto snapshot = shared.Acquire();
+                    if (auto value = snapshot->Get(key))
+                    {
+                        if (++hits % 64 == 0) // 飺ͬһ version ֵĺ׺һ
+                            bad += !consistent(*value, *snapshot->Get("version"));
+                    }
+                },
+                [&](int version)
+                { shared.Load(config::ConfigSnapshot::Parse(textFor(version))); });
+            Run("ConfigStore::Acquire + Get (string_view, hazard pointer)", readers, lookups, reload,
+                [&](const std::string &key, std::uint64_t &hits, std::uint64_t &bad)
+                {
+                    config::ConfigStore::Reader reader = store.Acquire();
+                    if (auto value = reader.Get(key))
+                    {
+                        if (++hits % 64 == 0)
+                            bad += !consistent(*value, *reader.Get("version"));
+                    }
+                },
+                [&](int version)
+                { store.Publish(config::ConfigSnapshot::Parse(textFor(version))); });
+            Run("ConfigStore::GetCopy (optional<string>)", readers, lookups, reload,
+                [&](const std::string &key, std::uint64_t &hits, std::uint64_t &)
+                { hits += store.GetCopy(key).has_value(); },
+                [&](int version)
+                { store.Publish(config::ConfigSnapshot::Parse(textFor(version))); });
+        }
+    }
+    std::cout << "  retired snapshots still alive: " << store.RetiredCount() << std::endl;
+    return 0;
+}
@@ -0,0 +1,258 @@
+/**
+ * @file tagged_id_benchmark.cpp
+ * @brief UserID = std::variant<int, std::string> vs TaggedIdÿԪصڴ桢 (get_if / std::visit / FastVisit) ϣ
+ * @note : g++ -O3 -std=c++17 tagged_id_benchmark.cpp -o tagged_id_benchmark
+ *       : ./tagged_id_benchmark [ID Ĭ 1000000]
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include "TaggedId.h"
+#include "../26_iterators/FlatHashMap.h"
+#include "../23_Benchmarking/CountingAllocator.h"
+#include "../23_Benchmarking/Timer.h"
+
+using UserID = std::variant<int, std::string>;
+using ids::TaggedId;
+
+// ==========================================
+// 1. data_type.md  printUserID TaggedId
+// ==========================================
+void PrintUserID(const TaggedId &id)
+{
+    id.Visit([](auto value)
+             {
+        if constexpr (std::is_same_v<decltype(value), std::int64_t>)
+            std::cout << "  Integer ID: " << value << std::endl;
+        else
+            std::cout << "  String UUID: " << value << std::endl; });
+}
+
+void Demo()
+{
+    std::cout << "=== 1. TaggedId demo ===" << std::endl;
+    TaggedId u1 = 1024;
+    TaggedId u2 = "a1b2-c3d4";
+    TaggedId u3 = "123e4567-e89b-12d3-a456-426614174000"; // 36 ַŵ
+    PrintUserID(u1);
+    PrintUserID(u2);
+    PrintUserID(u3);
+    try
+    {
+        std::string_view s = u1.AsString(); // u1  std::get һ׳ bad_variant_access
+        (void)s;
+    }
+    catch (const std::bad_variant_access &e)
+    {
+        std::cout << "  Error caught: " << e.what() << std::endl;
+    }
+
+    // FastVisitstd::variant Ҳ switch ַ
+    UserID v = "a1b2-c3d4";
+    ids::FastVisit([](const auto &arg) { std::cout << "  FastVisit on std::variant: " << arg << std::endl; }, v);
+    std::cout << "  sizeof(UserID) = " << sizeof(UserID) << ", sizeof(TaggedId) = " << sizeof(TaggedId) << std::endl;
+}
+
+// ==========================================
+// 2. ݣ70% 25%  UUID Ƭ (9 ַ)5%  UUID (36 ַ)
+// ==========================================
+std::string RandomHex(std::mt19937_64 &rng, std::size_t length)
+{
+    static const char kDigits[] = "0123456789abcdef";
+    std::string s(length, '0');
+    for (std::size_t i = 0; i < length; i++)
+        s[i] = (i == 4 && length == 9) || (length == 36 && (i == 8 || i == 13 || i == 18 || i == 23)) ? '-' : kDigits[rng() & 15];
+    return s;
+}
+
+std::vector<UserID> MakeIds(std::size_t n, std::uint64_t seed)
+{
+    std::mt19937_64 rng(seed);
+    std::vector<UserID> out;
+    out.reserve(n);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        unsigned r = static_cast<unsigned>(rng() % 100);
+        if (r < 70)
+            out.emplace_back(static_cast<int>(rng() & 0x7FFFFFFF));
+        else if (r < 95)
+            out.emplace_back(RandomHex(rng, 9));
+        else
+            out.emplace_back(RandomHex(rng, 36));
+    }
+    return out;
+}
+
+TaggedId ToTagged(const UserID &id)
+{
+    return ids::FastVisit([](const auto &arg) { return TaggedId(arg); }, id);
+}
+
+// ==========================================
+// 3. ȷԣȡϣת std::variant һ
+// ==========================================
+bool SelfCheck(const std::vector<UserID> &variants, const std::vector<TaggedId> &tagged)
+{
+    bool ok = true;
+    for (std::size_t i = 0; i < variants.size(); i++)
+    {
+        const UserID &v = variants[i];
+        const TaggedId &t = tagged[i];
+        if (const int *p = std::get_if<int>(&v))
+            ok = ok && t.IsInt() && t.AsInt() == *p;
+        else
+            ok = ok && t.IsString() && t.AsString() == std::get<std::string>(v);
+
+        // ԪرȽϣȹϵһ£ʱϣͬ
+        std::size_t j = (i * 7 + 1) % variants.size();
+        bool equalV = variants[i] == variants[j];
+        ok = ok && equalV == (tagged[i] == tagged[j]) && (!equalV || tagged[i].Hash() == tagged[j].Hash());
+
+        TaggedId copy = t, moved = TaggedId(t);
+        ok = ok && copy == t && moved == t;
+    }
+    return ok;
+}
+
+// ==========================================
+// 4. ׼
+// ==========================================
+int main(int argc, char **argv)
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    Demo();
+
+    std::vector<UserID> variants = MakeIds(n, 42);
+    std::vector<TaggedId> tagged;
+    tagged.reserve(n);
+    for (const UserID &id : variants)
+        tagged.push_back(ToTagged(id));
+    std::cout << "\n=== 2. Self-check vs std::variant: " << (SelfCheck(variants, tagged) ? "OK" : "FAILED") << " ===" << std::endl;
+
+    std::cout << "\n=== 3. Memory per element (" << n << " ids: 70% int, 25% 9-char, 5% 36-char) ===" << std::endl;
+    {
+        std::size_t before = g_LiveBytes;
+        std::vector<UserID> copy(variants);
+        std::cout << "  std::vector<UserID>   : " << double(g_LiveBytes - before) / n << " bytes/id" << std::endl;
+        before = g_LiveBytes;
+        std::vector<TaggedId> copy2(tagged);
+        std::cout << "  std::vector<TaggedId> : " << double(g_LiveBytes - before) / n << " bytes/id" << std::endl;
+    }
+
+    std::cout << "\n=== 4. Visit every id (Run in Release Mode! -O3) ===" << std::endl;
+    {
+        std::uint64_t sum = 0;
+        {
+            Timer timer("variant + get_if chain", n);
+            for (const UserID &id : variants)
+            {
+                if (const int *p = std::get_if<int>(&id))
+                    sum += static_cast<std::uint64_t>(*p);
+                else if (const std::string *s = std::get_if<std::string>(&id))
+                    sum += s->size();
+            }
+        }
+        DoNotOptimize(sum);
+        sum = 0;
+        auto visitor = [](const auto &arg) -> std::uint64_t
+        {
+            if constexpr (std::is_same_v<std::decay_t<decltype(arg)>, int>)
+                return static_cast<std::uint64_t>(arg);
+            else
+                return arg.size();
+        };
+        {
+            Timer timer("variant + std::visit", n);
+            for (const UserID &id : variants)
+                sum += std::visit(visitor, id);
+        }
+        DoNotOptimize(sum);
+        sum = 0;
+        {
+            Timer timer("variant + ids::FastVisit", n);
+            for (const UserID &id : variants)
+                sum += ids::FastVisit(visitor, id);
+        }
+        DoNotOptimize(sum);
+        sum = 0;
+        {
+            Timer timer("TaggedId::Visit", n);
+            for (const TaggedId &id : tagged)
+                sum += id.Visit([](auto value) -> std::uint64_t
+                                {
+                    if constexpr (std::is_same_v<decltype(value), std::int64_t>)
+                        return static_cast<std::uint64_t>(value);
+                    else
+                        return value.size(); });
+        }
+        DoNotOptimize(sum);
+    }
+
+    // ѯһ (е ID)һ벻 (һɵ ID)
+    std::vector<UserID> missVariants = MakeIds(n, 7);
+    std::vector<UserID> queryVariants;
+    std::vector<TaggedId> queryTagged;
+    queryVariants.reserve(2 * n);
+    queryTagged.reserve(2 * n);
+    std::mt19937 rng(1);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        queryVariants.push_back(variants[rng() % n]);
+        queryVariants.push_back(missVariants[i]);
+    }
+    for (const UserID &id : queryVariants)
+        queryTagged.push_back(ToTagged(id));
+
+    std::cout << "\n=== 5. Hash table: build " << n << " ids, then " << queryVariants.size() << " lookups (50% hit) ===" << std::endl;
+    std::size_t hitsV = 0, hitsT = 0, hitsF = 0;
+    {
+        std::size_t before = g_LiveBytes;
+        std::unordered_map<UserID, int> table;
+        {
+            Timer timer("unordered_map<UserID> build", n);
+            for (std::size_t i = 0; i < n; i++)
+                table.emplace(variants[i], static_cast<int>(i));
+        }
+        std::cout << "  memory: " << double(g_LiveBytes - before) / table.size() << " bytes/entry" << std::endl;
+        Timer timer("unordered_map<UserID> find", queryVariants.size());
+        for (const UserID &q : queryVariants)
+            hitsV += table.find(q) != table.end();
+    }
+    {
+        std::size_t before = g_LiveBytes;
+        std::unordered_map<TaggedId, int> table;
+        {
+            Timer timer("unordered_map<TaggedId> build", n);
+            for (std::size_t i = 0; i < n; i++)
+                table.emplace(tagged[i], static_cast<int>(i));
+        }
+        std::cout << "  memory: " << double(g_LiveBytes - before) / table.size() << " bytes/entry" << std::endl;
+        Timer timer("unordered_map<TaggedId> find", queryTagged.size());
+        for (const TaggedId &q : queryTagged)
+            hitsT += table.find(q) != table.end();
+    }
+    {
+        std::size_t before = g_LiveBytes;
+        FlatHashMap<TaggedId, int, ids::TaggedIdHash> table;
+        {
+            Timer timer("FlatHashMap<TaggedId> build", n);
+            for (std::size_t i = 0; i < n; i++)
+                table.emplace(tagged[i], static_cast<int>(i));
+        }
+        std::cout << "  memory: " << double(g_LiveBytes - before) / table.size() << " bytes/entry" << std::endl;
+        Timer timer("FlatHashMap<TaggedId> find", queryTagged.size());
+        for (const TaggedId &q : queryTagged)
+            hitsF += table.find(q) != table.end();
+    }
+    std::cout << "  hits: " << hitsV << " / " << hitsT << " / " << hitsF << (hitsV == hitsT && hitsT == hitsF ? " (identical)" : " MISMATCH") << std::endl;
+    return 0;
+}
@@ -0,0 +1,336 @@
+/**
+ * @file ContainerAlgorithms.h
+ * @brief ʱɾerase_if (ȶ)unstable_erase_if (ĩβ)erase_where (޷֧/AVX2 )
+ *        Լ"Ĺ + ӳѹ" TombstoneVector (ʺϱ߱޸)
+ * @note Ҫ C++17x86 Ͽ -mavx2 ( -march=native) ʱerase_where  4 ֽ 256 λ·
+ *
+ * iterators.md ¼"Safe Erasure"д it = data.erase(it) ȷģÿ erase ҪѺԪǰƣ
+ * ɾ k Ԫؾ O(k * n)k  n ͬʱ O(n^2)
+ * "һɨ裬ÿԪƶһ"
+ *   - erase_if˳򣬵ȼ erase-remove ÷ (C++20  std::erase_if)
+ *   - unstable_erase_if˳ĩβԪɾʱƶԪ
+ *   - erase_wherex  cmp(x, value) Ԫأ޷֧ѹ (ʱ֧Ԥʧ)
+ *   - TombstoneVectorʱֻǣһѹ
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CONTAINER_ALGO_HAS_AVX2 1
+#endif
+
+namespace container
+{
+    // ==========================================
+    // 1. ȶɾerase-remove ÷
+    // ==========================================
+    // ɾԪظ ( C++20 std::erase_if һ)
+    template <typename T, typename Alloc, typename Pred>
+    std::size_t erase_if(std::vector<T, Alloc> &v, Pred pred)
+    {
+        auto newEnd = std::remove_if(v.begin(), v.end(), pred);
+        std::size_t removed = static_cast<std::size_t>(v.end() - newEnd);
+        v.erase(newEnd, v.end());
+        return removed;
+    }
+
+    // ==========================================
+    // 2. ȶɾĩβԪ (swap with last)
+    // ==========================================
+    // ɾ k Ԫֻƶ k Σʺ"˳νɾϡ"ĳ (Ϸʵб)
+    template <typename T, typename Alloc>
+    void unstable_erase(std::vector<T, Alloc> &v, std::size_t index)
+    {
+        if (index + 1 != v.size())
+            v[index] = std::move(v.back());
+        v.pop_back();
+    }
+
+    template <typename T, typename Alloc, typename Pred>
+    std::size_t unstable_erase_if(std::vector<T, Alloc> &v, Pred pred)
+    {
+        std::size_t removed = 0;
+        std::size_t i = 0;
+        std::size_t end = v.size();
+        while (i < end)
+        {
+            if (pred(v[i]))
+            {
+                end--;
+                if (i != end)
+                    v[i] = std::move(v[end]); // Ԫػû i ǰ
+                removed++;
+            }
+            else
+            {
+                i++;
+            }
+        }
+        v.erase(v.begin() + static_cast<std::ptrdiff_t>(end), v.end());
+        return removed;
+    }
+
+    // ==========================================
+    // 3. ͵޷֧ / SIMD 
+    // ==========================================
+    // ɾ cmp(x, value) Ԫأ˳Cmp Ϊ std::less<> / std::greater<> / std::equal_to<> ȡ
+    // ·д룬ٰƽдָ  ûз֧Ҳûз֧Ԥʧ
+    namespace detail
+    {
+        template <typename T, typename Cmp>
+        std::size_t CompactBranchless(T *data, std::size_t begin, std::size_t out, std::size_t n, Cmp cmp, T value)
+        {
+            for (std::size_t i = begin; i < n; i++)
+            {
+                T x = data[i];
+                data[out] = x;
+                out += !cmp(x, value);
+            }
+            return out;
+        }
+
+#ifdef CONTAINER_ALGO_HAS_AVX2
+        // 8 λ -> permutevar8x32 ±Ҫ lane Ųλ
+        inline const std::array<std::array<std::int32_t, 8>, 256> &LeftPackTable()
+        {
+            static const std::array<std::array<std::int32_t, 8>, 256> table = []
+            {
+                std::array<std::array<std::int32_t, 8>, 256> t{};
+                for (int mask = 0; mask < 256; mask++)
+                {
+                    int k = 0;
+                    for (int lane = 0; lane < 8; lane++)
+                        if (mask & (1 << lane))
+                            t[mask][k++] = lane;
+                    for (; k < 8; k++)
+                        t[mask][k] = 0;
+                }
+                return t;
+            }();
+            return table;
+        }
+
+        //  8 λ"Ҫɾ"
+        template <typename T, typename Cmp>
+        int EraseMask(__m256i x, T value)
+        {
+            if constexpr (std::is_same_v<T, float>)
+            {
+                __m256 xf = _mm256_castsi256_ps(x), vf = _mm256_set1_ps(value);
+                __m256 m;
+                if constexpr (std::is_same_v<Cmp, std::less<>>)
+                    m = _mm256_cmp_ps(xf, vf, _CMP_LT_OQ);
+                else if constexpr (std::is_same_v<Cmp, std::greater<>>)
+                    m = _mm256_cmp_ps(xf, vf, _CMP_GT_OQ);
+                else
+                    m = _mm256_cmp_ps(xf, vf, _CMP_EQ_OQ);
+                return _mm256_movemask_ps(m);
+            }
+            else
+            {
+                __m256i v = _mm256_set1_epi32(static_cast<std::int32_t>(value));
+                __m256i m;
+                if constexpr (std::is_same_v<Cmp, std::less<>>)
+                    m = _mm256_cmpgt_epi32(v, x);
+                else if constexpr (std::is_same_v<Cmp, std::greater<>>)
+                    m = _mm256_cmpgt_epi32(x, v);
+                else
+                    m = _mm256_cmpeq_epi32(x, v);
+                return _mm256_movemask_ps(_mm256_castsi256_ps(m));
+            }
+        }
+
+        // ԭѹдλ out <= λ i 8 ȶĴдأḲǻû
+        template <typename T, typename Cmp>
+        std::size_t CompactAvx2(T *data, std::size_t n, T value)
+        {
+            const auto &table = LeftPackTable();
+            std::size_t out = 0, i = 0;
+            for (; i + 8 <= n; i += 8)
+            {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+                int keep = ~EraseMask<T, Cmp>(x, value) & 0xFF;
+                __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(table[keep].data()));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(data + out), _mm256_permutevar8x32_epi32(x, idx));
+                out += static_cast<std::size_t>(__builtin_popcount(static_cast<unsigned>(keep)));
+            }
+            return CompactBranchless(data, i, out, n, Cmp{}, value);
+        }
+#endif
+    } // namespace detail
+
+    template <typename T, typename Alloc, typename Cmp>
+    std::size_t erase_where(std::vector<T, Alloc> &v, Cmp cmp, T value)
+    {
+        static_assert(std::is_arithmetic_v<T>, "erase_where ֻ");
+        std::size_t kept;
+#ifdef CONTAINER_ALGO_HAS_AVX2
+        constexpr bool kSimdType = sizeof(T) == 4 && (std::is_integral_v<T> ? std::is_signed_v<T> : true);
+        constexpr bool kSimdCmp = std::is_same_v<Cmp, std::less<>> || std::is_same_v<Cmp, std::greater<>> ||
+                                  std::is_same_v<Cmp, std::equal_to<>>;
+        if constexpr (kSimdType && kSimdCmp)
+            kept = detail::CompactAvx2<T, Cmp>(v.data(), v.size(), value);
+        else
+            kept = detail::CompactBranchless(v.data(), 0, 0, v.size(), cmp, value);
+#else
+        kept = detail::CompactBranchless(v.data(), 0, 0, v.size(), cmp, value);
+#endif
+        std::size_t removed = v.size() - kept;
+        v.resize(kept);
+        return removed;
+    }
+
+    // ==========================================
+    // 4. TombstoneVectorĹ + ӳѹ
+    // ==========================================
+    // Erase(i) ֻǣǷڱжƶԪأ±ñЧpush_back Ԫزڱֱбʡ
+    // ֻطѹ (ȶO(n)) ForEach ʱEraseIf ʱ (Ĺֵѹ)
+    // Լʽ Compact() / Compacted()
+    // ע⣺ѹԪ±仯Ҫñ±
+    template <typename T>
+    class TombstoneVector
+    {
+    private:
+        std::vector<T> m_Items;
+        std::vector<std::uint8_t> m_Dead; // 1 = ɾ
+        std::size_t m_DeadCount = 0;
+        int m_IterationDepth = 0;
+        double m_MaxDeadRatio;
+
+        void MaybeCompact()
+        {
+            if (m_IterationDepth == 0 && m_DeadCount > 0 &&
+                static_cast<double>(m_DeadCount) > m_MaxDeadRatio * static_cast<double>(m_Items.size()))
+                Compact();
+        }
+
+    public:
+        explicit TombstoneVector(double maxDeadRatio = 0.25) : m_MaxDeadRatio(maxDeadRatio) {}
+
+        void reserve(std::size_t count)
+        {
+            m_Items.reserve(count);
+            m_Dead.reserve(count);
+        }
+
+        template <typename... Args>
+        std::size_t emplace_back(Args &&...args)
+        {
+            m_Items.emplace_back(std::forward<Args>(args)...);
+            m_Dead.push_back(0);
+            return m_Items.size() - 1;
+        }
+        std::size_t push_back(const T &value) { return emplace_back(value); }
+        std::size_t push_back(T &&value) { return emplace_back(std::move(value)); }
+
+        // Ԫظ / λ (Ĺ)
+        std::size_t size() const { return m_Items.size() - m_DeadCount; }
+        bool empty() const { return size() == 0; }
+        std::size_t SlotCount() const { return m_Items.size(); }
+        std::size_t DeadCount() const { return m_DeadCount; }
+
+        bool IsAlive(std::size_t index) const { return index < m_Items.size() && m_Dead[index] == 0; }
+        T &operator[](std::size_t index) { return m_Items[index]; }
+        const T &operator[](std::size_t index) const { return m_Items[index]; }
+
+        // O(1)ֻǣҲѹ ( Erase һ±ʱǰһѹú±λ)ɾ false
+        bool Erase(std::size_t index)
+        {
+            if (!IsAlive(index))
+                return false;
+            m_Dead[index] = 1;
+            m_DeadCount++;
+            return true;
+        }
+
+        template <typename Pred>
+        std::size_t EraseIf(Pred pred)
+        {
+            std::size_t removed = 0;
+            for (std::size_t i = 0; i < m_Items.size(); i++)
+            {
+                // ĹλߵĶ󣬲ܽ predԪذ pred ޷֧ش
+                if (m_Dead[i] != 0)
+                    continue;
+                std::uint8_t kill = static_cast<std::uint8_t>(pred(m_Items[i]));
+                m_Dead[i] = kill;
+                removed += kill;
+            }
+            m_DeadCount += removed;
+            MaybeCompact();
+            return removed;
+        }
+
+        // f(T &item, std::size_t index)ص Erase ±ꡢpush_back ԪأҲǶ ForEach
+        // ص push_back ֮ item ݶʧЧ֮ (*this)[index] ·
+        template <typename F>
+        void ForEach(F &&f)
+        {
+            m_IterationDepth++;
+            const std::size_t end = m_Items.size(); // Ԫز
+            try
+            {
+                for (std::size_t i = 0; i < end; i++)
+                    if (m_Dead[i] == 0)
+                        f(m_Items[i], i); // ÿȡãpush_back ݺûʧЧ
+            }
+            catch (...)
+            {
+                m_IterationDepth--;
+                throw;
+            }
+            m_IterationDepth--;
+            MaybeCompact();
+        }
+
+        // ȶѹеЧ ( 0) ForEach Զ
+        std::size_t Compact()
+        {
+            if (m_IterationDepth != 0 || m_DeadCount == 0)
+                return 0;
+            std::size_t out = 0;
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                //  erase_where ͬ޷֧д
+                for (std::size_t i = 0; i < m_Items.size(); i++)
+                {
+                    m_Items[out] = m_Items[i];
+                    out += m_Dead[i] == 0;
+                }
+            }
+            else
+            {
+                for (std::size_t i = 0; i < m_Items.size(); i++)
+                {
+                    if (m_Dead[i] != 0)
+                        continue;
+                    if (out != i)
+                        m_Items[out] = std::move(m_Items[i]);
+                    out++;
+                }
+            }
+            std::size_t removed = m_Items.size() - out;
+            m_Items.erase(m_Items.begin() + static_cast<std::ptrdiff_t>(out), m_Items.end());
+            m_Dead.assign(out, 0);
+            m_DeadCount = 0;
+            return removed;
+        }
+
+        // ֻݣڱʱѹеԺĹ
+        const std::vector<T> &Compacted()
+        {
+            Compact();
+            return m_Items;
+        }
+    };
+} // namespace container
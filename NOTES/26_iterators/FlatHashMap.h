@@ -0,0 +1,644 @@
+/**
+ * @file FlatHashMap.h
+ * @brief Ѱַıƽϣ FlatHashMap<K, V> (Swiss Table ˼·)16 ֽڿֽ + SSE2 ̽
+ * @note Ҫ C++17x86-64 Ĭϴ SSE2ƽ̨˻ΪֽڱȽ (ͬ)
+ *
+ * iterators.md  std::map<std::string, int> ageMap ǺÿԪһѽڵ㣬
+ * ʱÿһһָת (δ)std::unordered_map Ҳ"Ͱ + ڵ"
+ * FlatHashMap Ԫطһ
+ *   - ÿλһֽڣ (kEmpty)ɾ (kDeleted)ϣֵĵ 7 λ (H2)
+ *   - ʱһμ 16 ֽڣһ SIMD Ƚҳ H2 ͬĺѡֻȽһ key
+ *   -  7/8ɾֻѿֽڸĳ kDeleted (Ĺ)ƶκԪ
+ *
+ *  ( std::unordered_map Ա)
+ *   - erase Ԫصĵ/ʧЧ (ԪشӲƶ)
+ *   - insert  (rehash) ʱе/ʧЧ reserve(n) ɱ֤ n Ԫǰ
+ *   - ޸ʱα˳ͬ˳˳key С޹
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define FLAT_HASH_MAP_HAS_SSE2 1
+#endif
+
+// ==========================================
+// 1. ĬϹϣٻһΣ֤ 7 λ (H2) ͸λ (H1) 㹻
+// ==========================================
+// std::hash<int>  libstdc++ ǺȺֱȡ 7 λȫһ
+inline std::size_t MixHash(std::size_t h)
+{
+    std::uint64_t x = h;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return static_cast<std::size_t>(x);
+}
+
+template <typename K>
+struct FlatHash
+{
+    std::size_t operator()(const K &key) const { return MixHash(std::hash<K>{}(key)); }
+};
+
+// std::string ػ֧"칹"find(std::string_view) / find("literal") Ҫȹ std::string
+template <>
+struct FlatHash<std::string>
+{
+    using is_transparent = void;
+    std::size_t operator()(std::string_view key) const { return MixHash(std::hash<std::string_view>{}(key)); }
+};
+
+template <typename H, typename E, typename = void>
+struct FlatIsTransparent : std::false_type
+{
+};
+template <typename H, typename E>
+struct FlatIsTransparent<H, E, std::void_t<typename H::is_transparent, typename E::is_transparent>> : std::true_type
+{
+};
+
+// ==========================================
+// 2. FlatHashMap<K, V>
+// ==========================================
+template <typename K, typename V, typename Hash = FlatHash<K>, typename KeyEqual = std::equal_to<>>
+class FlatHashMap
+{
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+
+private:
+    // ---------- ֽ ----------
+    using ctrl_t = std::int8_t;
+    static constexpr ctrl_t kEmpty = -128;  // 0b10000000
+    static constexpr ctrl_t kDeleted = -2;  // 0b11111110
+    static constexpr size_type kGroupWidth = 16;
+    // λĿֽ H2 (0~127λΪ 0)/ĹλΪ 1
+
+    static bool IsFull(ctrl_t c) { return c >= 0; }
+
+    static unsigned CountTrailingZeros(std::uint32_t bits)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_ctz(bits));
+#else
+        unsigned n = 0;
+        while ((bits & 1u) == 0)
+        {
+            bits >>= 1;
+            n++;
+        }
+        return n;
+#endif
+    }
+
+    // һ 16 ֽڣÿ 16 λ룬 i λʾ i ֽ
+    struct Group
+    {
+#ifdef FLAT_HASH_MAP_HAS_SSE2
+        __m128i ctrl;
+        explicit Group(const ctrl_t *p) : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))) {}
+
+        std::uint32_t Match(ctrl_t h2) const
+        {
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl)));
+        }
+        std::uint32_t MaskEmpty() const
+        {
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(kEmpty), ctrl)));
+        }
+        // ջĹ == λΪ 1movemask ֱȡľÿֽڵλ
+        std::uint32_t MaskNonFull() const { return static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl)); }
+#else
+        const ctrl_t *ctrl;
+        explicit Group(const ctrl_t *p) : ctrl(p) {}
+
+        template <typename Pred>
+        std::uint32_t MaskOf(Pred pred) const
+        {
+            std::uint32_t mask = 0;
+            for (size_type i = 0; i < kGroupWidth; i++)
+                mask |= static_cast<std::uint32_t>(pred(ctrl[i])) << i;
+            return mask;
+        }
+        std::uint32_t Match(ctrl_t h2) const { return MaskOf([h2](ctrl_t c) { return c == h2; }); }
+        std::uint32_t MaskEmpty() const { return MaskOf([](ctrl_t c) { return c == kEmpty; }); }
+        std::uint32_t MaskNonFull() const { return MaskOf([](ctrl_t c) { return c < 0; }); }
+#endif
+        std::uint32_t MaskFull() const { return ~MaskNonFull() & 0xFFFFu; }
+    };
+
+    // ձһȫտֽڣҲҪж"Ƿѷ"
+    static ctrl_t *EmptyGroup()
+    {
+        alignas(16) static ctrl_t empty[kGroupWidth] = {kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty,
+                                                       kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty,
+                                                       kEmpty, kEmpty, kEmpty, kEmpty};
+        return empty;
+    }
+
+    // Ϊ 0  2  (>= 16)ֽ鳤 capacity + 16
+    // ĩβ 16 ֽǿͷ 16 ľ񣬴λüһ鶼Խ
+    ctrl_t *m_Ctrl = EmptyGroup();
+    value_type *m_Slots = nullptr;
+    size_type m_Capacity = 0;
+    size_type m_Size = 0;
+    size_type m_GrowthLeft = 0; // ռöٸղλ (Ĺ)
+    Hash m_Hash;
+    KeyEqual m_Eq;
+
+    // Hash  KeyEqual  is_transparent ʱ K Ͳ
+    static constexpr bool kTransparent = FlatIsTransparent<Hash, KeyEqual>::value;
+
+    static size_type MaxSizeForCapacity(size_type capacity) { return capacity - capacity / 8; } // 7/8
+
+    static size_type CapacityFor(size_type count)
+    {
+        size_type capacity = kGroupWidth;
+        while (MaxSizeForCapacity(capacity) < count)
+            capacity *= 2;
+        return capacity;
+    }
+
+    size_type Mask() const { return m_Capacity == 0 ? 0 : m_Capacity - 1; }
+    static size_type H1(size_type hash) { return hash >> 7; }
+    static ctrl_t H2(size_type hash) { return static_cast<ctrl_t>(hash & 0x7F); }
+
+    void SetCtrl(size_type index, ctrl_t value)
+    {
+        m_Ctrl[index] = value;
+        if (index < kGroupWidth)
+            m_Ctrl[m_Capacity + index] = value; // ֽͬ
+    }
+
+    // ̽УΪλԾ (0, 16, 48, 96, ...) 2 ʱܸλ
+    template <typename Q>
+    size_type FindIndex(const Q &key, size_type hash) const
+    {
+        const size_type mask = Mask();
+        const ctrl_t h2 = H2(hash);
+        size_type offset = H1(hash) & mask;
+        size_type step = 0;
+        while (true)
+        {
+            Group group(m_Ctrl + offset);
+            for (std::uint32_t bits = group.Match(h2); bits != 0; bits &= bits - 1)
+            {
+                size_type index = (offset + CountTrailingZeros(bits)) & mask;
+                if (m_Eq(m_Slots[index].first, key))
+                    return index;
+            }
+            // ֻҪпղλkey Ͳڸ (ʱõλ)
+            if (group.MaskEmpty() != 0)
+                return m_Capacity;
+            step += kGroupWidth;
+            offset = (offset + step) & mask;
+        }
+    }
+
+    // ͬһ̽ҵһλĹ
+    size_type FindInsertIndex(size_type hash) const
+    {
+        const size_type mask = Mask();
+        size_type offset = H1(hash) & mask;
+        size_type step = 0;
+        while (true)
+        {
+            std::uint32_t bits = Group(m_Ctrl + offset).MaskNonFull();
+            if (bits != 0)
+                return (offset + CountTrailingZeros(bits)) & mask;
+            step += kGroupWidth;
+            offset = (offset + step) & mask;
+        }
+    }
+
+    void DestroyAll()
+    {
+        if (m_Capacity == 0)
+            return;
+        if constexpr (!std::is_trivially_destructible_v<value_type>)
+        {
+            for (size_type i = 0; i < m_Capacity; i++)
+                if (IsFull(m_Ctrl[i]))
+                    m_Slots[i].~value_type();
+        }
+        std::allocator<value_type>().deallocate(m_Slots, m_Capacity);
+        delete[] m_Ctrl;
+        m_Ctrl = EmptyGroup();
+        m_Slots = nullptr;
+        m_Capacity = m_Size = m_GrowthLeft = 0;
+    }
+
+    // ԪذᵽΪ newCapacity 飬˳Ĺ
+    void Resize(size_type newCapacity)
+    {
+        ctrl_t *oldCtrl = m_Ctrl;
+        value_type *oldSlots = m_Slots;
+        size_type oldCapacity = m_Capacity;
+
+        m_Ctrl = new ctrl_t[newCapacity + kGroupWidth];
+        std::fill(m_Ctrl, m_Ctrl + newCapacity + kGroupWidth, kEmpty);
+        m_Slots = std::allocator<value_type>().allocate(newCapacity);
+        m_Capacity = newCapacity;
+        m_GrowthLeft = MaxSizeForCapacity(newCapacity) - m_Size;
+
+        for (size_type i = 0; i < oldCapacity; i++)
+        {
+            if (!IsFull(oldCtrl[i]))
+                continue;
+            value_type &old = oldSlots[i];
+            size_type hash = m_Hash(old.first);
+            size_type index = FindInsertIndex(hash);
+            SetCtrl(index, H2(hash));
+            // ԪϾҪ٣ const key "͵"ǿ (std::map  node handle Ҳͬ˼·)
+            ::new (static_cast<void *>(m_Slots + index))
+                value_type(std::move(const_cast<K &>(old.first)), std::move(old.second));
+            old.~value_type();
+        }
+        if (oldCapacity != 0)
+        {
+            std::allocator<value_type>().deallocate(oldSlots, oldCapacity);
+            delete[] oldCtrl;
+        }
+    }
+
+    // ǰ֤пλĹܶʱԭؽ (ͬ)
+    void PrepareInsert()
+    {
+        if (m_Capacity == 0)
+            Resize(kGroupWidth);
+        else if (m_Size <= MaxSizeForCapacity(m_Capacity) / 2)
+            Resize(m_Capacity);
+        else
+            Resize(m_Capacity * 2);
+    }
+
+    template <typename KK, typename... Args>
+    std::pair<size_type, bool> TryEmplaceIndex(KK &&key, Args &&...args)
+    {
+        size_type hash = m_Hash(key);
+        size_type index = FindIndex(key, hash);
+        if (index != m_Capacity)
+            return {index, false};
+
+        index = FindInsertIndex(hash);
+        if (m_GrowthLeft == 0 && m_Ctrl[index] == kEmpty)
+        {
+            PrepareInsert();
+            index = FindInsertIndex(hash);
+        }
+        ::new (static_cast<void *>(m_Slots + index)) value_type(std::piecewise_construct,
+                                                                  std::forward_as_tuple(std::forward<KK>(key)),
+                                                                  std::forward_as_tuple(std::forward<Args>(args)...));
+        if (m_Ctrl[index] == kEmpty)
+            m_GrowthLeft--; // Ĺ¿λ
+        SetCtrl(index, H2(hash));
+        m_Size++;
+        return {index, true};
+    }
+
+    // ɾλڵ 16 ֽڴǰпλ˵û̽"Խ"ֱӱɿգ
+    // Ĺ֤ԪصĲҲǰֹͣ
+    void EraseIndex(size_type index)
+    {
+        m_Slots[index].~value_type();
+        m_Size--;
+        const size_type mask = Mask();
+        size_type before = (index - kGroupWidth) & mask;
+        std::uint32_t emptyAfter = Group(m_Ctrl + index).MaskEmpty();
+        std::uint32_t emptyBefore = Group(m_Ctrl + before).MaskEmpty();
+        bool wasNeverFull = emptyAfter != 0 && emptyBefore != 0 &&
+                            CountTrailingZeros(emptyAfter) + LeadingZeros16(emptyBefore) < kGroupWidth;
+        SetCtrl(index, wasNeverFull ? kEmpty : kDeleted);
+        if (wasNeverFull)
+            m_GrowthLeft++;
+    }
+
+    template <typename Q>
+    size_type EraseKey(const Q &key)
+    {
+        size_type index = FindIndex(key, m_Hash(key));
+        if (index == m_Capacity)
+            return 0;
+        EraseIndex(index);
+        return 1;
+    }
+
+    static unsigned LeadingZeros16(std::uint32_t bits)
+    {
+        unsigned n = 0;
+        for (std::uint32_t probe = 1u << 15; probe != 0 && (bits & probe) == 0; probe >>= 1)
+            n++;
+        return n;
+    }
+
+    size_type NextFull(size_type index) const
+    {
+        while (index < m_Capacity)
+        {
+            std::uint32_t full = Group(m_Ctrl + index).MaskFull();
+            if (full != 0)
+            {
+                size_type next = index + CountTrailingZeros(full);
+                return next < m_Capacity ? next : m_Capacity; // ֽڲ
+            }
+            index += kGroupWidth;
+        }
+        return m_Capacity;
+    }
+
+public:
+    // ==========================================
+    // 3.  (ǰ)
+    // ==========================================
+    template <bool IsConst>
+    class Iterator
+    {
+        friend class FlatHashMap;
+        template <bool>
+        friend class Iterator;
+        using Map = std::conditional_t<IsConst, const FlatHashMap, FlatHashMap>;
+
+        Map *m_Map = nullptr;
+        size_type m_Index = 0;
+
+        Iterator(Map *map, size_type index) : m_Map(map), m_Index(index) {}
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename FlatHashMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IsConst, const value_type &, value_type &>;
+        using pointer = std::conditional_t<IsConst, const value_type *, value_type *>;
+
+        Iterator() = default;
+        // iterator -> const_iterator ʽת
+        template <bool C = IsConst, typename = std::enable_if_t<C>>
+        Iterator(const Iterator<false> &other) : m_Map(other.m_Map), m_Index(other.m_Index)
+        {
+        }
+
+        reference operator*() const { return m_Map->m_Slots[m_Index]; }
+        pointer operator->() const { return &m_Map->m_Slots[m_Index]; }
+
+        Iterator &operator++()
+        {
+            m_Index = m_Map->NextFull(m_Index + 1);
+            return *this;
+        }
+        Iterator operator++(int)
+        {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        friend bool operator==(const Iterator &a, const Iterator &b) { return a.m_Index == b.m_Index; }
+        friend bool operator!=(const Iterator &a, const Iterator &b) { return a.m_Index != b.m_Index; }
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    // ==========================================
+    // 4.  /  / ƶ
+    // ==========================================
+    FlatHashMap() = default;
+    explicit FlatHashMap(size_type initialCapacity) { reserve(initialCapacity); }
+    FlatHashMap(std::initializer_list<value_type> init)
+    {
+        reserve(init.size());
+        for (const value_type &v : init)
+            insert(v);
+    }
+
+    FlatHashMap(const FlatHashMap &other) : m_Hash(other.m_Hash), m_Eq(other.m_Eq)
+    {
+        reserve(other.size());
+        for (const value_type &v : other)
+            insert(v);
+    }
+
+    FlatHashMap(FlatHashMap &&other) noexcept
+        : m_Ctrl(other.m_Ctrl), m_Slots(other.m_Slots), m_Capacity(other.m_Capacity), m_Size(other.m_Size),
+          m_GrowthLeft(other.m_GrowthLeft), m_Hash(std::move(other.m_Hash)), m_Eq(std::move(other.m_Eq))
+    {
+        other.m_Ctrl = EmptyGroup();
+        other.m_Slots = nullptr;
+        other.m_Capacity = other.m_Size = other.m_GrowthLeft = 0;
+    }
+
+    FlatHashMap &operator=(FlatHashMap other) noexcept // copy-and-swap
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~FlatHashMap() { DestroyAll(); }
+
+    void swap(FlatHashMap &other) noexcept
+    {
+        std::swap(m_Ctrl, other.m_Ctrl);
+        std::swap(m_Slots, other.m_Slots);
+        std::swap(m_Capacity, other.m_Capacity);
+        std::swap(m_Size, other.m_Size);
+        std::swap(m_GrowthLeft, other.m_GrowthLeft);
+        std::swap(m_Hash, other.m_Hash);
+        std::swap(m_Eq, other.m_Eq);
+    }
+
+    // ==========================================
+    // 5. 
+    // ==========================================
+    bool empty() const { return m_Size == 0; }
+    size_type size() const { return m_Size; }
+    size_type capacity() const { return m_Capacity; }
+    float load_factor() const { return m_Capacity == 0 ? 0.0f : static_cast<float>(m_Size) / m_Capacity; }
+    static constexpr float max_load_factor() { return 0.875f; }
+
+    // ֤ٲ뵽 count Ԫ֮ǰ (/ñЧ)
+    // Ĺλm_Size + m_GrowthLeft ʱԭؽĹ򻻸
+    void reserve(size_type count)
+    {
+        if (m_Capacity == 0)
+        {
+            if (count > 0)
+                Resize(CapacityFor(count));
+        }
+        else if (count > m_Size + m_GrowthLeft)
+            Resize(count <= MaxSizeForCapacity(m_Capacity) ? m_Capacity : CapacityFor(count));
+    }
+
+    // ؽΪ max(count, size()) ԪصСrehash(0) ൱ shrink_to_fit + Ĺ
+    void rehash(size_type count)
+    {
+        size_type target = count > m_Size ? count : m_Size;
+        if (target == 0)
+        {
+            DestroyAll();
+            return;
+        }
+        Resize(CapacityFor(target));
+    }
+
+    void clear()
+    {
+        if (m_Capacity == 0)
+            return;
+        if constexpr (!std::is_trivially_destructible_v<value_type>)
+        {
+            for (size_type i = 0; i < m_Capacity; i++)
+                if (IsFull(m_Ctrl[i]))
+                    m_Slots[i].~value_type();
+        }
+        std::fill(m_Ctrl, m_Ctrl + m_Capacity + kGroupWidth, kEmpty);
+        m_Size = 0;
+        m_GrowthLeft = MaxSizeForCapacity(m_Capacity);
+    }
+
+    // ==========================================
+    // 6. 
+    // ==========================================
+    iterator begin() { return iterator(this, NextFull(0)); }
+    iterator end() { return iterator(this, m_Capacity); }
+    const_iterator begin() const { return const_iterator(this, NextFull(0)); }
+    const_iterator end() const { return const_iterator(this, m_Capacity); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    // ==========================================
+    // 7. 
+    // ==========================================
+    // const K& 汾ʼտãʵοʽת K ( FlatHashMap<std::size_t, int>  int )
+    // Hash/KeyEqual ͸ʱٶṩģ汾ɱȽ ( std::string_view) ֱӲ
+    template <typename Q>
+    using EnableIfHeterogeneous = std::enable_if_t<kTransparent && !std::is_same_v<Q, K>>;
+
+    iterator find(const K &key) { return iterator(this, FindIndex(key, m_Hash(key))); }
+    const_iterator find(const K &key) const { return const_iterator(this, FindIndex(key, m_Hash(key))); }
+    bool contains(const K &key) const { return FindIndex(key, m_Hash(key)) != m_Capacity; }
+    size_type count(const K &key) const { return contains(key) ? 1 : 0; }
+
+    template <typename Q, typename = EnableIfHeterogeneous<Q>>
+    iterator find(const Q &key)
+    {
+        return iterator(this, FindIndex(key, m_Hash(key)));
+    }
+    template <typename Q, typename = EnableIfHeterogeneous<Q>>
+    const_iterator find(const Q &key) const
+    {
+        return const_iterator(this, FindIndex(key, m_Hash(key)));
+    }
+    template <typename Q, typename = EnableIfHeterogeneous<Q>>
+    bool contains(const Q &key) const
+    {
+        return FindIndex(key, m_Hash(key)) != m_Capacity;
+    }
+    template <typename Q, typename = EnableIfHeterogeneous<Q>>
+    size_type count(const Q &key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    V &at(const K &key)
+    {
+        size_type index = FindIndex(key, m_Hash(key));
+        if (index == m_Capacity)
+            throw std::out_of_range("FlatHashMap::at");
+        return m_Slots[index].second;
+    }
+    const V &at(const K &key) const
+    {
+        size_type index = FindIndex(key, m_Hash(key));
+        if (index == m_Capacity)
+            throw std::out_of_range("FlatHashMap::at");
+        return m_Slots[index].second;
+    }
+
+    // ==========================================
+    // 8. 
+    // ==========================================
+    // 칹 key ( std::string_view) ֻȷʵҪʱŹ K
+    template <typename KK, typename... Args>
+    std::pair<iterator, bool> try_emplace(KK &&key, Args &&...args)
+    {
+        if constexpr (std::is_same_v<std::decay_t<KK>, K> || kTransparent)
+        {
+            auto [index, inserted] = TryEmplaceIndex(std::forward<KK>(key), std::forward<Args>(args)...);
+            return {iterator(this, index), inserted};
+        }
+        else
+        {
+            return try_emplace(K(std::forward<KK>(key)), std::forward<Args>(args)...);
+        }
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args &&...args)
+    {
+        value_type value(std::forward<Args>(args)...);
+        return try_emplace(std::move(const_cast<K &>(value.first)), std::move(value.second));
+    }
+
+    std::pair<iterator, bool> insert(const value_type &value) { return try_emplace(value.first, value.second); }
+    std::pair<iterator, bool> insert(value_type &&value)
+    {
+        return try_emplace(std::move(const_cast<K &>(value.first)), std::move(value.second));
+    }
+
+    template <typename KK, typename M>
+    std::pair<iterator, bool> insert_or_assign(KK &&key, M &&value)
+    {
+        auto result = try_emplace(std::forward<KK>(key), std::forward<M>(value));
+        if (!result.second)
+            result.first->second = std::forward<M>(value);
+        return result;
+    }
+
+    V &operator[](const K &key) { return try_emplace(key).first->second; }
+    V &operator[](K &&key) { return try_emplace(std::move(key)).first->second; }
+
+    // ==========================================
+    // 9. ɾ
+    // ==========================================
+    size_type erase(const K &key) { return EraseKey(key); }
+
+    //  std::unordered_map һתɵʵν erase(iterator)
+    template <typename Q, typename = EnableIfHeterogeneous<Q>,
+              typename = std::enable_if_t<!std::is_convertible_v<Q, iterator> && !std::is_convertible_v<Q, const_iterator>>>
+    size_type erase(const Q &key)
+    {
+        return EraseKey(key);
+    }
+
+    // һԪأ֧ iterators.md  "it = container.erase(it);" д
+    iterator erase(const_iterator pos)
+    {
+        EraseIndex(pos.m_Index);
+        return iterator(this, NextFull(pos.m_Index + 1));
+    }
+    iterator erase(iterator pos) { return erase(const_iterator(pos)); }
+};
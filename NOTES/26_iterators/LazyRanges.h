@@ -0,0 +1,732 @@
+/**
+ * @file LazyRanges.h
+ * @brief C++17 Ķfilter / transform / take / chunk / stride / zip / enumerate
+ *         | ˮߣս (collect / reduce / sum / count / for_each) н׶ںϳһѭм䲻κʱ
+ * @note Ҫ C++17 ( C++20 <ranges>)
+ *
+ * iterators.md / lambda.md д"ÿһһ vector" copy_if  evens transform  squares͡
+ * ÿһҪڴ桢дһٶһ顣ͼ (View) ֻ" + һ"ݣ
+ *   -  (push)ս Drive(sink)ÿ׶ΰԪؽһ׶Σˮһѭ
+ *     sink  false ʾ"" (ֻ take )׶κ㷵 trueǰ˳жɾ
+ *   - ʿ·Դڴ (vector / array / )  iota ʱtransform / take / stride / zip / enumerate / chunk
+ *     " i Ԫ = At(i)"Drive һ for (i = 0; i < n; i++) ѭGCC/Clang Զ
+ *   -  (pull)ÿͼҲ begin() / end()ֱд for (auto x : v | lazy::filter(...))
+ * ͼֻԴӵԴͼþ (ʱʧ)
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lazy
+{
+    // ==========================================
+    // 1. ʩͼǡڱ±ʵĵ
+    // ==========================================
+    struct ViewBase
+    {
+    };
+    struct ClosureBase // filter(f) ֮"û"
+    {
+    };
+
+    template <typename T>
+    inline constexpr bool kIsView = std::is_base_of_v<ViewBase, std::decay_t<T>>;
+
+    // ͼ end()  SentinelԼ֪ʱ (C++17 ķΧ for  begin/end Ͳͬ)
+    struct Sentinel
+    {
+    };
+
+    template <typename It>
+    struct SentinelCompare
+    {
+        friend bool operator==(const It &it, Sentinel) { return it.AtEnd(); }
+        friend bool operator!=(const It &it, Sentinel) { return !it.AtEnd(); }
+    };
+
+    template <typename View>
+    class IndexIterator : public SentinelCompare<IndexIterator<View>>
+    {
+    public:
+        IndexIterator(const View *view, std::size_t index) : m_View(view), m_Index(index), m_Size(view->Size()) {}
+        decltype(auto) operator*() const { return m_View->At(m_Index); }
+        IndexIterator &operator++()
+        {
+            ++m_Index;
+            return *this;
+        }
+        bool AtEnd() const { return m_Index >= m_Size; }
+
+    private:
+        const View *m_View;
+        std::size_t m_Index;
+        std::size_t m_Size;
+    };
+
+    // ͼģʽһѭ
+    template <typename View, typename Sink>
+    bool DriveIndexed(const View &view, Sink &sink)
+    {
+        const std::size_t n = view.Size();
+        for (std::size_t i = 0; i < n; i++)
+            if (!sink(view.At(i)))
+                return false;
+        return true;
+    }
+
+    // ==========================================
+    // 2. Դڴ /  / iota
+    // ==========================================
+    template <typename T>
+    class SpanSource : public ViewBase
+    {
+    public:
+        static constexpr bool kRandomAccess = true;
+        using value_type = std::remove_cv_t<T>;
+        using reference = const T &;
+
+        SpanSource(const T *data, std::size_t size) : m_Data(data), m_Size(size) {}
+        std::size_t Size() const { return m_Size; }
+        std::size_t UpperBound() const { return m_Size; }
+        const T &At(std::size_t i) const { return m_Data[i]; }
+        IndexIterator<SpanSource> begin() const { return {this, 0}; }
+        Sentinel end() const { return {}; }
+        template <typename Sink>
+        bool Drive(Sink &&sink) const { return DriveIndexed(*this, sink); }
+
+    private:
+        const T *m_Data;
+        std::size_t m_Size;
+    };
+
+    template <typename It>
+    class IteratorSource : public ViewBase
+    {
+    public:
+        static constexpr bool kRandomAccess = false;
+        using reference = typename std::iterator_traits<It>::reference;
+        using value_type = typename std::iterator_traits<It>::value_type;
+
+        class Iterator : public SentinelCompare<Iterator>
+        {
+        public:
+            Iterator(It it, It last) : m_It(it), m_Last(last) {}
+            reference operator*() const { return *m_It; }
+            Iterator &operator++()
+            {
+                ++m_It;
+                return *this;
+            }
+            bool AtEnd() const { return m_It == m_Last; }
+
+        private:
+            It m_It, m_Last;
+        };
+
+        IteratorSource(It first, It last) : m_First(first), m_Last(last) {}
+        // ֻʵ O(1) ȣ򷵻 0 (collect Ԥ)
+        std::size_t UpperBound() const
+        {
+            if constexpr (std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<It>::iterator_category>)
+                return static_cast<std::size_t>(m_Last - m_First);
+            else
+                return 0;
+        }
+        Iterator begin() const { return {m_First, m_Last}; }
+        Sentinel end() const { return {}; }
+        template <typename Sink>
+        bool Drive(Sink &&sink) const
+        {
+            for (It it = m_First; it != m_Last; ++it)
+                if (!sink(*it))
+                    return false;
+            return true;
+        }
+
+    private:
+        It m_First, m_Last;
+    };
+
+    // [first, last) Уռڴ
+    template <typename T>
+    class IotaView : public ViewBase
+    {
+    public:
+        static constexpr bool kRandomAccess = true;
+        using value_type = T;
+        using reference = T;
+
+        IotaView(T first, T last) : m_First(first), m_Size(last > first ? static_cast<std::size_t>(last - first) : 0) {}
+        std::size_t Size() const { return m_Size; }
+        std::size_t UpperBound() const { return m_Size; }
+        T At(std::size_t i) const { return static_cast<T>(m_First + static_cast<T>(i)); }
+        IndexIterator<IotaView> begin() const { return {this, 0}; }
+        Sentinel end() const { return {}; }
+        template <typename Sink>
+        bool Drive(Sink &&sink) const { return DriveIndexed(*this, sink); }
+
+    private:
+        T m_First;
+        std::size_t m_Size;
+    };
+
+    template <typename T>
+    IotaView<T> iota(T first, T last)
+    {
+        return IotaView<T>(first, last);
+    }
+
+    namespace detail
+    {
+        template <typename C, typename = void>
+        struct IsContiguous : std::false_type
+        {
+        };
+        template <typename C>
+        struct IsContiguous<C, std::void_t<decltype(std::data(std::declval<const C &>())), decltype(std::size(std::declval<const C &>()))>>
+            : std::is_pointer<decltype(std::data(std::declval<const C &>()))>
+        {
+        };
+    } // namespace detail
+
+    //  -> ͼvector / array / string / ԭڴ· (list / map / deque) ߵ
+    template <typename C>
+    auto from(const C &c)
+    {
+        if constexpr (kIsView<C>)
+            return c;
+        else if constexpr (detail::IsContiguous<C>::value)
+            return SpanSource<std::remove_pointer_t<decltype(std::data(c))>>(std::data(c), std::size(c));
+        else
+            return IteratorSource<decltype(std::begin(c))>(std::begin(c), std::end(c));
+    }
+    // ʱڱʽʱ٣ͼ
+    template <typename C, std::enable_if_t<!std::is_lvalue_reference_v<C> && !kIsView<C>, int> = 0>
+    void from(C &&) = delete;
+
+    // ==========================================
+    // 3. мͼ
+    // ==========================================
+    template <typename Up, typename F>
+    class TransformView : public ViewBase
+    {
+    public:
+        static constexpr bool kRandomAccess = Up::kRandomAccess;
+        using reference = std::invoke_result_t<const F &, typename Up::reference>;
+        using value_type = std::decay_t<reference>;
+
+        class Iterator : public SentinelCompare<Iterator>
+        {
+        public:
+            using UpIterator = decltype(std::declval<const Up &>().begin());
+            Iterator(UpIterator it, const F *f) : m_It(it), m_F(f) {}
+            reference operator*() const { return (*m_F)(*m_It); }
+            Iterator &operator++()
+            {
+                ++m_It;
+                return *this;
+            }
+            bool AtEnd() const { return m_It.AtEnd(); }
+
+        private:
+            UpIterator m_It;
+            const F *m_F;
+        };
+
+        TransformView(Up up, F f) : m_Up(std::move(up)), m_F(std::move(f)) {}
+        std::size_t Size() const { return m_Up.Size(); }
+        std::size_t UpperBound() const { return m_Up.UpperBound(); }
+        reference At(std::size_t i) const { return m_F(m_Up.At(i)); }
+        auto begin() const
+        {
+            if constexpr (kRandomAccess)
+                return IndexIterator<TransformView>(this, 0);
+            else
+                return Iterator(m_Up.begin(), &m_F);
+        }
+        Sentinel end() const { return {}; }
+        template <typename Sink>
+        bool Drive(Sink &&sink) const
+        {
+            if constexpr (kRandomAccess)
+                return DriveIndexed(*this, sink);
+            else
+                return m_Up.Drive([&](auto &&x) { return sink(m_F(std::forward<decltype(x)>(x))); });
+        }
+
+    private:
+        Up m_Up;
+        F m_F;
+    };
+
+    template <typename Up, typename Pred>
+    class FilterView : public ViewBase
+    {
+    public:
+        static constexpr bool kRandomAccess = false; // ֪ i Ԫ
+        using reference = typename Up::reference;
+        using value_type = typename Up::value_type;
+
+        class Iterator : public SentinelCompare<Iterator>
+        {
+        public:
+            using UpIterator = decltype(std::declval<const Up &>().begin());
+            Iterator(UpIterator it, const Pred *pred) : m_It(it), m_Pred(pred) { Skip(); }
+            reference operator*() const { return *m_It; }
+            Iterator &operator++()
+            {
+                ++m_It;
+                Skip();
+                return *this;
+            }
+            bool AtEnd() const { return m_It.AtEnd(); }
+
+        private:
+            void Skip()
+            {
+                while (!m_It.AtEnd() && !(*m_Pred)(*m_It))
+                    ++m_It;
+            }
+            UpIterator m_It;
+            const Pred *m_Pred;
+        };
+
+        FilterView(Up up, Pred pred) : m_Up(std::move(up)), m_Pred(std::move(pred)) {}
+        std::size_t UpperBound() const { return m_Up.UpperBound(); }
+        Iterator begin() const { return Iterator(m_Up.begin(), &m_Pred); }
+        Sentinel end() const { return {}; }
+        template <typename Sink>
+        bool Drive(Sink &&sink) const
+        {
+            return m_Up.Drive([&](auto &&x)
+                              {
+                if (m_Pred(x))
+                    return sink(std::forward<decltype(x)>(x));
+                return true; });
+        }
+
+    private:
+        Up m_Up;
+        Pred m_Pred;
+    };
+
+    template <typename Up>
+    class TakeView : public ViewBase
+    {
+    public:
+        static constexpr bool kRandomAccess = Up::kRandomAccess;
+        using reference = typename Up::reference;
+        using value_type = typename Up::value_type;
+
+        class Iterator : public SentinelCompare<Iterator>
+        {
+        public:
+            using UpIterator = decltype(std::declval<const Up &>().begin());
+            Iterator(UpIterator it, std::size_t remaining) : m_It(it), m_Remaining(remaining) {}
+            reference operator*() const { return *m_It; }
+            Iterator &operator++()
+            {
+                // ȡ˾Ͳƽ (filter  ++ ҪɨԶ)
+                if (--m_Remaining > 0)
+                    ++m_It;
+                return *this;
+            }
+            bool AtEnd() const { return m_Remaining == 0 || m_It.AtEnd(); }
+
+        private:
+            UpIterator m_It;
+            std::size_t m_Remaining;
+        };
+
+        TakeView(Up up, std::size_t count) : m_Up(std::move(up)), m_Count(count) {}
+        std::size_t Size() const { return std::min(m_Count, m_Up.Size()); }
+        std::size_t UpperBound() const { return std::min(m_Count, m_Up.UpperBound() == 0 ? m_Count : m_Up.UpperBound()); }
+        reference At(std::size_t i) const { return m_Up.At(i); }
+        auto begin() const
+        {
+            if constexpr (kRandomAccess)
+                return IndexIterator<TakeView>(this, 0);
+            else
+                return Iterator(m_Up.begin(), m_Count);
+        }
+        Sentinel end() const { return {}; }
+        template <typename Sink>
+        bool Drive(Sink &&sink) const
+        {
+            if constexpr (kRandomAccess)
+                return DriveIndexed(*this, sink); // ֱ֪ѭûǰ˳
+            else
+            {
+                if (m_Count == 0)
+                    return true;
+                std::size_t taken = 0;
+                bool downstreamStopped = false;
+                m_Up.Drive([&](auto &&x)
+                           {
+                    if (!sink(std::forward<decltype(x)>(x)))
+                    {
+                        downstreamStopped = true;
+                        return false;
+                    }
+                    return ++taken < m_Count; });
+                return !downstreamStopped;
+            }
+        }
+
+    private:
+        Up m_Up;
+        std::size_t m_Count;
+    };
+
+    template <typename Up>
+    class StrideView : public ViewBase
+    {
+    public:
+        static constexpr bool kRandomAccess = Up::kRandomAccess;
+        using reference = typename Up::reference;
+        using value_type = typename Up::value_type;
+
+        class Iterator : public SentinelCompare<Iterator>
+        {
+        public:
+            using UpIterator = decltype(std::declval<const Up &>().begin());
+            Iterator(UpIterator it, std::size_t step) : m_It(it), m_Step(step) {}
+            reference operator*() const { return *m_It; }
+            Iterator &operator++()
+            {
+                for (std::size_t i = 0; i < m_Step && !m_It.AtEnd(); i++)
+                    ++m_It;
+                return *this;
+            }
+            bool AtEnd() const { return m_It.AtEnd(); }
+
+        private:
+            UpIterator m_It;
+            std::size_t m_Step;
+        };
+
+        StrideView(Up up, std::size_t step) : m_Up(std::move(up)), m_Step(step == 0 ? 1 : step) {}
+        std::size_t Size() const { return (m_Up.Size() + m_Step - 1) / m_Step; }
+        std::size_t UpperBound() const { return (m_Up.UpperBound() + m_Step - 1) / m_Step; }
+        reference At(std::size_t i) const { return m_Up.At(i * m_Step); }
+        auto begin() const
+        {
+            if constexpr (kRandomAccess)
+                return IndexIterator<StrideView>(this, 0);
+            else
+                return Iterator(m_Up.begin(), m_Step);
+        }
+        Sentinel end() const { return {}; }
+        template <typename Sink>
+        bool Drive(Sink &&sink) const
+        {
+            if constexpr (kRandomAccess)
+                return DriveIndexed(*this, sink);
+            else
+            {
+                std::size_t skip = 0; // ÿԪһȡģ
+                return m_Up.Drive([&](auto &&x)
+                                  {
+                    if (skip != 0)
+                    {
+                        --skip;
+                        return true;
+                    }
+                    skip = m_Step - 1;
+                    return sink(std::forward<decltype(x)>(x)); });
+            }
+        }
+
+    private:
+        Up m_Up;
+        std::size_t m_Step;
+    };
+
+    // Ԫ (±, Ԫ)д for (auto [i, x] : v | lazy::enumerate())
+    template <typename Up>
+    class EnumerateView : public ViewBase
+    {
+    public:
+        static constexpr bool kRandomAccess = Up::kRandomAccess;
+        using reference = std::pair<std::size_t, typename Up::reference>;
+        using value_type = std::pair<std::size_t, typename Up::value_type>;
+
+        class Iterator : public SentinelCompare<Iterator>
+        {
+        public:
+            using UpIterator = decltype(std::declval<const Up &>().begin());
+            explicit Iterator(UpIterator it) : m_It(it) {}
+            reference operator*() const { return reference(m_Index, *m_It); }
+            Iterator &operator++()
+            {
+                ++m_It;
+                ++m_Index;
+                return *this;
+            }
+            bool AtEnd() const { return m_It.AtEnd(); }
+
+        private:
+            UpIterator m_It;
+            std::size_t m_Index = 0;
+        };
+
+        explicit EnumerateView(Up up) : m_Up(std::move(up)) {}
+        std::size_t Size() const { return m_Up.Size(); }
+        std::size_t UpperBound() const { return m_Up.UpperBound(); }
+        reference At(std::size_t i) const { return reference(i, m_Up.At(i)); }
+        auto begin() const
+        {
+            if constexpr (kRandomAccess)
+                return IndexIterator<EnumerateView>(this, 0);
+            else
+                return Iterator(m_Up.begin());
+        }
+        Sentinel end() const { return {}; }
+        template <typename Sink>
+        bool Drive(Sink &&sink) const
+        {
+            if constexpr (kRandomAccess)
+                return DriveIndexed(*this, sink);
+            else
+            {
+                std::size_t index = 0;
+                return m_Up.Drive([&](auto &&x) { return sink(reference(index++, std::forward<decltype(x)>(x))); });
+            }
+        }
+
+    private:
+        Up m_Up;
+    };
+
+    // εһ [first, last)chunk ԪͣҲͼ
+    // ֵ (ͼֻǼָ + 󣬿ܱ)ƬԱȲ ChunkView þã
+    //  auto chunks = v | lazy::chunk(3) | lazy::collect();  ChunkView ʱ
+    template <typename Up>
+    class SliceView : public ViewBase
+    {
+    public:
+        static constexpr bool kRandomAccess = true;
+        using reference = typename Up::reference;
+        using value_type = typename Up::value_type;
+
+        SliceView(Up up, std::size_t first, std::size_t last) : m_Up(std::move(up)), m_First(first), m_Size(last - first) {}
+        std::size_t Size() const { return m_Size; }
+        std::size_t UpperBound() const { return m_Size; }
+        reference At(std::size_t i) const { return m_Up.At(m_First + i); }
+        IndexIterator<SliceView> begin() const { return {this, 0}; }
+        Sentinel end() const { return {}; }
+        template <typename Sink>
+        bool Drive(Sink &&sink) const { return DriveIndexed(*this, sink); }
+
+    private:
+        Up m_Up;
+        std::size_t m_First;
+        std::size_t m_Size;
+    };
+
+    template <typename Up>
+    class ChunkView : public ViewBase
+    {
+        static_assert(Up::kRandomAccess, "lazy::chunk needs a random-access upstream (put chunk before filter)");
+
+    public:
+        static constexpr bool kRandomAccess = true;
+        using reference = SliceView<Up>;
+        using value_type = SliceView<Up>;
+
+        ChunkView(Up up, std::size_t size) : m_Up(std::move(up)), m_ChunkSize(size == 0 ? 1 : size) {}
+        std::size_t Size() const { return (m_Up.Size() + m_ChunkSize - 1) / m_ChunkSize; }
+        std::size_t UpperBound() const { return Size(); }
+        reference At(std::size_t i) const
+        {
+            const std::size_t first = i * m_ChunkSize;
+            return reference(m_Up, first, std::min(first + m_ChunkSize, m_Up.Size()));
+        }
+        IndexIterator<ChunkView> begin() const { return {this, 0}; }
+        Sentinel end() const { return {}; }
+        template <typename Sink>
+        bool Drive(Sink &&sink) const { return DriveIndexed(*this, sink); }
+
+    private:
+        Up m_Up;
+        std::size_t m_ChunkSize;
+    };
+
+    // Ԫ (a Ԫ, b Ԫ)ȡ϶
+    template <typename A, typename B>
+    class ZipView : public ViewBase
+    {
+        static_assert(A::kRandomAccess && B::kRandomAccess, "lazy::zip needs random-access inputs");
+
+    public:
+        static constexpr bool kRandomAccess = true;
+        using reference = std::pair<typename A::reference, typename B::reference>;
+        using value_type = std::pair<typename A::value_type, typename B::value_type>;
+
+        ZipView(A a, B b) : m_A(std::move(a)), m_B(std::move(b)) {}
+        std::size_t Size() const { return std::min(m_A.Size(), m_B.Size()); }
+        std::size_t UpperBound() const { return Size(); }
+        reference At(std::size_t i) const { return reference(m_A.At(i), m_B.At(i)); }
+        IndexIterator<ZipView> begin() const { return {this, 0}; }
+        Sentinel end() const { return {}; }
+        template <typename Sink>
+        bool Drive(Sink &&sink) const { return DriveIndexed(*this, sink); }
+
+    private:
+        A m_A;
+        B m_B;
+    };
+
+    template <typename RA, typename RB>
+    auto zip(const RA &a, const RB &b)
+    {
+        auto va = from(a);
+        auto vb = from(b);
+        return ZipView<decltype(va), decltype(vb)>(std::move(va), std::move(vb));
+    }
+
+    // ==========================================
+    // 4. հ | 
+    // ==========================================
+    template <typename Make>
+    struct Closure : ClosureBase
+    {
+        Make make;
+        template <typename V>
+        auto operator()(const V &view) const { return make(view); }
+    };
+    template <typename Make>
+    Closure<Make> MakeClosure(Make make)
+    {
+        return Closure<Make>{{}, std::move(make)};
+    }
+
+    template <typename R, typename C, std::enable_if_t<std::is_base_of_v<ClosureBase, std::decay_t<C>>, int> = 0>
+    auto operator|(R &&range, const C &closure)
+    {
+        static_assert(kIsView<R> || std::is_lvalue_reference_v<R>, "lazy: pipe a named container, not a temporary");
+        return closure(from(range));
+    }
+
+    template <typename F>
+    auto transform(F f)
+    {
+        return MakeClosure([f](const auto &up) { return TransformView<std::decay_t<decltype(up)>, F>(up, f); });
+    }
+    template <typename Pred>
+    auto filter(Pred pred)
+    {
+        return MakeClosure([pred](const auto &up) { return FilterView<std::decay_t<decltype(up)>, Pred>(up, pred); });
+    }
+    inline auto take(std::size_t count)
+    {
+        return MakeClosure([count](const auto &up) { return TakeView<std::decay_t<decltype(up)>>(up, count); });
+    }
+    inline auto stride(std::size_t step)
+    {
+        return MakeClosure([step](const auto &up) { return StrideView<std::decay_t<decltype(up)>>(up, step); });
+    }
+    inline auto chunk(std::size_t size)
+    {
+        return MakeClosure([size](const auto &up) { return ChunkView<std::decay_t<decltype(up)>>(up, size); });
+    }
+    inline auto enumerate()
+    {
+        return MakeClosure([](const auto &up) { return EnumerateView<std::decay_t<decltype(up)>>(up); });
+    }
+
+    // ==========================================
+    // 5. սִˮ
+    // ==========================================
+    // collect֪ʱȷԤ (ƽ resize ٰ±дѭ)
+    //  filter 󳤶δ֪γԤһ (Ͻ)֤ˮֻһ
+    inline auto collect()
+    {
+        return MakeClosure([](const auto &view)
+                           {
+            using V = std::decay_t<decltype(view)>;
+            using T = typename V::value_type;
+            std::vector<T> out;
+            if constexpr (V::kRandomAccess && std::is_trivially_copyable_v<T> && std::is_trivially_default_constructible_v<T>)
+            {
+                const std::size_t n = view.Size();
+                out.resize(n);
+                T *dst = out.data();
+                for (std::size_t i = 0; i < n; i++)
+                    dst[i] = view.At(i);
+            }
+            else
+            {
+                if constexpr (V::kRandomAccess)
+                    out.reserve(view.Size());
+                else
+                    out.reserve(view.UpperBound());
+                view.Drive([&](auto &&x)
+                           {
+                    out.emplace_back(std::forward<decltype(x)>(x));
+                    return true; });
+            }
+            return out; });
+    }
+
+    template <typename T, typename Op = std::plus<>>
+    auto reduce(T init, Op op = {})
+    {
+        return MakeClosure([init, op](const auto &view)
+                           {
+            T acc = init;
+            view.Drive([&](auto &&x)
+                       {
+                acc = op(acc, std::forward<decltype(x)>(x));
+                return true; });
+            return acc; });
+    }
+
+    // Ԫͬ (int Ϳʱ transform  long long)
+    inline auto sum()
+    {
+        return MakeClosure([](const auto &view)
+                           {
+            typename std::decay_t<decltype(view)>::value_type acc{};
+            view.Drive([&](auto &&x)
+                       {
+                acc += x;
+                return true; });
+            return acc; });
+    }
+
+    inline auto count()
+    {
+        return MakeClosure([](const auto &view)
+                           {
+            using V = std::decay_t<decltype(view)>;
+            if constexpr (V::kRandomAccess)
+                return view.Size();
+            else
+            {
+                std::size_t n = 0;
+                view.Drive([&](auto &&)
+                           {
+                    n++;
+                    return true; });
+                return n;
+            } });
+    }
+
+    template <typename F>
+    auto for_each(F f)
+    {
+        return MakeClosure([f](const auto &view)
+                           { view.Drive([&](auto &&x)
+                                        {
+                f(std::forward<decltype(x)>(x));
+                return true; }); });
+    }
+} // namespace lazy
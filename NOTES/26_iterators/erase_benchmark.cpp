@@ -0,0 +1,166 @@
+/**
+ * @file erase_benchmark.cpp
+ * @brief ɾ it = erase(it) (O(n^2)) vs erase_if vs unstable_erase_if vs erase_where (޷֧/AVX2) vs TombstoneVector
+ * @note : g++ -O3 -std=c++17 erase_benchmark.cpp -o erase_benchmark
+ *       AVX2: g++ -O3 -std=c++17 -mavx2 erase_benchmark.cpp -o erase_benchmark
+ *       : ./erase_benchmark [ԪظĬ 100000000]
+ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "ContainerAlgorithms.h"
+#include "../23_Benchmarking/Timer.h"
+
+// ==========================================
+// 1. ʾɾ + 
+// ==========================================
+void DemoTombstones()
+{
+    std::cout << "=== 1. TombstoneVector: modify while iterating ===" << std::endl;
+    container::TombstoneVector<int> data;
+    for (int v : {1, 2, 3, 4, 5, 6})
+        data.push_back(v);
+
+    //  iterators.md ¼ͬ (ɾż)صﻹ˳Ԫ
+    data.ForEach([&](int &v, std::size_t index)
+                 {
+        if (v % 2 == 0)
+        {
+            data.Erase(index);
+            data.push_back(v * 10 + 1); // Ԫرֲᱻ
+        } });
+    std::cout << "  after ForEach: live " << data.size() << ", slots " << data.SlotCount() << ", dead "
+              << data.DeadCount() << " (compacted automatically at the end of the outer ForEach)" << std::endl;
+    std::cout << "  remaining:";
+    for (int v : data.Compacted())
+        std::cout << " " << v;
+    std::cout << std::endl;
+}
+
+// ==========================================
+// 2. ɾʽ (ɾ x < threshold Ԫ)
+// ==========================================
+using Value = std::int32_t;
+
+void NaiveEraseLoop(std::vector<Value> &v, Value threshold)
+{
+    for (auto it = v.begin(); it != v.end();)
+    {
+        if (*it < threshold)
+            it = v.erase(it);
+        else
+            ++it;
+    }
+}
+
+long long Checksum(const std::vector<Value> &v)
+{
+    return std::accumulate(v.begin(), v.end(), 0LL);
+}
+
+void RunSize(const std::vector<Value> &master, std::size_t n, Value threshold)
+{
+    std::cout << "-- " << n << " elements --" << std::endl;
+    std::vector<Value> work;
+    auto reset = [&]
+    {
+        work.assign(master.begin(), master.begin() + static_cast<std::ptrdiff_t>(n));
+    };
+
+    // һ (erase_if) Ϊ׼ķԪرȽϣֻȽԪظУ
+    std::vector<Value> expected;
+    long long expectedSum = 0;
+    bool haveExpected = false;
+    auto check = [&](const char *name, bool orderPreserved)
+    {
+        long long sum = Checksum(work);
+        if (!haveExpected)
+        {
+            expected = work;
+            expectedSum = sum;
+            haveExpected = true;
+        }
+        else if (orderPreserved ? work != expected : (sum != expectedSum || work.size() != expected.size()))
+        {
+            std::cout << "  MISMATCH in " << name << std::endl;
+        }
+    };
+
+    reset();
+    {
+        Timer timer("erase_if (erase-remove)", n);
+        container::erase_if(work, [threshold](Value x) { return x < threshold; });
+    }
+    check("erase_if", true);
+
+    if (n <= 100000)
+    {
+        reset();
+        {
+            Timer timer("it = erase(it) loop", n);
+            NaiveEraseLoop(work, threshold);
+        }
+        check("naive loop", true);
+    }
+    else
+    {
+        std::cout << "[it = erase(it) loop] skipped (O(n^2))" << std::endl;
+    }
+
+    reset();
+    {
+        Timer timer("unstable_erase_if", n);
+        container::unstable_erase_if(work, [threshold](Value x) { return x < threshold; });
+    }
+    check("unstable_erase_if", false);
+
+    reset();
+    {
+#ifdef CONTAINER_ALGO_HAS_AVX2
+        Timer timer("erase_where (AVX2)", n);
+#else
+        Timer timer("erase_where (branchless)", n);
+#endif
+        container::erase_where(work, std::less<>{}, threshold);
+    }
+    check("erase_where", true);
+
+    reset();
+    container::TombstoneVector<Value> tomb(1.0); // ֵ 1.0Զѹ"""ѹ"
+    tomb.reserve(n);
+    for (Value x : work)
+        tomb.push_back(x);
+    {
+        Timer timer("TombstoneVector EraseIf (mark)", n);
+        tomb.EraseIf([threshold](Value x) { return x < threshold; });
+    }
+    {
+        Timer timer("TombstoneVector Compact", n);
+        tomb.Compact();
+    }
+    work = tomb.Compacted();
+    check("TombstoneVector", true);
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t maxN = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000000;
+
+    DemoTombstones();
+
+    // ݣɾԼһ (x < 0)֧Ԥѵ
+    std::vector<Value> master(maxN);
+    std::mt19937 rng(123);
+    for (Value &x : master)
+        x = static_cast<Value>(rng());
+
+    std::cout << "\n=== 2. Remove ~50% of random int32 (Run in Release Mode! -O3) ===" << std::endl;
+    for (std::size_t n = 10000; n <= maxN; n *= 10)
+        RunSize(master, n, 0);
+    return 0;
+}
@@ -0,0 +1,223 @@
+/**
+ * @file flat_map_benchmark.cpp
+ * @brief FlatHashMap ÷ʾ (ṹ󶨡칹ҡ߱ɾ) +  std::map / std::unordered_map Ĳ롢вҡδвҡɾԱ
+ * @note : g++ -O3 -std=c++17 flat_map_benchmark.cpp -o flat_map_benchmark
+ *       : ./flat_map_benchmark [ԪظĬ 1000000]
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "FlatHashMap.h"
+#include "../23_Benchmarking/Timer.h"
+
+// ==========================================
+// 1. ÷ iterators.md  ageMap дͬ
+// ==========================================
+void DemoUsage()
+{
+    std::cout << "=== 1. Usage ===" << std::endl;
+    FlatHashMap<std::string, int> ageMap;
+    ageMap["Alice"] = 20;
+    ageMap["Bob"] = 22;
+    ageMap["Charlie"] = 19;
+
+    // C++17 ṹճ (ע⣺˳ֵ)
+    for (auto [name, age] : ageMap)
+        std::cout << "  " << name << ": " << age << std::endl;
+    for (auto &[name, age] : ageMap) // ð󶨿޸ valuekey  const
+        age++;
+
+    // 칹ңstring_view / ַҪȹ std::string
+    std::string_view who = "Bob";
+    auto it = ageMap.find(who);
+    std::cout << "  find(string_view \"Bob\") -> " << it->second << ", contains(\"Dave\") -> " << std::boolalpha
+              << ageMap.contains("Dave") << std::endl;
+
+    // ߱ɾ iterators.md  5 ڵ "it = container.erase(it);" дһ
+    for (auto cur = ageMap.begin(); cur != ageMap.end();)
+    {
+        if (cur->second > 21)
+            cur = ageMap.erase(cur);
+        else
+            ++cur;
+    }
+    std::cout << "  after erasing age > 21: size " << ageMap.size() << ", capacity " << ageMap.capacity()
+              << std::endl;
+
+    ageMap.reserve(1000); // ֮ 1000 Ԫǰ rehash/һֱЧ
+    int *alice = &ageMap.at("Alice");
+    for (int i = 0; i < 998; i++)
+        ageMap["user" + std::to_string(i)] = i;
+    std::cout << "  reserve(1000) -> capacity " << ageMap.capacity() << ", reference still valid: " << *alice
+              << ", load factor " << ageMap.load_factor() << std::endl;
+}
+
+// ==========================================
+// 2. ȷԼ죺 std::unordered_map һ
+// ==========================================
+bool SelfCheck()
+{
+    FlatHashMap<std::uint64_t, std::uint64_t> flat;
+    std::unordered_map<std::uint64_t, std::uint64_t> reference;
+    std::mt19937_64 rng(42);
+    for (int i = 0; i < 2000000; i++)
+    {
+        std::uint64_t key = rng() % 50000; // key ռС/ɾͬһ keyĹ
+        switch (rng() % 4)
+        {
+        case 0:
+        case 1:
+            flat[key] = i;
+            reference[key] = i;
+            break;
+        case 2:
+            if (flat.erase(key) != reference.erase(key))
+                return false;
+            break;
+        default:
+        {
+            auto f = flat.find(key);
+            auto r = reference.find(key);
+            if ((f == flat.end()) != (r == reference.end()) || (f != flat.end() && f->second != r->second))
+                return false;
+        }
+        }
+    }
+    std::size_t visited = 0;
+    for (const auto &[key, value] : flat)
+    {
+        auto r = reference.find(key);
+        if (r == reference.end() || r->second != value)
+            return false;
+        visited++;
+    }
+    if (visited != reference.size() || flat.size() != reference.size())
+        return false;
+
+    // reserve(n) ֮뵽 n ԪΪֹԪضƶʹŴĹҲһ
+    FlatHashMap<std::uint64_t, std::uint64_t> stable;
+    for (int round = 0; round < 2000; round++)
+    {
+        for (int j = 0; j < 40; j++) // /ɾ reserve ֮ǰĹ
+        {
+            std::uint64_t key = rng() % 4000;
+            if (rng() % 2)
+                stable[key] = key;
+            else
+                stable.erase(key);
+        }
+        std::size_t extra = rng() % 200;
+        stable.reserve(stable.size() + extra);
+        std::vector<std::pair<std::uint64_t, const std::uint64_t *>> addresses;
+        for (const auto &[key, value] : stable)
+            addresses.emplace_back(key, &value);
+        for (std::size_t added = 0; added < extra;)
+        {
+            std::uint64_t key = 4000 + rng() % 4000; // ֻ key֤ǡ extra 
+            added += stable.try_emplace(key, key).second;
+        }
+        for (const auto &[key, address] : addresses)
+            if (&stable.find(key)->second != address)
+                return false;
+        for (std::uint64_t key = 4000; key < 8000; key++) //  keyĹһ
+            stable.erase(key);
+    }
+
+    // ʵֻʽת K std::unordered_map һ int  std::size_t Ϊ key ı
+    FlatHashMap<std::size_t, int> small;
+    small[3] = 1;
+    int three = 3;
+    return small.find(three) != small.end() && small.contains(three) && small.count(4) == 0 && small.erase(3) == 1 &&
+           small.empty();
+}
+
+// ==========================================
+// 3. ܶԱ
+// ==========================================
+template <typename Map, typename Key>
+void RunSuite(const char *name, const std::vector<Key> &keys, const std::vector<Key> &missing,
+              const std::vector<Key> &lookupOrder)
+{
+    std::cout << "-- " << name << " --" << std::endl;
+    const std::size_t n = keys.size();
+    Map map;
+    {
+        Timer timer("insert", n);
+        for (std::size_t i = 0; i < n; i++)
+            map.emplace(keys[i], static_cast<int>(i));
+    }
+    {
+        Timer timer("find hit", n);
+        long long sum = 0;
+        for (const Key &key : lookupOrder)
+            sum += map.find(key)->second;
+        DoNotOptimize(sum);
+    }
+    {
+        Timer timer("find miss", n);
+        std::size_t found = 0;
+        for (const Key &key : missing)
+            found += map.find(key) != map.end();
+        DoNotOptimize(found);
+    }
+    {
+        Timer timer("iterate", n);
+        long long sum = 0;
+        for (const auto &[key, value] : map)
+            sum += value;
+        DoNotOptimize(sum);
+    }
+    {
+        Timer timer("erase", n);
+        for (const Key &key : lookupOrder)
+            map.erase(key);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    DemoUsage();
+    std::cout << "\n=== 2. Self-check against std::unordered_map (2M random ops) ===" << std::endl;
+    std::cout << "  " << (SelfCheck() ? "OK" : "MISMATCH") << std::endl;
+
+    std::mt19937_64 rng(7);
+    std::vector<std::uint64_t> intKeys(n), intMissing(n);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        intKeys[i] = rng() | 1; // е key 
+        intMissing[i] = rng() & ~1ull; // δе key ż
+    }
+    std::vector<std::uint64_t> intOrder = intKeys;
+    std::shuffle(intOrder.begin(), intOrder.end(), rng);
+
+    std::vector<std::string> strKeys(n), strMissing(n);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        strKeys[i] = "user_" + std::to_string(rng() % 100000000) + "_" + std::to_string(i);
+        strMissing[i] = "guest_" + std::to_string(i);
+    }
+    std::vector<std::string> strOrder = strKeys;
+    std::shuffle(strOrder.begin(), strOrder.end(), rng);
+
+    std::cout << "\n=== 3. uint64_t -> int, " << n << " keys (Run in Release Mode! -O3) ===" << std::endl;
+    RunSuite<std::map<std::uint64_t, int>>("std::map", intKeys, intMissing, intOrder);
+    RunSuite<std::unordered_map<std::uint64_t, int>>("std::unordered_map", intKeys, intMissing, intOrder);
+    RunSuite<FlatHashMap<std::uint64_t, int>>("FlatHashMap", intKeys, intMissing, intOrder);
+
+    std::cout << "\n=== 4. std::string -> int, " << n << " keys ===" << std::endl;
+    RunSuite<std::map<std::string, int>>("std::map", strKeys, strMissing, strOrder);
+    RunSuite<std::unordered_map<std::string, int>>("std::unordered_map", strKeys, strMissing, strOrder);
+    RunSuite<FlatHashMap<std::string, int>>("FlatHashMap", strKeys, strMissing, strOrder);
+    return 0;
+}
@@ -0,0 +1,259 @@
+/**
+ * @file ranges_benchmark.cpp
+ * @brief /任ˮߣÿһһ vector ""д vs lazy:: ںͼ vs дѭͳƺʱֵڴ
+ * @note : g++ -O3 -std=c++17 ranges_benchmark.cpp -o ranges_benchmark
+ *       AVX2: g++ -O3 -std=c++17 -mavx2 ranges_benchmark.cpp -o ranges_benchmark
+ *       : ./ranges_benchmark [ԪظĬ 100000000]
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "LazyRanges.h"
+#include "../23_Benchmarking/CountingAllocator.h"
+#include "../23_Benchmarking/Timer.h"
+
+// ʱ + ӡδķͷֵ (ԽʱĴڴ)
+template <typename Fn>
+auto Measure(const char *name, std::size_t n, Fn fn)
+{
+    const std::size_t allocs = g_AllocCount, base = ResetPeakBytes();
+    decltype(fn()) result;
+    {
+        Timer timer(name, n);
+        result = fn();
+        DoNotOptimize(result);
+    }
+    std::cout << "    allocations " << g_AllocCount - allocs << ", peak extra heap " << (g_PeakBytes - base) / 1000000 << " MB" << std::endl;
+    return result;
+}
+
+// ==========================================
+// 1. ʾlambda.md  numbers / thresholdԼ
+// ==========================================
+void Demo()
+{
+    std::cout << "=== 1. Demo ===" << std::endl;
+    std::vector<int> numbers = {1, 5, 8, 9, 12, 4, 7};
+    int threshold = 6;
+
+    std::cout << "  > threshold, x10:";
+    for (int x : numbers | lazy::filter([threshold](int v) { return v > threshold; }) | lazy::transform([](int v) { return v * 10; }))
+        std::cout << " " << x;
+    std::cout << std::endl;
+
+    std::cout << "  enumerate | stride(2):";
+    for (auto [i, x] : numbers | lazy::enumerate() | lazy::stride(2))
+        std::cout << " [" << i << "]=" << x;
+    std::cout << std::endl;
+
+    std::cout << "  chunk(3):";
+    for (auto part : numbers | lazy::chunk(3))
+        std::cout << " {sum " << (part | lazy::sum()) << ", size " << part.Size() << "}";
+    std::cout << std::endl;
+
+    std::vector<int> weights = {2, 1, 0, 1, 1, 3};
+    std::cout << "  zip(numbers, weights) | transform(a*b) | sum = "
+              << (lazy::zip(numbers, weights) | lazy::transform([](auto p) { return p.first * p.second; }) | lazy::sum()) << std::endl;
+
+    std::list<int> linked(numbers.begin(), numbers.end()); // ߵ·
+    std::vector<int> firstOdd = linked | lazy::filter([](int v) { return v % 2 != 0; }) | lazy::take(3) | lazy::collect();
+    std::cout << "  list | filter(odd) | take(3) | collect:";
+    for (int x : firstOdd)
+        std::cout << " " << x;
+    std::cout << " (capacity " << firstOdd.capacity() << ")" << std::endl;
+}
+
+// ==========================================
+// 2. Լ죺 (begin/end)  (Drive) ·д߽һ
+// ==========================================
+bool SelfCheck()
+{
+    std::mt19937 rng(7);
+    bool ok = true;
+    for (int round = 0; round < 200; round++)
+    {
+        std::vector<int> v(rng() % 300);
+        for (int &x : v)
+            x = static_cast<int>(rng() % 100);
+        const std::size_t k = 1 + rng() % 5, n = rng() % 120;
+        auto odd = [](int x) { return x % 2 != 0; };
+        auto twice = [](int x) { return x * 2; };
+
+        // а汾
+        std::vector<int> expected;
+        for (std::size_t i = 0; i < v.size(); i += k)
+            if (odd(v[i]))
+                expected.push_back(twice(v[i]));
+        if (expected.size() > n)
+            expected.resize(n);
+
+        auto view = v | lazy::stride(k) | lazy::filter(odd) | lazy::transform(twice) | lazy::take(n);
+        std::vector<int> pushed = view | lazy::collect();
+        std::vector<int> pulled;
+        for (int x : view)
+            pulled.push_back(x);
+        ok &= pushed == expected && pulled == expected && (view | lazy::count()) == expected.size();
+
+        // ͬˮߣԴ list (ʣߵͼ֧)
+        std::list<int> linked(v.begin(), v.end());
+        ok &= (linked | lazy::stride(k) | lazy::filter(odd) | lazy::transform(twice) | lazy::take(n) | lazy::collect()) == expected;
+
+        // ȫʣtransform | take | chunk | enumerateһ
+        auto sized = v | lazy::transform(twice) | lazy::take(n);
+        std::vector<int> flat;
+        for (auto part : sized | lazy::chunk(k))
+            for (int x : part)
+                flat.push_back(x);
+        ok &= flat == (sized | lazy::collect()) && flat.size() == std::min(n, v.size());
+        // ռƬǵ ChunkView ʱƬȻҪܶ
+        auto parts = sized | lazy::chunk(k) | lazy::collect();
+        std::vector<int> joined;
+        for (const auto &part : parts)
+            for (int x : part)
+                joined.push_back(x);
+        ok &= joined == flat && parts.size() == (flat.size() + k - 1) / k;
+        std::size_t index = 0;
+        for (auto [i, x] : v | lazy::enumerate())
+            ok &= i == index && x == v[index], index++;
+    }
+    return ok;
+}
+
+// ==========================================
+// 3. ׼ˮߣд (ÿһ vector) vs ں
+// ==========================================
+void Benchmark(std::size_t n)
+{
+    std::cout << "\n=== 3. " << n << " elements (Run in Release Mode! -O3) ===" << std::endl;
+    std::vector<int> a(n), b(n);
+    std::mt19937 rng(42);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        a[i] = static_cast<int>(rng() % 1000);
+        b[i] = static_cast<int>(rng() % 1000);
+    }
+    auto even = [](int x) { return x % 2 == 0; };
+    auto square = [](int x) { return static_cast<std::int64_t>(x) * x; };
+
+    std::cout << "-- (a) filter(even) | transform(square) | sum --" << std::endl;
+    std::int64_t r1[3];
+    r1[0] = Measure("eager: copy_if -> vector, transform -> vector, accumulate", n, [&]
+                    {
+        std::vector<int> evens;
+        std::copy_if(a.begin(), a.end(), std::back_inserter(evens), even);
+        std::vector<std::int64_t> squares;
+        std::transform(evens.begin(), evens.end(), std::back_inserter(squares), square);
+        return std::accumulate(squares.begin(), squares.end(), std::int64_t{0}); });
+    r1[1] = Measure("lazy: a | filter | transform | sum", n, [&]
+                    { return a | lazy::filter(even) | lazy::transform(square) | lazy::sum(); });
+    r1[2] = Measure("hand-written loop", n, [&]
+                    {
+        std::int64_t sum = 0;
+        for (int x : a)
+            if (even(x))
+                sum += square(x);
+        return sum; });
+    std::cout << "  results " << (r1[0] == r1[1] && r1[1] == r1[2] ? "identical" : "DIFFER") << std::endl;
+
+    std::cout << "-- (b) transform(3x+1) | filter(% 7 != 0) | take(n/4) | collect --" << std::endl;
+    auto affine = [](int x) { return 3 * x + 1; };
+    auto notSeven = [](int x) { return x % 7 != 0; };
+    const std::size_t quarter = n / 4;
+    std::vector<int> r2[2];
+    r2[0] = Measure("eager: transform -> vector, copy_if -> vector, first n/4 -> vector", n, [&]
+                    {
+        std::vector<int> mapped;
+        std::transform(a.begin(), a.end(), std::back_inserter(mapped), affine);
+        std::vector<int> kept;
+        std::copy_if(mapped.begin(), mapped.end(), std::back_inserter(kept), notSeven);
+        return std::vector<int>(kept.begin(), kept.begin() + static_cast<std::ptrdiff_t>(std::min(quarter, kept.size()))); });
+    r2[1] = Measure("lazy: ... | take(n/4) | collect (stops early)", n, [&]
+                    { return a | lazy::transform(affine) | lazy::filter(notSeven) | lazy::take(quarter) | lazy::collect(); });
+    std::cout << "  results " << (r2[0] == r2[1] ? "identical" : "DIFFER") << std::endl;
+
+    std::cout << "-- (c) zip(a, b) | transform(a*b) | sum (dot product) --" << std::endl;
+    auto product = [](auto p) { return static_cast<std::int64_t>(p.first) * p.second; };
+    std::int64_t r3[3];
+    r3[0] = Measure("eager: products -> vector, accumulate", n, [&]
+                    {
+        std::vector<std::int64_t> products;
+        for (std::size_t i = 0; i < n; i++)
+            products.push_back(static_cast<std::int64_t>(a[i]) * b[i]);
+        return std::accumulate(products.begin(), products.end(), std::int64_t{0}); });
+    r3[1] = Measure("lazy: zip | transform | sum (random-access path)", n, [&]
+                    { return lazy::zip(a, b) | lazy::transform(product) | lazy::sum(); });
+    r3[2] = Measure("std::inner_product", n, [&]
+                    { return std::inner_product(a.begin(), a.end(), b.begin(), std::int64_t{0}); });
+    std::cout << "  results " << (r3[0] == r3[1] && r3[1] == r3[2] ? "identical" : "DIFFER") << std::endl;
+
+    std::cout << "-- (d) transform(x*2+b) over the whole input | collect (sized: exact reserve) --" << std::endl;
+    std::vector<int> r4[3];
+    r4[0] = Measure("eager: push_back into vector without reserve", n, [&]
+                    {
+        std::vector<int> out;
+        for (std::size_t i = 0; i < n; i++)
+            out.push_back(a[i] * 2 + b[i]);
+        return out; });
+    r4[1] = Measure("lazy: zip | transform | collect", n, [&]
+                    { return lazy::zip(a, b) | lazy::transform([](auto p) { return p.first * 2 + p.second; }) | lazy::collect(); });
+    r4[2] = Measure("hand-written: resize + index loop", n, [&]
+                    {
+        std::vector<int> out(n);
+        for (std::size_t i = 0; i < n; i++)
+            out[i] = a[i] * 2 + b[i];
+        return out; });
+    std::cout << "  results " << (r4[0] == r4[1] && r4[1] == r4[2] ? "identical" : "DIFFER") << std::endl;
+
+    std::cout << "-- (e) enumerate | stride(4) | transform(i ^ x) | sum, chunk(4096) | transform(sum) | collect --" << std::endl;
+    auto mix = [](auto p) { return static_cast<std::int64_t>(p.first ^ static_cast<std::size_t>(p.second)); };
+    std::int64_t r5[2];
+    r5[0] = Measure("eager: vector<pair<index, x>>, strided copy, transform, accumulate", n, [&]
+                    {
+        std::vector<std::pair<std::size_t, int>> indexed;
+        for (std::size_t i = 0; i < n; i++)
+            indexed.emplace_back(i, a[i]);
+        std::vector<std::pair<std::size_t, int>> strided;
+        for (std::size_t i = 0; i < indexed.size(); i += 4)
+            strided.push_back(indexed[i]);
+        std::vector<std::int64_t> mixed;
+        std::transform(strided.begin(), strided.end(), std::back_inserter(mixed), mix);
+        return std::accumulate(mixed.begin(), mixed.end(), std::int64_t{0}); });
+    r5[1] = Measure("lazy: enumerate | stride | transform | sum", n, [&]
+                    { return a | lazy::enumerate() | lazy::stride(4) | lazy::transform(mix) | lazy::sum(); });
+    std::vector<std::int64_t> r6[2];
+    r6[0] = Measure("eager: vector<vector<int>> chunks, then sum each", n, [&]
+                    {
+        std::vector<std::vector<int>> chunks;
+        for (std::size_t i = 0; i < n; i += 4096)
+            chunks.emplace_back(a.begin() + static_cast<std::ptrdiff_t>(i), a.begin() + static_cast<std::ptrdiff_t>(std::min(n, i + 4096)));
+        std::vector<std::int64_t> sums;
+        for (const std::vector<int> &c : chunks)
+            sums.push_back(std::accumulate(c.begin(), c.end(), std::int64_t{0}));
+        return sums; });
+    r6[1] = Measure("lazy: chunk | transform(slice | sum) | collect", n, [&]
+                    {
+        return a | lazy::chunk(4096) | lazy::transform([](auto part)
+                                                       { return part | lazy::reduce(std::int64_t{0}); }) |
+               lazy::collect(); });
+    std::cout << "  results " << (r5[0] == r5[1] && r6[0] == r6[1] ? "identical" : "DIFFER") << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000000;
+    Demo();
+    std::cout << "\n=== 2. Self-check (pull vs push vs eager, vector vs list source) ===" << std::endl;
+    std::cout << "  " << (SelfCheck() ? "all pipelines match" : "MISMATCH") << std::endl;
+    Benchmark(n);
+    return 0;
+}